@@ -23,37 +23,91 @@ package com.ibm.j9ddr.vm29.j9.gc;
 
 import static com.ibm.j9ddr.vm29.events.EventManager.raiseCorruptDataEvent;
 
+import java.util.ArrayList;
+import java.util.Collections;
 import java.util.Iterator;
+import java.util.List;
 
 import com.ibm.j9ddr.CorruptDataException;
 import com.ibm.j9ddr.vm29.j9.Pool;
 import com.ibm.j9ddr.vm29.pointer.PointerPointer;
 import com.ibm.j9ddr.vm29.pointer.VoidPointer;
+import com.ibm.j9ddr.vm29.pointer.generated.J9JNIGlobalReferenceStripePointer;
+import com.ibm.j9ddr.vm29.pointer.generated.J9JavaVMPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9ObjectPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9PoolPointer;
+import com.ibm.j9ddr.vm29.types.UDATA;
 
 public class GCJNIGlobalReferenceIterator extends GCIterator
 {
 	protected Iterator<PointerPointer> iterator;
+	protected Iterator<J9PoolPointer> pools;
 	
 	protected GCJNIGlobalReferenceIterator(J9PoolPointer globalRefs) throws CorruptDataException
 	{
-		iterator = Pool.fromJ9Pool(globalRefs, PointerPointer.class).iterator(); 
+		this(Collections.singletonList(globalRefs));
+	}
+
+	protected GCJNIGlobalReferenceIterator(List<J9PoolPointer> globalRefPools) throws CorruptDataException
+	{
+		pools = globalRefPools.iterator();
+		iterator = Collections.<PointerPointer>emptyList().iterator();
 	}
 
 	public static GCJNIGlobalReferenceIterator from() throws CorruptDataException
 	{
-		return new GCJNIGlobalReferenceIterator(getJavaVM().jniGlobalReferences());
+		return new GCJNIGlobalReferenceIterator(referencePools(getJavaVM(), false));
+	}
+
+	public static GCJNIGlobalReferenceIterator fromPool(J9PoolPointer globalRefs) throws CorruptDataException
+	{
+		return new GCJNIGlobalReferenceIterator(globalRefs);
+	}
+
+	/**
+	 * Returns the pools holding the JNI global (or weak global) references.
+	 * References are spread over several stripes; cores from VMs which predate
+	 * the stripes have a single pool.
+	 */
+	public static List<J9PoolPointer> referencePools(J9JavaVMPointer vm, boolean weak) throws CorruptDataException
+	{
+		List<J9PoolPointer> result = new ArrayList<J9PoolPointer>();
+		try {
+			J9JNIGlobalReferenceStripePointer stripe = vm.jniGlobalReferenceStripes();
+			UDATA stripeCount = vm.jniGlobalReferenceStripeCount();
+			for (long i = 0; i < stripeCount.longValue(); i++) {
+				J9JNIGlobalReferenceStripePointer current = stripe.add(i);
+				result.add(weak ? current.weakGlobalReferences() : current.globalReferences());
+			}
+		} catch (NoSuchFieldError e) {
+			/* old core without reference stripes */
+			result.clear();
+		}
+		if (result.isEmpty()) {
+			result.add(weak ? vm.jniWeakGlobalReferences() : vm.jniGlobalReferences());
+		}
+		return result;
 	}
 	
 	public boolean hasNext()
 	{
-		return iterator.hasNext();
+		while (!iterator.hasNext()) {
+			if (!pools.hasNext()) {
+				return false;
+			}
+			try {
+				iterator = Pool.fromJ9Pool(pools.next(), PointerPointer.class).iterator();
+			} catch (CorruptDataException e) {
+				raiseCorruptDataEvent("Error getting JNI global reference pool", e, false);
+			}
+		}
+		return true;
 	}
 
 	public J9ObjectPointer next()
 	{
 		try {
+			hasNext();
 			PointerPointer next = iterator.next(); 
 			return J9ObjectPointer.cast(next.at(0));
 		} catch (CorruptDataException e) {
@@ -64,6 +118,7 @@ public class GCJNIGlobalReferenceIterator extends GCIterator
 
 	public VoidPointer nextAddress()
 	{
+		hasNext();
 		return VoidPointer.cast(iterator.next());
 	}
 }
@@ -21,6 +21,8 @@
  *******************************************************************************/
 package com.ibm.j9ddr.vm29.j9.gc;
 
+import java.util.List;
+
 import com.ibm.j9ddr.CorruptDataException;
 import com.ibm.j9ddr.vm29.pointer.generated.J9PoolPointer;
 
@@ -31,8 +33,18 @@ public class GCJNIWeakGlobalReferenceIterator extends GCJNIGlobalReferenceIterat
 		super(weakGlobalRefs); 
 	}
 
+	protected GCJNIWeakGlobalReferenceIterator(List<J9PoolPointer> weakGlobalRefPools) throws CorruptDataException
+	{
+		super(weakGlobalRefPools);
+	}
+
 	public static GCJNIWeakGlobalReferenceIterator from() throws CorruptDataException
 	{
-		return new GCJNIWeakGlobalReferenceIterator(getJavaVM().jniWeakGlobalReferences());
+		return new GCJNIWeakGlobalReferenceIterator(referencePools(getJavaVM(), true));
+	}
+
+	public static GCJNIWeakGlobalReferenceIterator fromPool(J9PoolPointer weakGlobalRefs) throws CorruptDataException
+	{
+		return new GCJNIWeakGlobalReferenceIterator(weakGlobalRefs);
 	}
 }
@@ -26,6 +26,7 @@ import com.ibm.j9ddr.vm29.j9.gc.GCJNIGlobalReferenceIterator;
 import com.ibm.j9ddr.vm29.pointer.PointerPointer;
 import com.ibm.j9ddr.vm29.pointer.VoidPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9ObjectPointer;
+import com.ibm.j9ddr.vm29.pointer.generated.J9PoolPointer;
 
 import static com.ibm.j9ddr.vm29.tools.ddrinteractive.gccheck.CheckBase.*;
 
@@ -35,13 +36,15 @@ class CheckJNIGlobalReferences extends Check
 	public void check()
 	{
 		try {
-			VoidPointer globalRefs = VoidPointer.cast(getJavaVM().jniGlobalReferences()); 
-			GCJNIGlobalReferenceIterator jniGlobalReferenceIterator = GCJNIGlobalReferenceIterator.from();
-			while(jniGlobalReferenceIterator.hasNext()) {
-				PointerPointer slot = PointerPointer.cast(jniGlobalReferenceIterator.nextAddress());
-				if(slot.notNull()) {
-					if (_engine.checkSlotPool(slot, globalRefs) != J9MODRON_SLOT_ITERATOR_OK) {
-						return;
+			for (J9PoolPointer pool : GCJNIGlobalReferenceIterator.referencePools(getJavaVM(), false)) {
+				VoidPointer globalRefs = VoidPointer.cast(pool);
+				GCJNIGlobalReferenceIterator jniGlobalReferenceIterator = GCJNIGlobalReferenceIterator.fromPool(pool);
+				while(jniGlobalReferenceIterator.hasNext()) {
+					PointerPointer slot = PointerPointer.cast(jniGlobalReferenceIterator.nextAddress());
+					if(slot.notNull()) {
+						if (_engine.checkSlotPool(slot, globalRefs) != J9MODRON_SLOT_ITERATOR_OK) {
+							return;
+						}
 					}
 				}
 			}
@@ -60,16 +63,18 @@ class CheckJNIGlobalReferences extends Check
 	public void print()
 	{
 		try {
-			VoidPointer globalRefs = VoidPointer.cast(getJavaVM().jniGlobalReferences()); 
-			GCJNIGlobalReferenceIterator jniGlobalReferenceIterator = GCJNIGlobalReferenceIterator.from();
-			ScanFormatter formatter = new ScanFormatter(this, "jniGlobalReferences", globalRefs);
-			while(jniGlobalReferenceIterator.hasNext()) {
-				J9ObjectPointer slot = jniGlobalReferenceIterator.next();
-				if(slot.notNull()) {
-					formatter.entry(slot);
+			for (J9PoolPointer pool : GCJNIGlobalReferenceIterator.referencePools(getJavaVM(), false)) {
+				VoidPointer globalRefs = VoidPointer.cast(pool);
+				GCJNIGlobalReferenceIterator jniGlobalReferenceIterator = GCJNIGlobalReferenceIterator.fromPool(pool);
+				ScanFormatter formatter = new ScanFormatter(this, "jniGlobalReferences", globalRefs);
+				while(jniGlobalReferenceIterator.hasNext()) {
+					J9ObjectPointer slot = jniGlobalReferenceIterator.next();
+					if(slot.notNull()) {
+						formatter.entry(slot);
+					}
 				}
+				formatter.end("jniGlobalReferences", globalRefs);
 			}
-			formatter.end("jniGlobalReferences", globalRefs);
 		} catch (CorruptDataException e) {
 			// TODO: handle exception
 		}
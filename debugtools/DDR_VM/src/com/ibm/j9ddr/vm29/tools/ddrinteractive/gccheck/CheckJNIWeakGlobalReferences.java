@@ -26,6 +26,7 @@ import com.ibm.j9ddr.vm29.j9.gc.GCJNIWeakGlobalReferenceIterator;
 import com.ibm.j9ddr.vm29.pointer.PointerPointer;
 import com.ibm.j9ddr.vm29.pointer.VoidPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9ObjectPointer;
+import com.ibm.j9ddr.vm29.pointer.generated.J9PoolPointer;
 
 import static com.ibm.j9ddr.vm29.tools.ddrinteractive.gccheck.CheckBase.*;
 
@@ -35,13 +36,15 @@ class CheckJNIWeakGlobalReferences extends Check
 	public void check()
 	{
 		try {
-			VoidPointer weakRefs = VoidPointer.cast(getJavaVM().jniWeakGlobalReferences()); 
-			GCJNIWeakGlobalReferenceIterator jniWeakGlobalReferenceIterator = GCJNIWeakGlobalReferenceIterator.from();
-			while(jniWeakGlobalReferenceIterator.hasNext()) {
-				PointerPointer slot = PointerPointer.cast(jniWeakGlobalReferenceIterator.nextAddress());
-				if(slot.notNull()) {
-					if (_engine.checkSlotPool(slot, weakRefs) != J9MODRON_SLOT_ITERATOR_OK) {
-						return;
+			for (J9PoolPointer pool : GCJNIWeakGlobalReferenceIterator.referencePools(getJavaVM(), true)) {
+				VoidPointer weakRefs = VoidPointer.cast(pool);
+				GCJNIWeakGlobalReferenceIterator jniWeakGlobalReferenceIterator = GCJNIWeakGlobalReferenceIterator.fromPool(pool);
+				while(jniWeakGlobalReferenceIterator.hasNext()) {
+					PointerPointer slot = PointerPointer.cast(jniWeakGlobalReferenceIterator.nextAddress());
+					if(slot.notNull()) {
+						if (_engine.checkSlotPool(slot, weakRefs) != J9MODRON_SLOT_ITERATOR_OK) {
+							return;
+						}
 					}
 				}
 			}
@@ -60,16 +63,18 @@ class CheckJNIWeakGlobalReferences extends Check
 	public void print()
 	{
 		try {
-			VoidPointer weakRefs = VoidPointer.cast(getJavaVM().jniWeakGlobalReferences()); 
-			GCJNIWeakGlobalReferenceIterator jniWeakGlobalReferenceIterator = GCJNIWeakGlobalReferenceIterator.from();
-			ScanFormatter formatter = new ScanFormatter(this, "jniWeakGlobalReferences", weakRefs);
-			while(jniWeakGlobalReferenceIterator.hasNext()) {
-				J9ObjectPointer slot = jniWeakGlobalReferenceIterator.next();
-				if(slot.notNull()) {
-					formatter.entry(slot);
+			for (J9PoolPointer pool : GCJNIWeakGlobalReferenceIterator.referencePools(getJavaVM(), true)) {
+				VoidPointer weakRefs = VoidPointer.cast(pool);
+				GCJNIWeakGlobalReferenceIterator jniWeakGlobalReferenceIterator = GCJNIWeakGlobalReferenceIterator.fromPool(pool);
+				ScanFormatter formatter = new ScanFormatter(this, "jniWeakGlobalReferences", weakRefs);
+				while(jniWeakGlobalReferenceIterator.hasNext()) {
+					J9ObjectPointer slot = jniWeakGlobalReferenceIterator.next();
+					if(slot.notNull()) {
+						formatter.entry(slot);
+					}
 				}
+				formatter.end("jniWeakGlobalReferences", weakRefs);
 			}
-			formatter.end("jniWeakGlobalReferences", weakRefs);
 		} catch (CorruptDataException e) {
 			// TODO: handle exception
 		}
@@ -43,10 +43,18 @@ abstract class ConvertHandle extends MethodHandle {
 		super(originalHandle, newType);
 		this.next = originalHandle.next;
 		this.requiresBoxing = originalHandle.requiresBoxing;
+		this.argumentsUnchanged = originalHandle.argumentsUnchanged;
 	}
 
 	@VMCONSTANTPOOL_FIELD
 	boolean requiresBoxing = false;
+
+	/*
+	 * True when every argument is either identical or a reference already assignable
+	 * to the target type, so the interpreter can pass the stacked arguments through as is.
+	 */
+	@VMCONSTANTPOOL_FIELD
+	boolean argumentsUnchanged = false;
 	
 	/*
 	 * Determine if the arguments can be converted from the MethodType fromType to that of toType.
@@ -61,6 +69,7 @@ abstract class ConvertHandle extends MethodHandle {
 		}
 		
 		boolean isExplicitCast = (kind == KIND_EXPLICITCAST);
+		boolean unchanged = true;
 			
 		// Ensure argsToCollect can be converted to type of array
 		for (int i = 0; i < toArgs.length; i++ ) {
@@ -77,9 +86,14 @@ abstract class ConvertHandle extends MethodHandle {
 			
 			// both are reference types, then apply a cast at runtime
 			if (!toIsPrimitive && !fromIsPrimitive) {
+				if (!toClass.isAssignableFrom(fromClass)) {
+					unchanged = false;
+				}
 				continue;
 			}
 
+			unchanged = false;
+
 			// primitive to primitive conversion
 			if (toIsPrimitive && fromIsPrimitive) {
 				// if not explicitCast, only widening primitive conversions allowed
@@ -113,6 +127,7 @@ abstract class ConvertHandle extends MethodHandle {
 			}
 			throwWrongMethodTypeException(fromType, toType, i);
 		}
+		argumentsUnchanged = unchanged;
 	}
 	
 	static final void throwWrongMethodTypeException(MethodType fromType, MethodType toType, int index) throws WrongMethodTypeException {
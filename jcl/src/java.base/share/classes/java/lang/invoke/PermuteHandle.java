@@ -29,16 +29,50 @@ final class PermuteHandle extends MethodHandle {
 	@VMCONSTANTPOOL_FIELD
 	private final int[] permute;
 
+	/*
+	 * The permute array translated into stack slots, computed once so the interpreter
+	 * does not look up each argument type on every invocation. Each entry is the
+	 * source slot index (counted down from the first argument) shifted left by one,
+	 * with the low bit set for long and double arguments which occupy two slots.
+	 */
+	@VMCONSTANTPOOL_FIELD
+	private final int[] slotPermute;
+
 	PermuteHandle(MethodType type, MethodHandle next, int[] permute) {
 		super(type, KIND_PERMUTE, permute); //$NON-NLS-1$
  		this.next    = next;
  		this.permute = permute;
+ 		this.slotPermute = computeSlotPermute(type, permute);
 	}
 	
 	PermuteHandle(PermuteHandle originalHandle, MethodType newType) {
 		super(originalHandle, newType);
 		this.next = originalHandle.next;
 		this.permute = originalHandle.permute;
+		/* cloneWithNewType() only changes reference types, so the slot layout is unchanged */
+		this.slotPermute = originalHandle.slotPermute;
+	}
+
+	private static int[] computeSlotPermute(MethodType type, int[] permute) {
+		Class<?>[] arguments = type.arguments;
+		int[] slotIndex = new int[arguments.length];
+		boolean[] twoSlots = new boolean[arguments.length];
+		int slot = 0;
+		for (int i = 0; i < arguments.length; i++) {
+			if ((arguments[i] == long.class) || (arguments[i] == double.class)) {
+				twoSlots[i] = true;
+				slot += 1;
+			}
+			slotIndex[i] = slot;
+			slot += 1;
+		}
+
+		int[] result = new int[permute.length];
+		for (int i = 0; i < permute.length; i++) {
+			int argument = permute[i];
+			result[i] = (slotIndex[argument] << 1) | (twoSlots[argument] ? 1 : 0);
+		}
+		return result;
 	}
 	
 	/*
@@ -1270,7 +1270,10 @@ ROMClassBuilder::compareROMClassForEquality(U_8 *romClass,bool romClassIsShared,
 {
 	bool ret = false;
 
-	if (isLambda) {
+	if (!compareROMClassHeader((J9ROMClass *)romClass, classFileOracle, modifiers, extraModifiers, isLambda)) {
+		/* The header differs in a field the ComparingCursor checks exactly, so the full walk cannot succeed. */
+		ret = false;
+	} else if (isLambda) {
 		if (sizeof(U_64) < abs((int)(romSize - ((J9ROMClass *)romClass)->romSize))) {
 			/* If the class is a lambda class, we compare the romSizes first to save time. Lambda class names are in the format of
 			 * HostClassName$$Lambda$<IndexNumber>/0000000000000000. When we reach this check, the host class names will be the
@@ -1313,6 +1316,43 @@ ROMClassBuilder::compareROMClassForEquality(U_8 *romClass,bool romClassIsShared,
 	return ret;
 }
 
+/*
+ * Cheap pre-check for compareROMClassForEquality(). A full comparison lays the whole ROMClass
+ * down through a ComparingCursor, which keeps walking (without comparing) after the first
+ * difference. Shared cache lookups commonly offer several candidates with the same name, so
+ * reject those whose header scalars differ before paying for the walk.
+ *
+ * Only fields that the ComparingCursor compares exactly (Cursor::GENERIC) are checked here, so
+ * this never rejects a ROMClass the full comparison would accept. The class file size is
+ * allowed to vary for lambda classes, so it is left to the ComparingCursor in that case.
+ */
+bool
+ROMClassBuilder::compareROMClassHeader(J9ROMClass *romClass, ClassFileOracle *classFileOracle, U_32 modifiers, U_32 extraModifiers, bool isLambda)
+{
+	if ((romClass->modifiers != modifiers)
+		|| (romClass->extraModifiers != extraModifiers)
+		|| (romClass->romMethodCount != classFileOracle->getMethodsCount())
+		|| (romClass->romFieldCount != classFileOracle->getFieldsCount())
+		|| (romClass->interfaceCount != classFileOracle->getInterfacesCount())
+		|| (romClass->singleScalarStaticCount != classFileOracle->getSingleScalarStaticCount())
+		|| (romClass->objectStaticCount != classFileOracle->getObjectStaticCount())
+		|| (romClass->doubleScalarStaticCount != classFileOracle->getDoubleScalarStaticCount())
+		|| (romClass->memberAccessFlags != classFileOracle->getMemberAccessFlags())
+		|| (romClass->innerClassCount != classFileOracle->getInnerClassCount())
+		|| (romClass->majorVersion != classFileOracle->getMajorVersion())
+		|| (romClass->minorVersion != classFileOracle->getMinorVersion())
+		|| (romClass->maxBranchCount != classFileOracle->getMaxBranchCount())
+		|| (romClass->bsmCount != classFileOracle->getBootstrapMethodCount())
+		|| (romClass->classFileCPCount != classFileOracle->getConstantPoolCount())
+	) {
+		return false;
+	}
+	if (!isLambda && (romClass->classFileSize != classFileOracle->getClassFileSize())) {
+		return false;
+	}
+	return true;
+}
+
 #if defined(J9VM_OPT_SHARED_CLASSES)
 #if defined(J9VM_ENV_DATA64)
 /**
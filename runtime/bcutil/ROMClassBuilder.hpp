@@ -151,6 +151,7 @@ private:
 	bool compareROMClassForEquality(U_8 *romClass, bool romClassIsShared,
 			ROMClassWriter *romClassWriter, SRPOffsetTable *srpOffsetTable, SRPKeyProducer *srpKeyProducer, ClassFileOracle *classFileOracle,
 			U_32 modifiers, U_32 extraModifiers, U_32 optionalFlags, ROMClassCreationContext * context, U_32 romSize, bool isLambda);
+	bool compareROMClassHeader(J9ROMClass *romClass, ClassFileOracle *classFileOracle, U_32 modifiers, U_32 extraModifiers, bool isLambda);
 	SharedCacheRangeInfo getSharedCacheSRPRangeInfo(void *address);
 	void getSizeInfo(ROMClassCreationContext *context, ROMClassWriter *romClassWriter, SRPOffsetTable *srpOffsetTable, bool *countDebugDataOutOfLine, SizeInformation *sizeInformation);
 };
@@ -554,6 +554,7 @@ readFile (J9JavaVM * javaVM) {
 		goto _failedFileRead;
 	}
 	javaVM->dynamicLoadBuffers->currentSunClassFileSize = fileSize;
+	javaVM->dynamicLoadBuffers->currentSunClassFileData = javaVM->dynamicLoadBuffers->sunClassFileBuffer;
 	j9file_close(fd);
 	return 0;
 
@@ -584,6 +585,7 @@ readZip (J9JavaVM * javaVM, J9ClassPathEntry * cpEntry) {
 	VMIZipEntry entry;
 	I_32 result;
 	U_32 size;
+	U_8 *data = NULL;
 	IDATA filenameLength;
 
 	zipFile = (VMIZipFile *) (cpEntry->extraInfo);
@@ -599,6 +601,15 @@ readZip (J9JavaVM * javaVM, J9ClassPathEntry * cpEntry) {
 	}
 
 	size = entry.uncompressedSize;
+
+	/* Stored entries are handed out directly from the mapped jar, avoiding both the read and the copy. */
+	if (0 == zipFunctions->zip_getZipEntryDataPointer(VMI, zipFile, &entry, &data)) {
+		javaVM->dynamicLoadBuffers->currentSunClassFileSize = size;
+		javaVM->dynamicLoadBuffers->currentSunClassFileData = data;
+		result = 0;
+		goto finished;
+	}
+
 	if (checkSunClassFileBuffers(javaVM, size)) {
 		/* Out of memory. */
 		result = -1;
@@ -613,6 +624,7 @@ readZip (J9JavaVM * javaVM, J9ClassPathEntry * cpEntry) {
 	}
 
 	javaVM->dynamicLoadBuffers->currentSunClassFileSize = size;
+	javaVM->dynamicLoadBuffers->currentSunClassFileData = javaVM->dynamicLoadBuffers->sunClassFileBuffer;
 
   finished:
   	zipFunctions->zip_freeZipEntry(VMI, &entry);
@@ -655,6 +667,7 @@ readFileFromJImage (J9VMThread *vmThread, J9Module *j9module, U_8 *moduleName, J
 			rc = jimageIntf->jimageGetResource(jimageIntf, jimageHandle, resourceLocation, (char *)dynamicLoadBuffers->sunClassFileBuffer, dynamicLoadBuffers->sunClassFileSize, NULL);
 			if (J9JIMAGE_NO_ERROR == rc) {
 				dynamicLoadBuffers->currentSunClassFileSize = (UDATA)size;
+				dynamicLoadBuffers->currentSunClassFileData = dynamicLoadBuffers->sunClassFileBuffer;
 				rc = 0;
 			} else {
 				rc = -1;
@@ -81,25 +81,20 @@ convertITableOffsetToVTableOffset(J9VMThread *currentThread, J9Class *receiverCl
 		goto foundITable;
 	}
 	
-	iTable = (J9ITable*)receiverClass->iTable;
-	while (NULL != iTable) {
-		if (interfaceClass == iTable->interfaceClass) {
-			receiverClass->lastITable = iTable;
+	iTable = VM_VMHelpers::findITable(receiverClass, interfaceClass);
+	if (NULL != iTable) {
+		receiverClass->lastITable = iTable;
 foundITable:
-			if (J9_UNEXPECTED(J9_ARE_ANY_BITS_SET(iTableOffset, J9_ITABLE_OFFSET_TAG_BITS))) {
-				/* Direct methods should not reach here - no possibility of obtaining a vTableOffset */
-				Assert_CodertVM_false(J9_ARE_ANY_BITS_SET(iTableOffset, J9_ITABLE_OFFSET_DIRECT));
-				/* Object method in the vTable */
-				vTableOffset = iTableOffset & ~J9_ITABLE_OFFSET_TAG_BITS;
-			} else {
-				/* Standard interface method */
-				vTableOffset = *(UDATA*)(((UDATA)iTable) + iTableOffset);
-			}
-			goto done;
+		if (J9_UNEXPECTED(J9_ARE_ANY_BITS_SET(iTableOffset, J9_ITABLE_OFFSET_TAG_BITS))) {
+			/* Direct methods should not reach here - no possibility of obtaining a vTableOffset */
+			Assert_CodertVM_false(J9_ARE_ANY_BITS_SET(iTableOffset, J9_ITABLE_OFFSET_DIRECT));
+			/* Object method in the vTable */
+			vTableOffset = iTableOffset & ~J9_ITABLE_OFFSET_TAG_BITS;
+		} else {
+			/* Standard interface method */
+			vTableOffset = *(UDATA*)(((UDATA)iTable) + iTableOffset);
 		}
-		iTable = iTable->next;
 	}
-done:
 	return vTableOffset;
 }
 
@@ -1480,6 +1480,59 @@ typedef struct TR_jit_artifact_search_cache
 	J9JITExceptionTable * volatile exceptionTable;
 } TR_jit_artifact_search_cache;
 
+/* The most recently found method bodies and code cache hash table, stored after the
+ * JIT_ARTIFACT_SEARCH_CACHE_SIZE PC entries in the same allocation.  A PC which misses the
+ * PC cache is usually in a body the thread has seen recently, or at least in the same code cache.
+ * Any modification must be applied to the mirror in HookHelpers.cpp.
+ */
+#define JIT_ARTIFACT_SEARCH_MRU_SIZE 4
+typedef struct TR_jit_artifact_search_mru
+{
+	J9JITExceptionTable * volatile bodies[JIT_ARTIFACT_SEARCH_MRU_SIZE];
+	J9JITHashTable *tableHint;
+} TR_jit_artifact_search_mru;
+
+#define JIT_ARTIFACT_SEARCH_CACHE_ALLOCATION_SIZE \
+	((JIT_ARTIFACT_SEARCH_CACHE_SIZE * sizeof(TR_jit_artifact_search_cache)) + sizeof(TR_jit_artifact_search_mru))
+
+#define JIT_ARTIFACT_CONTAINS_PC(exceptionTable, pc) \
+	((((pc) >= (exceptionTable)->startPC) && ((pc) < (exceptionTable)->endWarmPC)) \
+	|| ((0 != (exceptionTable)->startColdPC) && ((pc) >= (exceptionTable)->startColdPC) && ((pc) < (exceptionTable)->endPC)))
+
+#ifdef J9JIT_ARTIFACT_SEARCH_CACHE_ENABLE
+/**
+ * Find the metadata for maskedPC among the recently found bodies, falling back to the code cache
+ * hash tables. The vmThread owning the cache may not be the current thread, so every body read
+ * from the cache is validated against the PC before it is used.
+ */
+static J9JITExceptionTable *
+jitSearchRecentArtifacts(J9VMThread *vmThread, TR_jit_artifact_search_mru *mru, UDATA maskedPC)
+{
+	J9JITExceptionTable *exceptionTable = NULL;
+	UDATA i = 0;
+
+	for (i = 0; i < JIT_ARTIFACT_SEARCH_MRU_SIZE; ++i) {
+		exceptionTable = mru->bodies[i];
+		if ((NULL != exceptionTable) && JIT_ARTIFACT_CONTAINS_PC(exceptionTable, maskedPC)) {
+			if (0 != i) {
+				mru->bodies[i] = mru->bodies[0];
+				mru->bodies[0] = exceptionTable;
+			}
+			return exceptionTable;
+		}
+	}
+
+	exceptionTable = jit_artifact_search_with_table_hint(vmThread->javaVM->jitConfig->translationArtifacts, &mru->tableHint, maskedPC);
+	if (NULL != exceptionTable) {
+		for (i = JIT_ARTIFACT_SEARCH_MRU_SIZE - 1; i > 0; --i) {
+			mru->bodies[i] = mru->bodies[i - 1];
+		}
+		mru->bodies[0] = exceptionTable;
+	}
+	return exceptionTable;
+}
+#endif /* J9JIT_ARTIFACT_SEARCH_CACHE_ENABLE */
+
 J9JITExceptionTable * jitGetExceptionTableFromPC(J9VMThread * vmThread, UDATA jitPC)
 {
 	UDATA maskedPC = (UDATA)MASK_PC(jitPC);
@@ -1487,14 +1540,15 @@ J9JITExceptionTable * jitGetExceptionTableFromPC(J9VMThread * vmThread, UDATA ji
 	J9JITExceptionTable *exceptionTable = NULL;
 	TR_jit_artifact_search_cache *artifactSearchCache = vmThread->jitArtifactSearchCache;
 	TR_jit_artifact_search_cache *cacheEntry = NULL;
+	TR_jit_artifact_search_mru *mru = NULL;
 	if (NULL == artifactSearchCache) {
 		TR_jit_artifact_search_cache *existingCache = NULL;
 		PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
-		artifactSearchCache = j9mem_allocate_memory(JIT_ARTIFACT_SEARCH_CACHE_SIZE * sizeof (TR_jit_artifact_search_cache), OMRMEM_CATEGORY_JIT);
+		artifactSearchCache = j9mem_allocate_memory(JIT_ARTIFACT_SEARCH_CACHE_ALLOCATION_SIZE, OMRMEM_CATEGORY_JIT);
 		if (NULL == artifactSearchCache) {
 			return jit_artifact_search(vmThread->javaVM->jitConfig->translationArtifacts, maskedPC);
 		}
-		memset(artifactSearchCache, 0, JIT_ARTIFACT_SEARCH_CACHE_SIZE * sizeof(TR_jit_artifact_search_cache));
+		memset(artifactSearchCache, 0, JIT_ARTIFACT_SEARCH_CACHE_ALLOCATION_SIZE);
 		/* The vmThread parameter to this function may not be the current thread, so ensure that only a single
 		 * instance of the cache is allocated for the thread, and make sure the empty cache entries for a new
 		 * cache are visible to other threads before the cache pointer is visible.
@@ -1506,22 +1560,19 @@ J9JITExceptionTable * jitGetExceptionTableFromPC(J9VMThread * vmThread, UDATA ji
 			artifactSearchCache = existingCache;
 		}
 	}
+	mru = (TR_jit_artifact_search_mru *)(artifactSearchCache + JIT_ARTIFACT_SEARCH_CACHE_SIZE);
 	cacheEntry = &(artifactSearchCache[JIT_ARTIFACT_SEARCH_CACHE_HASH_RESULT(maskedPC)]);
 	if (cacheEntry->searchValue == maskedPC) {
 		exceptionTable = cacheEntry->exceptionTable;
 		/* The cache is not thread-safe - it's possible to view an inconsistent pc/metadata pair from one
 		 * thread while another thread is updating the cache entry. To counteract this, verify that the
-		 * found metadata is valid for the input PC. If not, ignore the cache and go to the underlying
-		 * hash table.
+		 * found metadata is valid for the input PC. If not, ignore the cache and search the recent bodies.
 		 */
-		if ((NULL == exceptionTable)
-		|| !(((maskedPC >= exceptionTable->startPC) && (maskedPC < exceptionTable->endWarmPC))
-			|| ((0 != exceptionTable->startColdPC) && (maskedPC >= exceptionTable->startColdPC) && (maskedPC < exceptionTable->endPC)))
-		) {
-			exceptionTable = jit_artifact_search(vmThread->javaVM->jitConfig->translationArtifacts, maskedPC);
+		if ((NULL == exceptionTable) || !JIT_ARTIFACT_CONTAINS_PC(exceptionTable, maskedPC)) {
+			exceptionTable = jitSearchRecentArtifacts(vmThread, mru, maskedPC);
 		}
  	} else {
-		exceptionTable = jit_artifact_search(vmThread->javaVM->jitConfig->translationArtifacts, maskedPC);
+		exceptionTable = jitSearchRecentArtifacts(vmThread, mru, maskedPC);
 		if (NULL != exceptionTable) {
 			cacheEntry->searchValue = maskedPC;
 			cacheEntry->exceptionTable = exceptionTable;
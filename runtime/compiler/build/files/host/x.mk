@@ -31,4 +31,10 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/x/runtime/X86PicBuilder.nasm \
     compiler/x/runtime/X86Unresolveds.nasm
 
+ifeq ($(OS),linux)
+    JIT_PRODUCT_SOURCE_FILES+=\
+        compiler/x/runtime/X86HWProfiler.cpp \
+        compiler/x/runtime/X86HWProfilerLinux.cpp
+endif
+
 include $(JIT_MAKE_DIR)/files/host/$(HOST_SUBARCH).mk
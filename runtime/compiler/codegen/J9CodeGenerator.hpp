@@ -468,6 +468,16 @@ public:
    */
    void setSupportsInlineConcurrentLinkedQueue() { _j9Flags.set(SupportsInlineConcurrentLinkedQueue); }
 
+   /** \brief
+   *    Determines whether the code generator can evaluate arraycmp nodes with the arrayCmpLen flag set
+   */
+   bool getSupportsArrayCmpLen() { return _j9Flags.testAny(SupportsArrayCmpLen); }
+
+   /** \brief
+   *    The code generator can evaluate arraycmp nodes with the arrayCmpLen flag set
+   */
+   void setSupportsArrayCmpLen() { _j9Flags.set(SupportsArrayCmpLen); }
+
    /**
     * \brief
     *    The number of nodes between a monext and the next monent before
@@ -533,6 +543,7 @@ private:
       SupportsInlineStringHashCode                        = 0x00000010, /*! codegen inlining of Java string hash code */
       SupportsInlineConcurrentLinkedQueue                 = 0x00000020,
       SupportsBigDecimalLongLookasideVersioning           = 0x00000040, 
+      SupportsArrayCmpLen                                 = 0x00000080, /*! codegen evaluation of arraycmplen */
       };
 
    flags32_t _j9Flags;
@@ -1117,6 +1117,7 @@
    java_util_Arrays_copyOfRange_boolean,
    java_util_Arrays_copyOfRange_Object1,
    java_util_Arrays_copyOfRange_Object2,
+   jdk_internal_util_ArraysSupport_vectorizedMismatch,
 
    sun_nio_ch_NativeThread_current,
 
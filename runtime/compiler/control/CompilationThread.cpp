@@ -54,6 +54,7 @@
 #include "control/OptimizationPlan.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/IO.hpp"
+#include "env/PersistentCHTable.hpp"
 #include "env/PersistentInfo.hpp"
 #include "env/StackMemoryRegion.hpp"
 #include "env/jittypes.h"
@@ -3188,6 +3189,16 @@ void TR::CompilationInfo::stopCompilationThreads()
 
    TR_DataCacheManager::getManager()->printStatistics();
 
+   if (TR::Options::getHotCodeCacheLevel() > 0 && TR::Options::getVerboseOption(TR_VerbosePerformance))
+      TR::CodeCacheManager::instance()->printHotCodeFootprint();
+
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      if (getPersistentInfo()->getPersistentCHTable())
+         getPersistentInfo()->getPersistentCHTable()->printStatistics();
+      getPersistentInfo()->getRuntimeAssumptionTable()->printPatchStatistics();
+      }
+
    bool aotStatsEnabled = TR::Options::getAOTCmdLineOptions()->getOption(TR_EnableAOTStats);
    if (aotStatsEnabled)
       {
@@ -3316,6 +3327,19 @@ void TR::CompilationInfo::stopCompilationThreads()
          }
       fprintf(stderr, "-------------------------\n");
 
+      fprintf(stderr, "RELO APPLIED/IGNORED/TIME(usec) BY TYPE ------\n");
+      PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+      for (uint32_t i = 0; i < TR_NumExternalRelocationKinds; i++)
+         {
+         if (aotStats->numRelocationsAppliedByType[i] == 0 && aotStats->numRelocationsIgnoredByType[i] == 0)
+            continue;
+         fprintf(stderr, "%s: %u %u %llu\n", TR::ExternalRelocation::getName((TR_ExternalRelocationTargetKind)i),
+                 aotStats->numRelocationsAppliedByType[i],
+                 aotStats->numRelocationsIgnoredByType[i],
+                 (unsigned long long)j9time_hires_delta(0, aotStats->relocationTimeByType[i], J9PORT_TIME_DELTA_IN_MICROSECONDS));
+         }
+      fprintf(stderr, "-------------------------\n");
+
       } // AOT stats
 
 
@@ -6544,6 +6568,10 @@ TR::CompilationInfoPerThreadBase::installAotCachedMethod(
          if (TR::Options::getVerboseOption(TR_VerbosePerformance))
             {
             TR_VerboseLog::write(" time=%dus", (uint32_t)reloTime);
+            TR_VerboseLog::write(" relos=%u ignoredRelos=%u reloTime=%uus",
+                                 reloRuntime()->getNumRecordsApplied(),
+                                 reloRuntime()->getNumRecordsIgnored(),
+                                 (uint32_t)reloRuntime()->recordsApplyTime());
             }
          if (entry)
             TR_VerboseLog::write(" compThread=%d", getCompThreadId());
@@ -9088,6 +9116,14 @@ TR::CompilationInfoPerThreadBase::compile(
 
          setMetadata(metaData);
 
+         if (TR::Options::getHotCodeCacheLevel() > 0 &&
+             compiler->getMethodHotness() >= TR::Options::getHotCodeCacheLevel())
+            {
+            TR::CodeCacheManager::instance()->recordHotBody(compiler->cg()->getCodeCache(),
+                                                            reinterpret_cast<uint8_t *>(metaData->startPC),
+                                                            reinterpret_cast<uint8_t *>(metaData->endWarmPC));
+            }
+
          // Put a metaData pointer into the Code Cache Header(s).
          //
          uint8_t *warmMethodHeader = compiler->cg()->getBinaryBufferStart() - sizeof(OMR::CodeCacheMethodHeader);
@@ -1237,7 +1237,7 @@ static void processHWPBuffer(J9VMThread *vmThread, TR_J9VMBase *vm)
 
    if (hwProfiler->isExpired())
       {
-      if (IS_THREAD_RI_INITIALIZED(vmThread))
+      if (hwProfiler->isThreadInitialized(vmThread))
          {
          if (TR::Options::isAnyVerboseOptionSet(TR_VerboseHWProfiler))
             {
@@ -1251,7 +1251,7 @@ static void processHWPBuffer(J9VMThread *vmThread, TR_J9VMBase *vm)
       {
       bool threadInitialized = false;
       // HW Available, but thread not initialized.
-      if (!IS_THREAD_RI_INITIALIZED(vmThread))
+      if (!hwProfiler->isThreadInitialized(vmThread))
          threadInitialized = hwProfiler->initializeThread(vmThread);
       else
          threadInitialized = true;
@@ -1279,6 +1279,12 @@ static void processHWPBuffer(J9VMThread *vmThread, TR_J9VMBase *vm)
                   TR_VerboseLog::writeLineLocked(TR_Vlog_HWPROFILER, "RI is enabled for vmThread 0x%p", vmThread);
                }
             }
+#else
+         else
+            {
+            // Without RI the profiler samples continuously; just drain what it collected
+            tryAndProcessBuffers(vmThread, vm, hwProfiler);
+            }
 #endif
          }
       }
@@ -2444,7 +2450,7 @@ static void jitHookThreadDestroy(J9HookInterface * * hookInterface, UDATA eventN
    TR_HWProfiler *hwProfiler = compInfo->getHWProfiler();
    if (compInfo->getPersistentInfo()->isRuntimeInstrumentationEnabled() && hwProfiler->isHWProfilingAvailable(vmThread))
       {
-      if (IS_THREAD_RI_INITIALIZED(vmThread))
+      if (hwProfiler->isThreadInitialized(vmThread))
          hwProfiler->deinitializeThread(vmThread);
       }
 
@@ -3602,6 +3608,12 @@ static bool updateCHTable(J9VMThread * vmThread, J9Class  * cl)
    int32_t classDepth = J9CLASS_DEPTH(cl) - 1;
    if (classDepth >= 0)
       {
+      // Hand the superclass and the interfaces to the CHTable in batches so
+      // that it can update the hierarchy under a single pass
+      static const int32_t SUPERCLASS_BATCH_SIZE = 32;
+      TR_OpaqueClassBlock *superClazzes[SUPERCLASS_BATCH_SIZE];
+      int32_t numSuperClazzes = 0;
+
       J9Class * superCl = cl->superclasses[classDepth];
       superCl->classDepthAndFlags |= J9AccClassHasBeenOverridden;
 
@@ -3611,11 +3623,7 @@ static bool updateCHTable(J9VMThread * vmThread, J9Class  * cl)
          name = vm->getClassNameChars(superClazz, len);
          TR_VerboseLog::writeLineLocked(TR_Vlog_HD, "\textending %.*s\n", len, name);
          }
-      if (table)
-         {
-         if (!table->classGotExtended(vm, compInfo->persistentMemory(), superClazz, clazz))
-            updateFailed = true;
-         }
+      superClazzes[numSuperClazzes++] = superClazz;
       for (J9ITable * iTableEntry = (J9ITable *)cl->iTable; iTableEntry; iTableEntry = iTableEntry->next)
          {
          superCl = iTableEntry->interfaceClass;
@@ -3628,13 +3636,17 @@ static bool updateCHTable(J9VMThread * vmThread, J9Class  * cl)
                name = vm->getClassNameChars(superClazz, len);
                TR_VerboseLog::writeLineLocked(TR_Vlog_HD, "\textending interface %.*s\n", len, name);
                }
-            if (table)
+            if (numSuperClazzes == SUPERCLASS_BATCH_SIZE)
                {
-               if (!table->classGotExtended(vm, compInfo->persistentMemory(), superClazz, clazz))
+               if (table && !table->superClassesGotExtended(vm, compInfo->persistentMemory(), superClazzes, numSuperClazzes, clazz))
                   updateFailed = true;
+               numSuperClazzes = 0;
                }
+            superClazzes[numSuperClazzes++] = superClazz;
             }
          }
+      if (table && !table->superClassesGotExtended(vm, compInfo->persistentMemory(), superClazzes, numSuperClazzes, clazz))
+         updateFailed = true;
       }
    }
    // method override
@@ -240,6 +240,7 @@ int32_t J9::Options::_seriousCompFailureThreshold = 10; // above this threshold
 
 bool J9::Options::_useCPUsToDetermineMaxNumberOfCompThreadsToActivate = false;
 int32_t J9::Options::_numCodeCachesToCreateAtStartup = 0; // 0 means no change from default which is 1
+int32_t J9::Options::_hotCodeCacheLevel = 0; // 0 means hot bodies are not segregated
 
 int32_t J9::Options::_dataCacheQuantumSize = 64;
 int32_t J9::Options::_dataCacheMinQuanta = 2;
@@ -763,6 +764,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"gcTrace=",           "D<nnn>\ttrace gc stack walks after gc number nnn",
         TR::Options::setJitConfigNumericValue, offsetof(J9JITConfig, gcTraceThreshold), 0, "F%d"},
 #endif
+   {"hotCodeCacheLevel=", "R<nnn>\tplace bodies compiled at this hotness level or above (3=hot, 4=veryHot, 5=scorching) "
+                          "in a dedicated hot code cache; 0 disables",
+        TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_hotCodeCacheLevel, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerAOTWarmOptLevelThreshold=", "O<nnn>\tAOT Warm Opt Level Threshold",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_hwprofilerAOTWarmOptLevelThreshold, 0, "F%d", NOT_IN_SUBSET},
    {"HWProfilerBufferMaxPercentageToDiscard=", "O<nnn>\tpercentage of HW profiling buffers "
@@ -203,6 +203,9 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _numCodeCachesToCreateAtStartup;
    static int32_t getNumCodeCachesToCreateAtStartup() { return _numCodeCachesToCreateAtStartup; }
 
+   static int32_t _hotCodeCacheLevel; // 0 means hot bodies are not segregated
+   static int32_t getHotCodeCacheLevel() { return _hotCodeCacheLevel; }
+
    static int32_t _dataCacheQuantumSize;
    static int32_t _dataCacheMinQuanta;
    static int32_t getDataCacheQuantumSize() { return _dataCacheQuantumSize; }
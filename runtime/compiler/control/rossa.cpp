@@ -76,6 +76,8 @@
 #elif defined(TR_HOST_POWER)
 #include "p/runtime/PPCHWProfiler.hpp"
 #include "p/runtime/PPCLMGuardedStorage.hpp"
+#elif defined(TR_HOST_X86) && defined(LINUX)
+#include "x/runtime/X86HWProfiler.hpp"
 #endif
 
 #include "control/rossa.h"
@@ -1589,6 +1591,11 @@ onLoadInternal(
 #else
       ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->hwProfiler = NULL;
 #endif /* !defined(J9OS_I5) */
+#elif defined(TR_HOST_X86) && defined(LINUX)
+      ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->hwProfiler = TR_X86HWProfiler::allocate(jitConfig);
+      // Sampling state is kept per thread by the profiler itself; there is no VM side RI support to initialize
+      if (NULL != ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->hwProfiler)
+         riInitializeFailed = 0;
 #endif
 
       //Initialize VM support for RI.
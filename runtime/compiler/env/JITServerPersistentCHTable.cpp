@@ -439,11 +439,11 @@ JITClientPersistentCHTable::classGotLoaded(
       TR_OpaqueClassBlock *classId)
    {
    TR_ASSERT(!findClassInfo(classId), "Should not add duplicates to hash table\n");
+   UpdateTimer timer(this, fe, ClassLoadUpdate);
    TR_PersistentClassInfo *clazz = new (PERSISTENT_NEW) TR_JITClientPersistentClassInfo(classId, this);
    if (clazz)
       {
-      auto classes = getClasses();
-      classes[TR_RuntimeAssumptionTable::hashCode((uintptrj_t) classId) % CLASSHASHTABLE_SIZE].add(clazz);
+      addClassInfo(clazz);
       }
    return clazz;
    }
@@ -468,6 +468,17 @@ JITClientPersistentCHTable::classGotExtended(
    return TR_PersistentCHTable::classGotExtended(fe, persistentMemory, superClassId, subClassId);
    }
 
+bool
+JITClientPersistentCHTable::superClassesGotExtended(
+      TR_FrontEnd *fe,
+      TR_PersistentMemory *persistentMemory,
+      TR_OpaqueClassBlock **superClassIds,
+      int32_t numSuperClasses,
+      TR_OpaqueClassBlock *subClassId)
+   {
+   return TR_PersistentCHTable::superClassesGotExtended(fe, persistentMemory, superClassIds, numSuperClasses, subClassId);
+   }
+
 
 // these two tables should be mutually exclusive - we only keep the most recent entry.
 void 
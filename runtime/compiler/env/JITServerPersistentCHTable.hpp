@@ -111,6 +111,7 @@ public:
    virtual void classGotUnloadedPost(TR_FrontEnd *fe, TR_OpaqueClassBlock *classId) override;
    virtual void removeClass(TR_FrontEnd *, TR_OpaqueClassBlock *classId, TR_PersistentClassInfo *info, bool removeInfo) override;
    virtual bool classGotExtended(TR_FrontEnd *vm, TR_PersistentMemory *, TR_OpaqueClassBlock *superClassId, TR_OpaqueClassBlock *subClassId) override;
+   virtual bool superClassesGotExtended(TR_FrontEnd *vm, TR_PersistentMemory *, TR_OpaqueClassBlock **superClassIds, int32_t numSuperClasses, TR_OpaqueClassBlock *subClassId) override;
 
   
    void markForRemoval(TR_OpaqueClassBlock *clazz);
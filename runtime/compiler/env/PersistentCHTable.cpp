@@ -25,6 +25,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include "AtomicSupport.hpp"
 #include "codegen/FrontEnd.hpp"
 #include "compile/Compilation.hpp"
 #include "compile/CompilationTypes.hpp"
@@ -40,6 +41,7 @@
 #include "env/jittypes.h"
 #include "env/ClassTableCriticalSection.hpp"
 #include "env/VMJ9.h"
+#include "env/VerboseLog.hpp"
 #include "il/DataTypes.hpp"
 #include "il/ResolvedMethodSymbol.hpp"
 #include "il/SymbolReference.hpp"
@@ -51,7 +53,10 @@
 class TR_OpaqueClassBlock;
 
 TR_PersistentCHTable::TR_PersistentCHTable(TR_PersistentMemory *trPersistentMemory)
-   : _trPersistentMemory(trPersistentMemory)
+   : _trPersistentMemory(trPersistentMemory),
+     _updateCount(0),
+     _numLockFreeLookups(0),
+     _numLockFreeRetries(0)
    {
    /*
     * We want to avoid strange memory allocation failures that might occur in a
@@ -64,6 +69,8 @@ TR_PersistentCHTable::TR_PersistentCHTable(TR_PersistentMemory *trPersistentMemo
 
    memset(_buffer, 0, sizeof(TR_LinkHead<TR_PersistentClassInfo>) * (CLASSHASHTABLE_SIZE + 1));
    _classes = static_cast<TR_LinkHead<TR_PersistentClassInfo> *>(static_cast<void *>(_buffer));
+   memset(_numUpdates, 0, sizeof(_numUpdates));
+   memset(_updateTime, 0, sizeof(_updateTime));
    }
 
 
@@ -322,10 +329,140 @@ TR_PersistentCHTable::findClassInfoAfterLocking(TR_OpaqueClassBlock *classId,
    if (comp->getOption(TR_DisableCHOpts))
       return NULL;
 
-   TR_PersistentClassInfo *classInfo = findClassInfoAfterLocking(classId, comp->fe(), returnClassInfoForAOT);
+   TR_PersistentClassInfo *classInfo;
+   if (findClassInfoWithoutLocking(classId, classInfo))
+      return classInfo;
+
+   classInfo = findClassInfoAfterLocking(classId, comp->fe(), returnClassInfoForAOT);
    return classInfo;
    }
 
+/**
+ * Find persistent JIT class information for a given class without taking
+ * the class table lock. Returns false if the walk raced with a change to
+ * the hash chains, in which case the caller must repeat the lookup under
+ * the lock.
+ *
+ * Only compilation threads use this path: they hold the class unload
+ * monitor, so no class info can be freed by unloading underneath them.
+ * Nodes unlinked by redefinition or by a failed class load are detected
+ * through the update count before their next pointer is followed, and
+ * freed persistent memory stays mapped, so a stale read is harmless.
+ */
+bool
+TR_PersistentCHTable::findClassInfoWithoutLocking(
+      TR_OpaqueClassBlock *classId,
+      TR_PersistentClassInfo *&classInfo)
+   {
+   uintptrj_t count = _updateCount;
+   VM_AtomicSupport::readBarrier();
+   if (count & 1)
+      {
+      _numLockFreeRetries++;
+      return false;
+      }
+
+   TR_PersistentClassInfo *cl = _classes[TR_RuntimeAssumptionTable::hashCode((uintptrj_t)classId) % CLASSHASHTABLE_SIZE].getFirst();
+   while (true)
+      {
+      VM_AtomicSupport::readBarrier();
+      if (_updateCount != count)
+         {
+         _numLockFreeRetries++;
+         return false;
+         }
+      if (!cl)
+         break;
+
+      TR_OpaqueClassBlock *clId = cl->getClassId();
+      TR_PersistentClassInfo *next = cl->getNext();
+      if (clId == classId)
+         {
+         VM_AtomicSupport::readBarrier();
+         if (_updateCount != count)
+            {
+            _numLockFreeRetries++;
+            return false;
+            }
+         break;
+         }
+      cl = next;
+      }
+
+   _numLockFreeLookups++;
+   classInfo = cl;
+   return true;
+   }
+
+void
+TR_PersistentCHTable::beginUpdate()
+   {
+   _updateCount = _updateCount + 1;
+   VM_AtomicSupport::writeBarrier();
+   }
+
+void
+TR_PersistentCHTable::endUpdate()
+   {
+   VM_AtomicSupport::writeBarrier();
+   _updateCount = _updateCount + 1;
+   }
+
+/**
+ * Publish a new class info at the head of its hash chain. The next pointer
+ * is written before the head so that lock-free readers never observe a
+ * partially linked node.
+ */
+void
+TR_PersistentCHTable::addClassInfo(TR_PersistentClassInfo *clazz)
+   {
+   TR_LinkHead<TR_PersistentClassInfo> &chain = _classes[TR_RuntimeAssumptionTable::hashCode((uintptrj_t) clazz->getClassId()) % CLASSHASHTABLE_SIZE];
+   beginUpdate();
+   clazz->setNext(chain.getFirst());
+   VM_AtomicSupport::writeBarrier();
+   chain.setFirst(clazz);
+   endUpdate();
+   }
+
+TR_PersistentCHTable::UpdateTimer::UpdateTimer(TR_PersistentCHTable *table, TR_FrontEnd *fe, UpdateKind kind)
+   : _table(table),
+     _fe(fe),
+     _kind(kind),
+     _startTime(0)
+   {
+   _table->_numUpdates[_kind]++;
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      PORT_ACCESS_FROM_JITCONFIG(((TR_J9VMBase *)_fe)->getJ9JITConfig());
+      _startTime = j9time_usec_clock();
+      }
+   }
+
+TR_PersistentCHTable::UpdateTimer::~UpdateTimer()
+   {
+   if (_startTime)
+      {
+      PORT_ACCESS_FROM_JITCONFIG(((TR_J9VMBase *)_fe)->getJ9JITConfig());
+      _table->_updateTime[_kind] += j9time_usec_clock() - _startTime;
+      }
+   }
+
+void
+TR_PersistentCHTable::printStatistics()
+   {
+   static const char *updateNames[NumUpdateKinds] = { "load", "extend", "unload", "redefine" };
+
+   TR_VerboseLog::vlogAcquire();
+   TR_VerboseLog::writeLine(TR_Vlog_INFO, "CHTable lookups: lockFree=%u retriedUnderLock=%u",
+      _numLockFreeLookups, _numLockFreeRetries);
+   for (int32_t i = 0; i < NumUpdateKinds; i++)
+      {
+      TR_VerboseLog::writeLine(TR_Vlog_INFO, "CHTable class %s updates: count=%u time=%llu usec",
+         updateNames[i], _numUpdates[i], (unsigned long long)_updateTime[i]);
+      }
+   TR_VerboseLog::vlogRelease();
+   }
+
 /**
  * Find persistent JIT class information for a given class.
  * The class table lock is used to synchronize use of this method
@@ -706,10 +843,11 @@ TR_PersistentCHTable::classGotLoaded(
       TR_OpaqueClassBlock *classId)
    {
    TR_ASSERT(!findClassInfo(classId), "Should not add duplicates to hash table\n");
+   UpdateTimer timer(this, fe, ClassLoadUpdate);
    TR_PersistentClassInfo *clazz = new (PERSISTENT_NEW) TR_PersistentClassInfo(classId);
    if (clazz)
       {
-      _classes[TR_RuntimeAssumptionTable::hashCode((uintptrj_t) classId) % CLASSHASHTABLE_SIZE].add(clazz);
+      addClassInfo(clazz);
       }
    return clazz;
    }
@@ -78,6 +78,7 @@ class TR_PersistentCHTable
    virtual TR_PersistentClassInfo *classGotLoaded(TR_FrontEnd *, TR_OpaqueClassBlock *classId);
    virtual bool classGotInitialized(TR_FrontEnd* vm, TR_PersistentMemory *, TR_OpaqueClassBlock *classId, TR_PersistentClassInfo *clazz = 0);
    virtual bool classGotExtended(TR_FrontEnd *vm, TR_PersistentMemory *, TR_OpaqueClassBlock *superClassId, TR_OpaqueClassBlock *subClassId);
+   virtual bool superClassesGotExtended(TR_FrontEnd *vm, TR_PersistentMemory *, TR_OpaqueClassBlock **superClassIds, int32_t numSuperClasses, TR_OpaqueClassBlock *subClassId);
    virtual void classGotUnloaded(TR_FrontEnd *vm, TR_OpaqueClassBlock *classId);
    virtual void classGotUnloadedPost(TR_FrontEnd *fe, TR_OpaqueClassBlock *classId);
    virtual void classGotRedefined(TR_FrontEnd *vm, TR_OpaqueClassBlock *oldClassId, TR_OpaqueClassBlock *newClassId);
@@ -87,12 +88,57 @@ class TR_PersistentCHTable
 #ifdef DEBUG
    void dumpStats(TR_FrontEnd *);
 #endif
+   void printStatistics();
 
    protected:
    void removeAssumptionFromRAT(OMR::RuntimeAssumption *assumption);
    TR_LinkHead<TR_PersistentClassInfo> *getClasses() { return _classes; }
+   void addClassInfo(TR_PersistentClassInfo *clazz);
+
+   enum UpdateKind
+      {
+      ClassLoadUpdate,
+      ClassExtendUpdate,
+      ClassUnloadUpdate,
+      ClassRedefineUpdate,
+      NumUpdateKinds
+      };
+
+   /**
+    * Accumulates the time spent in a class hierarchy update hook when
+    * -Xjit:verbose={performance} is in effect.
+    */
+   class UpdateTimer
+      {
+      public:
+      UpdateTimer(TR_PersistentCHTable *table, TR_FrontEnd *fe, UpdateKind kind);
+      ~UpdateTimer();
+
+      private:
+      TR_PersistentCHTable *_table;
+      TR_FrontEnd *_fe;
+      UpdateKind _kind;
+      uint64_t _startTime;
+      };
+
+   /**
+    * Writers bracket any change to the hash chains with beginUpdate() and
+    * endUpdate(). The update count is odd while a change is in progress,
+    * which lets findClassInfoWithoutLocking() detect that its walk raced
+    * with a writer and retry under the class table lock.
+    */
+   void beginUpdate();
+   void endUpdate();
 
    private:
+   bool findClassInfoWithoutLocking(TR_OpaqueClassBlock *classId, TR_PersistentClassInfo *&classInfo);
+
+   volatile uintptrj_t _updateCount;
+   uint32_t _numLockFreeLookups;
+   uint32_t _numLockFreeRetries;
+   uint32_t _numUpdates[NumUpdateKinds];
+   uint64_t _updateTime[NumUpdateKinds];
+
    uint8_t _buffer[sizeof(TR_LinkHead<TR_PersistentClassInfo>) * (CLASSHASHTABLE_SIZE + 1)];
    TR_LinkHead<TR_PersistentClassInfo> *_classes;
    TR_PersistentMemory *_trPersistentMemory;
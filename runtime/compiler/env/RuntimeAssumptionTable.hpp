@@ -111,6 +111,15 @@ class TR_RuntimeAssumptionTable
    void incReclaimedAssumptionCount(int32_t tableId) { reclaimedAssumptionCount[tableId]++; }
    void markForDetachFromRAT(OMR::RuntimeAssumption *assumption);
 
+   /**
+    * Compensate and mark for detach all the assumptions invalidated by a
+    * single event, such as a class load. The patches are applied in code
+    * address order so that sites in the same code cache page are modified
+    * together. The caller must hold the assumption table mutex.
+    */
+   void compensateBatch(TR_FrontEnd *fe, OMR::RuntimeAssumption **assumptions, int32_t count);
+   void printPatchStatistics();
+
    void markAssumptionsAndDetach(void *reclaimedMetaData, bool reclaimPrePrologueAssumptions = false);
 
    /**
@@ -135,6 +144,13 @@ class TR_RuntimeAssumptionTable
    uint32_t _marked;                            // Counts the number of assumptions waiting to be removed
    int32_t assumptionCount[LastAssumptionKind]; // this never gets decremented
    int32_t reclaimedAssumptionCount[LastAssumptionKind];
+   uint32_t _numPatchBatches;                   // Number of events that invalidated at least one assumption
+   uint32_t _numBatchedPatches;
+   uint32_t _numBatchedPages;                   // Distinct code pages touched, summed over all batches
+   uint32_t _maxPatchesPerBatch;
    };
 
+// Number of assumptions collected before a batch is compensated
+#define RAT_PATCH_BATCH_SIZE 64
+
 #endif // RUNTIMEASSUMPTIONTABLE_HPP
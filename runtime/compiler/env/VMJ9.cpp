@@ -728,6 +728,7 @@ TR_J9VMBase::TR_J9VMBase(
      _compInfo(compInfo),
      _iProfiler(0),
      _hwProfilerShouldNotProcessBuffers(TR::Options::_hwProfilerRIBufferProcessingFrequency),
+     _hwProfilerContext(NULL),
      _bufferStart(NULL),
      _vmThreadIsCompilationThread(TR_maybe),
      _compInfoPT(NULL),
@@ -2892,13 +2893,10 @@ bool TR_J9VMBase::supressInliningRecognizedInitialCallee(TR_CallSite* callsite,
                }
             break;
          case TR::java_lang_String_hashCodeImplDecompressed:
+         case TR::java_lang_String_hashCodeImplCompressed:
             /*
-             * X86 and z want to avoid inlining both java_lang_String_hashCodeImplDecompressed and java_lang_String_hashCodeImplCompressed
-             * so they can be recognized and replaced with a custom fast implementation.
-             * Power currently only has the custom fast implementation for java_lang_String_hashCodeImplDecompressed.
-             * As a result, Power only wants to prevent inlining of java_lang_String_hashCodeImplDecompressed.
-             * When Power gets a fast implementation of TR::java_lang_String_hashCodeImplCompressed, this case can be merged into the case
-             * for java_lang_String_hashCodeImplCompressed instead of using a fallthrough.
+             * Power recognizes and replaces both variants with a custom fast implementation without
+             * reporting getSupportsInlineStringHashCode(), so check its conditions here.
              */
             if (!TR::Compiler->om.canGenerateArraylets() &&
                 TR::Compiler->target.cpu.isPower() && TR::Compiler->target.cpu.id() >= TR_PPCp8 && getPPCSupportsVSXRegisters() && !comp->compileRelocatableCode())
@@ -2906,13 +2904,18 @@ bool TR_J9VMBase::supressInliningRecognizedInitialCallee(TR_CallSite* callsite,
                   dontInlineRecognizedMethod = true;
                   break;
                   }
-            // Intentional fallthrough here.
-         case TR::java_lang_String_hashCodeImplCompressed:
             if (comp->cg()->getSupportsInlineStringHashCode())
                {
                dontInlineRecognizedMethod = true;
                }
             break;
+         case TR::jdk_internal_util_ArraysSupport_vectorizedMismatch:
+            // Left as a call for the recognized call transformer to replace with arraycmplen
+            if (comp->cg()->getSupportsArrayCmp() && comp->cg()->getSupportsArrayCmpLen() && !TR::Compiler->om.canGenerateArraylets())
+               {
+               dontInlineRecognizedMethod = true;
+               }
+            break;
          default:
             break;
          }
@@ -5281,10 +5284,16 @@ TR_J9VMBase::getDesignatedCodeCache(TR::Compilation *comp) // MCT
    int32_t numReserved;
    int32_t compThreadID = comp ? comp->getCompThreadID() : -1;
 
+   // Bodies compiled at a high hotness level, which the sampling thread has
+   // found to be hot, are kept together in a hot code cache
+   bool hotCode = comp &&
+                  TR::Options::getHotCodeCacheLevel() > 0 &&
+                  comp->getMethodHotness() >= TR::Options::getHotCodeCacheLevel();
+
    bool hadClassUnloadMonitor;
    bool hadVMAccess = releaseClassUnloadMonitorAndAcquireVMaccessIfNeeded(comp, &hadClassUnloadMonitor);
 
-   TR::CodeCache * result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved);
+   TR::CodeCache * result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved, hotCode);
 
    acquireClassUnloadMonitorAndReleaseVMAccessIfNeeded(comp, hadVMAccess, hadClassUnloadMonitor);
    if (!result)
@@ -957,6 +957,7 @@ public:
    TR::CompilationInfo *    _compInfo; // storing _compInfo in multiple places could spell trouble when we free the structure
    TR_IProfiler  *         _iProfiler;
    int32_t                 _hwProfilerShouldNotProcessBuffers;
+   void *                  _hwProfilerContext; // per-thread sampling state for profilers that do not use RI parameters
    uint8_t*                _bufferStart;
 
    // To minimize the overhead of testing if vmThread is the compilation thread (which may be
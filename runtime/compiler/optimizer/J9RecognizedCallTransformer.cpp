@@ -104,6 +104,55 @@ void J9::RecognizedCallTransformer::process_java_lang_StringUTF16_toBytes(TR::Tr
    treetop->insertAfter(TR::TreeTop::create(comp(), TR::Node::create(node, TR::treetop, 1, newCallNode)));
    }
 
+void J9::RecognizedCallTransformer::process_jdk_internal_util_ArraysSupport_vectorizedMismatch(TR::TreeTop* treetop, TR::Node* node)
+   {
+   TR::Node* aNode = node->getChild(0);
+   TR::Node* aOffsetNode = node->getChild(1);
+   TR::Node* bNode = node->getChild(2);
+   TR::Node* bOffsetNode = node->getChild(3);
+   TR::Node* lengthNode = node->getChild(4);
+   TR::Node* log2ScaleNode = node->getChild(5);
+
+   anchorAllChildren(node, treetop);
+   prepareToReplaceNode(node);
+
+   bool is64Bit = TR::Compiler->target.is64Bit();
+   TR::Node* aAddress = is64Bit ? TR::Node::create(TR::aladd, 2, aNode, aOffsetNode) :
+                                  TR::Node::create(TR::aiadd, 2, aNode, TR::Node::create(TR::l2i, 1, aOffsetNode));
+   TR::Node* bAddress = is64Bit ? TR::Node::create(TR::aladd, 2, bNode, bOffsetNode) :
+                                  TR::Node::create(TR::aiadd, 2, bNode, TR::Node::create(TR::l2i, 1, bOffsetNode));
+   // The length of a long[] or double[] in bytes can exceed 2^31 on 64-bit, so it is widened before the shift
+   TR::Node* lengthInBytes = is64Bit ? TR::Node::create(TR::lshl, 2, TR::Node::create(TR::i2l, 1, lengthNode), log2ScaleNode) :
+                                       TR::Node::create(TR::ishl, 2, lengthNode, log2ScaleNode);
+
+   TR::Node* arraycmplen = TR::Node::createWithSymRef(TR::arraycmp, 3, 3,
+      aAddress,
+      bAddress,
+      lengthInBytes,
+      comp()->getSymRefTab()->findOrCreateArrayCmpSymbol());
+   arraycmplen->setArrayCmpLen(true);
+
+   // arraycmplen yields the offset of the first differing byte, or the length when there is none.
+   // A mismatch returns the element index; a match returns -1 (~0), i.e. no tail left for the
+   // caller to compare. Since length >> log2Scale | -1 == -1 this needs no branch.
+   if (is64Bit)
+      {
+      TR::Node* offset = TR::Node::create(TR::iu2l, 1, arraycmplen);
+      TR::Node::recreateWithoutProperties(node, TR::l2i, 1,
+         TR::Node::create(TR::lor, 2,
+            TR::Node::create(TR::lshr, 2, offset, log2ScaleNode),
+            TR::Node::create(TR::lneg, 1, TR::Node::create(TR::i2l, 1, TR::Node::create(TR::lcmpeq, 2, offset, lengthInBytes)))));
+      }
+   else
+      {
+      TR::Node::recreateWithoutProperties(node, TR::ior, 2,
+         TR::Node::create(TR::ishr, 2, arraycmplen, log2ScaleNode),
+         TR::Node::create(TR::ineg, 1, TR::Node::create(TR::icmpeq, 2, arraycmplen, lengthInBytes)));
+      }
+
+   TR::TransformUtil::removeTree(comp(), treetop);
+   }
+
 void J9::RecognizedCallTransformer::process_java_lang_StrictMath_and_Math_sqrt(TR::TreeTop* treetop, TR::Node* node)
    {
    TR::Node* valueNode = node->getLastChild();
@@ -387,6 +436,8 @@ bool J9::RecognizedCallTransformer::isInlineable(TR::TreeTop* treetop)
       case TR::java_lang_StrictMath_sqrt:
       case TR::java_lang_Math_sqrt:
          return TR::Compiler->target.cpu.getSupportsHardwareSQRT();;
+      case TR::jdk_internal_util_ArraysSupport_vectorizedMismatch:
+         return cg()->getSupportsArrayCmp() && cg()->getSupportsArrayCmpLen() && !TR::Compiler->om.canGenerateArraylets();
       default:
          return false;
       }
@@ -467,6 +518,9 @@ void J9::RecognizedCallTransformer::transform(TR::TreeTop* treetop)
       case TR::java_lang_Math_sqrt:
          process_java_lang_StrictMath_and_Math_sqrt(treetop, node);
          break;
+      case TR::jdk_internal_util_ArraysSupport_vectorizedMismatch:
+         process_jdk_internal_util_ArraysSupport_vectorizedMismatch(treetop, node);
+         break;
       default:
          break;
       }
@@ -67,6 +67,7 @@ J9::Power::CodeGenerator::CodeGenerator() :
       }
 
    cg->setSupportsNewInstanceImplOpt();
+   cg->setSupportsArrayCmpLen();
 
    static char *disableMonitorCacheLookup = feGetEnv("TR_disableMonitorCacheLookup");
    if (!disableMonitorCacheLookup)
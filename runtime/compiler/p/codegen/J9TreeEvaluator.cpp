@@ -11357,7 +11357,36 @@ static TR::Register *inlineIsAssignableFrom(TR::Node *node, TR::CodeGenerator *c
    return resultReg;
    }
 
-static TR::Register *inlineStringHashcode(TR::Node *node, TR::CodeGenerator *cg)
+// Fold 8 zero extended halfwords into the two accumulators: acc = acc * 31^8 + element
+static void accumulateStringHashcode(TR::Node *node, TR::CodeGenerator *cg, TR::Register *halfwordsReg, TR::Register *vtmpReg,
+                                     TR::Register *high4Reg, TR::Register *low4Reg, TR::Register *multiplierReg, TR::Register *vunpackMaskReg)
+{
+    generateTrg1Src1Instruction(cg, TR::InstOpCode::vupkhsh, node, vtmpReg, halfwordsReg);
+    generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, vtmpReg, vtmpReg, vunpackMaskReg);
+    generateTrg1Src2Instruction(cg, TR::InstOpCode::vmuluwm, node, high4Reg, high4Reg, multiplierReg);
+    generateTrg1Src2Instruction(cg, TR::InstOpCode::vadduwm, node, high4Reg, high4Reg, vtmpReg);
+    generateTrg1Src1Instruction(cg, TR::InstOpCode::vupklsh, node, vtmpReg, halfwordsReg);
+    generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, vtmpReg, vtmpReg, vunpackMaskReg);
+    generateTrg1Src2Instruction(cg, TR::InstOpCode::vmuluwm, node, low4Reg, low4Reg, multiplierReg);
+    generateTrg1Src2Instruction(cg, TR::InstOpCode::vadduwm, node, low4Reg, low4Reg, vtmpReg);
+}
+
+// Widen the 16 Latin1 bytes in bytesReg to halfwords 8 at a time, in memory order, and fold them into the accumulators
+static void accumulateCompressedStringHashcode(TR::Node *node, TR::CodeGenerator *cg, TR::Register *bytesReg, TR::Register *vtmp2Reg, TR::Register *vtmp3Reg,
+                                               TR::Register *high4Reg, TR::Register *low4Reg, TR::Register *multiplierReg, TR::Register *vunpackMaskReg, TR::Register *vbyteMaskReg)
+{
+    // lvx places the first byte in memory in the last element on little endian
+    bool isLE = TR::Compiler->target.cpu.isLittleEndian();
+
+    generateTrg1Src1Instruction(cg, isLE ? TR::InstOpCode::vupklsb : TR::InstOpCode::vupkhsb, node, vtmp2Reg, bytesReg);
+    generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, vtmp2Reg, vtmp2Reg, vbyteMaskReg);
+    accumulateStringHashcode(node, cg, vtmp2Reg, vtmp3Reg, high4Reg, low4Reg, multiplierReg, vunpackMaskReg);
+    generateTrg1Src1Instruction(cg, isLE ? TR::InstOpCode::vupkhsb : TR::InstOpCode::vupklsb, node, vtmp2Reg, bytesReg);
+    generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, vtmp2Reg, vtmp2Reg, vbyteMaskReg);
+    accumulateStringHashcode(node, cg, vtmp2Reg, vtmp3Reg, high4Reg, low4Reg, multiplierReg, vunpackMaskReg);
+}
+
+static TR::Register *inlineStringHashcode(TR::Node *node, TR::CodeGenerator *cg, bool isCompressed)
 {
     TR::Compilation *comp = cg->comp();
     TR_J9VMBase *fej9 = (TR_J9VMBase *)(comp->fe());
@@ -11384,6 +11413,8 @@ static TR::Register *inlineStringHashcode(TR::Node *node, TR::CodeGenerator *cg)
     TR::Register *vconstant0Reg = cg->allocateRegister(TR_VRF);
     TR::Register *vconstantNegReg = cg->allocateRegister(TR_VRF);
     TR::Register *vunpackMaskReg = cg->allocateRegister(TR_VRF);
+    TR::Register *vbyteMaskReg = isCompressed ? cg->allocateRegister(TR_VRF) : NULL;
+    TR::Register *vtmp3Reg = isCompressed ? cg->allocateRegister(TR_VRF) : NULL;
 
     TR::LabelSymbol *serialLabel = generateLabelSymbol(cg);
     TR::LabelSymbol *VSXLabel = generateLabelSymbol(cg);
@@ -11391,21 +11422,23 @@ static TR::Register *inlineStringHashcode(TR::Node *node, TR::CodeGenerator *cg)
     TR::LabelSymbol *endLabel = generateLabelSymbol(cg);
 
     // Skip header of the array
-    // v = v + offset<<1
-    // end = v + count<<1
+    // v = v + offset<<1 (offset for compressed strings)
+    // end = v + count<<1 (count for compressed strings)
     // hash = 0
     // temp = 0
     intptrj_t hdrSize = TR::Compiler->om.contiguousArrayHeaderSizeInBytes();
     generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::addi, node, valueReg, valueReg, hdrSize);
-    generateTrg1Src2Instruction(cg, TR::InstOpCode::add, node, endReg, endReg, endReg);
+    if (!isCompressed)
+        generateTrg1Src2Instruction(cg, TR::InstOpCode::add, node, endReg, endReg, endReg);
     generateTrg1Src2Instruction(cg, TR::InstOpCode::add, node, valueReg, valueReg, endReg);
-    generateTrg1Src2Instruction(cg, TR::InstOpCode::add, node, vendReg, vendReg, vendReg);
+    if (!isCompressed)
+        generateTrg1Src2Instruction(cg, TR::InstOpCode::add, node, vendReg, vendReg, vendReg);
     generateTrg1Src2Instruction(cg, TR::InstOpCode::add, node, endReg, valueReg, vendReg);
     generateTrg1Src2Instruction(cg, TR::InstOpCode::XOR, node, hashReg, hashReg, hashReg);
     generateTrg1Src2Instruction(cg, TR::InstOpCode::XOR, node, tempReg, tempReg, tempReg);
     loadConstant(cg, node, 0x0, constant0Reg);
 
-    // if count<<1 < 16 goto serial
+    // if the string is shorter than 16 bytes goto serial
     generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::cmpi4, node, condReg, vendReg, 0x10);
     generateConditionalBranchInstruction(cg, TR::InstOpCode::blt, node, serialLabel, condReg);
 
@@ -11425,6 +11458,12 @@ static TR::Register *inlineStringHashcode(TR::Node *node, TR::CodeGenerator *cg)
     generateTrg1Src2Instruction(cg, TR::InstOpCode::vnor, node, vconstantNegReg, vconstant0Reg, vconstant0Reg);
     generateTrg1Src2ImmInstruction(cg, TR::InstOpCode::vsldoi, node, vunpackMaskReg, vconstant0Reg, vconstantNegReg, 2);
     generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::vspltw, node, vunpackMaskReg, vunpackMaskReg, 3);
+    if (isCompressed)
+        {
+        // 0x00FF in every halfword, to zero extend the sign extending byte unpacks
+        generateTrg1Src2ImmInstruction(cg, TR::InstOpCode::vsldoi, node, vbyteMaskReg, vconstant0Reg, vconstantNegReg, 1);
+        generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::vsplth, node, vbyteMaskReg, vbyteMaskReg, 7);
+        }
 
     // vend = end & (~0xf)
     // if v is 16byte aligned goto VSX_LOOP
@@ -11453,10 +11492,18 @@ static TR::Register *inlineStringHashcode(TR::Node *node, TR::CodeGenerator *cg)
     generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, vtmp1Reg, vtmp1Reg, vtmp2Reg);
 
     // unpack masked v to high4 low4
-    generateTrg1Src1Instruction(cg, TR::InstOpCode::vupkhsh, node, high4Reg, vtmp1Reg);
-    generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, high4Reg, high4Reg, vunpackMaskReg);
-    generateTrg1Src1Instruction(cg, TR::InstOpCode::vupklsh, node, low4Reg, vtmp1Reg);
-    generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, low4Reg, low4Reg, vunpackMaskReg);
+    if (isCompressed)
+        {
+        // The masked out leading bytes are zero, so they don't contribute to the hash
+        accumulateCompressedStringHashcode(node, cg, vtmp1Reg, vtmp2Reg, vtmp3Reg, high4Reg, low4Reg, multiplierReg, vunpackMaskReg, vbyteMaskReg);
+        }
+    else
+        {
+        generateTrg1Src1Instruction(cg, TR::InstOpCode::vupkhsh, node, high4Reg, vtmp1Reg);
+        generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, high4Reg, high4Reg, vunpackMaskReg);
+        generateTrg1Src1Instruction(cg, TR::InstOpCode::vupklsh, node, low4Reg, vtmp1Reg);
+        generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, low4Reg, low4Reg, vunpackMaskReg);
+        }
 
     // advance v to next aligned pointer
     // if v >= vend goto POST_VSX
@@ -11477,14 +11524,10 @@ static TR::Register *inlineStringHashcode(TR::Node *node, TR::CodeGenerator *cg)
     //if v < vend goto VSX_LOOP
     generateLabelInstruction(cg, TR::InstOpCode::label, node, VSXLabel);
     generateTrg1MemInstruction(cg, TR::InstOpCode::lvx, node, vtmp1Reg, new (cg->trHeapMemory()) TR::MemoryReference(valueReg, constant0Reg, 16, cg));
-    generateTrg1Src1Instruction(cg, TR::InstOpCode::vupkhsh, node, vtmp2Reg, vtmp1Reg);
-    generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, vtmp2Reg, vtmp2Reg, vunpackMaskReg);
-    generateTrg1Src2Instruction(cg, TR::InstOpCode::vmuluwm, node, high4Reg, high4Reg, multiplierReg);
-    generateTrg1Src2Instruction(cg, TR::InstOpCode::vadduwm, node, high4Reg, high4Reg, vtmp2Reg);
-    generateTrg1Src1Instruction(cg, TR::InstOpCode::vupklsh, node, vtmp2Reg, vtmp1Reg);
-    generateTrg1Src2Instruction(cg, TR::InstOpCode::vand, node, vtmp2Reg, vtmp2Reg, vunpackMaskReg);
-    generateTrg1Src2Instruction(cg, TR::InstOpCode::vmuluwm, node, low4Reg, low4Reg, multiplierReg);
-    generateTrg1Src2Instruction(cg, TR::InstOpCode::vadduwm, node, low4Reg, low4Reg, vtmp2Reg);
+    if (isCompressed)
+        accumulateCompressedStringHashcode(node, cg, vtmp1Reg, vtmp2Reg, vtmp3Reg, high4Reg, low4Reg, multiplierReg, vunpackMaskReg, vbyteMaskReg);
+    else
+        accumulateStringHashcode(node, cg, vtmp1Reg, vtmp2Reg, high4Reg, low4Reg, multiplierReg, vunpackMaskReg);
     generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::addi, node, valueReg, valueReg, 0x10);
     generateTrg1Src2Instruction(cg, TR::InstOpCode::cmp8, node, condReg, valueReg, vendReg);
     generateConditionalBranchInstruction(cg, TR::InstOpCode::blt, node, VSXLabel, condReg);
@@ -11524,13 +11567,16 @@ static TR::Register *inlineStringHashcode(TR::Node *node, TR::CodeGenerator *cg)
     generateTrg1Src1Instruction(cg, TR::InstOpCode::mr, node, tempReg, hashReg);
     generateTrg1Src1Imm2Instruction(cg, TR::InstOpCode::rlwinm, node, hashReg, hashReg, 5, 0xFFFFFFFFFFFFFFE0);
     generateTrg1Src2Instruction(cg, TR::InstOpCode::subf, node, hashReg, tempReg, hashReg);
-    generateTrg1MemInstruction(cg, TR::InstOpCode::lhzx, node, tempReg, new (cg->trHeapMemory()) TR::MemoryReference(valueReg, constant0Reg, 2, cg));
+    if (isCompressed)
+        generateTrg1MemInstruction(cg, TR::InstOpCode::lbzx, node, tempReg, new (cg->trHeapMemory()) TR::MemoryReference(valueReg, constant0Reg, 1, cg));
+    else
+        generateTrg1MemInstruction(cg, TR::InstOpCode::lhzx, node, tempReg, new (cg->trHeapMemory()) TR::MemoryReference(valueReg, constant0Reg, 2, cg));
     generateTrg1Src2Instruction(cg, TR::InstOpCode::add, node, hashReg, hashReg, tempReg);
-    generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::addi, node, valueReg, valueReg, 0x2);
+    generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::addi, node, valueReg, valueReg, isCompressed ? 0x1 : 0x2);
     generateLabelInstruction(cg, TR::InstOpCode::b, node, serialLabel);
 
     // End of this method
-    TR::RegisterDependencyConditions *dependencies = new (cg->trHeapMemory()) TR::RegisterDependencyConditions(0, 16, cg->trMemory());
+    TR::RegisterDependencyConditions *dependencies = new (cg->trHeapMemory()) TR::RegisterDependencyConditions(0, isCompressed ? 18 : 16, cg->trMemory());
     dependencies->addPostCondition(valueReg, TR::RealRegister::NoReg);
     dependencies->getPostConditions()->getRegisterDependency(0)->setExcludeGPR0(); // valueReg
 
@@ -11552,6 +11598,11 @@ static TR::Register *inlineStringHashcode(TR::Node *node, TR::CodeGenerator *cg)
     dependencies->addPostCondition(vconstant0Reg, TR::RealRegister::NoReg);
     dependencies->addPostCondition(vconstantNegReg, TR::RealRegister::NoReg);
     dependencies->addPostCondition(vunpackMaskReg, TR::RealRegister::NoReg);
+    if (isCompressed)
+        {
+        dependencies->addPostCondition(vbyteMaskReg, TR::RealRegister::NoReg);
+        dependencies->addPostCondition(vtmp3Reg, TR::RealRegister::NoReg);
+        }
 
     generateDepLabelInstruction(cg, TR::InstOpCode::label, node, endLabel, dependencies);
 
@@ -11576,6 +11627,11 @@ static TR::Register *inlineStringHashcode(TR::Node *node, TR::CodeGenerator *cg)
     cg->stopUsingRegister(vconstant0Reg);
     cg->stopUsingRegister(vconstantNegReg);
     cg->stopUsingRegister(vunpackMaskReg);
+    if (isCompressed)
+        {
+        cg->stopUsingRegister(vbyteMaskReg);
+        cg->stopUsingRegister(vtmp3Reg);
+        }
     return hashReg;
 }
 
@@ -12813,9 +12869,10 @@ J9::Power::CodeGenerator::inlineDirectCall(TR::Node *node, TR::Register *&result
          return true;
 
       case TR::java_lang_String_hashCodeImplDecompressed:
+      case TR::java_lang_String_hashCodeImplCompressed:
          if (!TR::Compiler->om.canGenerateArraylets() && TR::Compiler->target.cpu.id() >= TR_PPCp8 && TR::Compiler->target.cpu.getPPCSupportsVSX() && !cg->comp()->compileRelocatableCode())
             {
-            resultReg = inlineStringHashcode(node, cg);
+            resultReg = inlineStringHashcode(node, cg, methodSymbol->getRecognizedMethod() == TR::java_lang_String_hashCodeImplCompressed);
             return true;
             }
          break;
@@ -28,6 +28,7 @@
 #include "env/CHTable.hpp"
 #include "env/PersistentCHTable.hpp"
 #include "env/PersistentInfo.hpp"
+#include "env/VMJ9.h"
 #include "env/jittypes.h"
 #include "infra/Monitor.hpp"
 #include "infra/CriticalSection.hpp"
@@ -188,6 +189,10 @@ TR_PersistentClassInfo::removeUnloadedSubClasses()
        }
     _marked=0;
     memset(_detachPending, 0, sizeof(bool)*LastAssumptionKind);
+    _numPatchBatches = 0;
+    _numBatchedPatches = 0;
+    _numBatchedPages = 0;
+    _maxPatchesPerBatch = 0;
     return true;
     }
 
@@ -392,6 +397,52 @@ void TR_RuntimeAssumptionTable::markForDetachFromRAT(OMR::RuntimeAssumption *ass
    _marked++;
    }
 
+static bool
+compareAssumingPC(OMR::RuntimeAssumption *a, OMR::RuntimeAssumption *b)
+   {
+   return a->getFirstAssumingPC() < b->getFirstAssumingPC();
+   }
+
+void TR_RuntimeAssumptionTable::compensateBatch(TR_FrontEnd *fe, OMR::RuntimeAssumption **assumptions, int32_t count)
+   {
+   if (count <= 0)
+      return;
+
+   PORT_ACCESS_FROM_JITCONFIG(((TR_J9VMBase *)fe)->getJ9JITConfig());
+   const uintptrj_t pageMask = ~((uintptrj_t)j9vmem_supported_page_sizes()[0] - 1);
+
+   std::sort(assumptions, assumptions + count, compareAssumingPC);
+
+   // Each site is still synchronized by the platform patching code as it is written,
+   // so the pages are only counted here; a single flush per page can replace those
+   // syncs once the patching code allows them to be skipped
+   uintptrj_t lastPage = 0;
+   uint32_t numPages = 0;
+   for (int32_t i = 0; i < count; i++)
+      {
+      uintptrj_t page = (uintptrj_t)assumptions[i]->getFirstAssumingPC() & pageMask;
+      if (i == 0 || page != lastPage)
+         {
+         numPages++;
+         lastPage = page;
+         }
+      assumptions[i]->compensate(fe, 0, 0);
+      markForDetachFromRAT(assumptions[i]);
+      }
+
+   _numPatchBatches++;
+   _numBatchedPatches += count;
+   _numBatchedPages += numPages;
+   if ((uint32_t)count > _maxPatchesPerBatch)
+      _maxPatchesPerBatch = count;
+   }
+
+void TR_RuntimeAssumptionTable::printPatchStatistics()
+   {
+   TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "RAT patching on class load: events=%u patches=%u pages=%u maxPatchesPerEvent=%u",
+      _numPatchBatches, _numBatchedPatches, _numBatchedPages, _maxPatchesPerBatch);
+   }
+
 /**
  * Traverse the entire RAT detaching and reclaiming all marked assumptions.
  * This assumes that the assumptions have already been detached from the 
@@ -27,6 +27,7 @@
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "env/VMJ9.h"
+#include "env/VerboseLog.hpp"
 
 //--------------------- DataCacheManager ----------------
 
@@ -144,6 +145,11 @@ TR_DataCacheManager::TR_DataCacheManager(J9JITConfig *jitConfig, TR::Monitor *mo
    ),
    _newImplementation(newImplementation),
    _worstFit(worstFit),
+   _bytesInPoolTotal(0),
+   _numFreeAllocations(0),
+   _bytesFreedSinceCompaction(0),
+   _bytesReleasedToVM(0),
+   _numReleasedCaches(0),
    _sizeList(),
    _mutex(monitor)
    {
@@ -264,6 +270,7 @@ TR_DataCache* TR_DataCacheManager::allocateNewDataCache(uint32_t minimumSize)
                dataCache->_status = 0;
                dataCache->_vmThread = NULL;
                dataCache->_allocationMark = dataCacheSeg->heapAlloc;
+               dataCache->_poolBase = NULL;
                _numAllocatedCaches++;
                _totalSegmentMemoryAllocated += (uint32_t)allocatedSize;
 #ifdef DATA_CACHE_DEBUG
@@ -639,8 +646,18 @@ void TR_DataCacheManager::freeDataCacheRecord(void *record)
          fprintf(stderr, "Reaping data cache record at %p, data start = %p\n", static_cast<uint8_t *>(record) - sizeof(J9JITDataCacheHeader), record);
          fprintf(stderr, "Returning freed allocation to pool\n");
 #endif
+         // Records carved out of the pool can be merged with free neighbours;
+         // records that came from reserved data caches are pooled as they are
+         TR_DataCache *dataCache = findPoolCache(alloc);
+         if (dataCache)
+            alloc = coalesceWithFollowing(alloc, dataCache);
          addToPool(alloc);
-         freeHook(alloc->size());
+         freeHook(size);
+         // Once a data cache worth of records has been freed (typically after
+         // class unloading) try to give fully free data caches back to the VM
+         _bytesFreedSinceCompaction += size;
+         if (_bytesFreedSinceCompaction >= _jitConfig->dataCacheKB * 1024)
+            compactPool();
 #if defined(DATA_CACHE_DEBUG)
          printStatistics();
 #endif
@@ -715,6 +732,8 @@ TR_DataCacheManager::addToPool(TR_DataCacheManager::Allocation *alloc)
       {
       it->push(alloc);
       insertHook(alloc->size());
+      _bytesInPoolTotal += alloc->size();
+      _numFreeAllocations++;
       }
    else
       {
@@ -724,10 +743,14 @@ TR_DataCacheManager::addToPool(TR_DataCacheManager::Allocation *alloc)
          SizeBucket *sb = new ( vmAlloc ) SizeBucket(alloc);
          _sizeList.insert(it, *sb);
          insertHook(alloc->size());
+         _bytesInPoolTotal += alloc->size();
+         _numFreeAllocations++;
          }
       else
          {
          // Add trace point for leaked allocation
+         // Mark it as used so that coalescing never looks for it in the pool
+         alloc->prepareForUse();
          }
       }
    }
@@ -764,7 +787,11 @@ TR_DataCacheManager::getFromPool(uint32_t size)
          }
       }
    if (ret)
+      {
       removeHook(ret->size());
+      _bytesInPoolTotal -= ret->size();
+      _numFreeAllocations--;
+      }
 #if defined(DATA_CACHE_DEBUG) && (DATA_CACHE_VERBOSITY_LEVEL >= 3)
    if (ret)
       {
@@ -778,6 +805,192 @@ TR_DataCacheManager::getFromPool(uint32_t size)
    return ret;
    }
 
+//------------------------------- removeFromPool -----------------------------
+// Take a specific free allocation out of its size bucket, releasing the bucket
+// if it becomes empty. Must be called with the data cache mutex held.
+//----------------------------------------------------------------------------
+void
+TR_DataCacheManager::removeFromPool(TR_DataCacheManager::Allocation *alloc)
+   {
+   TR_ASSERT(alloc->isFree(), "Attempting to remove an allocation that is in use from the pool.");
+   InPlaceList<SizeBucket>::Iterator it = _sizeList.begin();
+   while (it != _sizeList.end() && it->size() < alloc->size())
+      {
+      ++it;
+      }
+   TR_ASSERT(it != _sizeList.end() && it->size() == alloc->size(), "Free allocation %p of size %u has no size bucket", alloc, alloc->size());
+   alloc->getListElement()->remove();
+   if (it->isEmpty())
+      {
+      SizeBucket *sb = &(*it);
+      _sizeList.remove(it);
+      freeMemoryToVM(sb);
+      }
+   removeHook(alloc->size());
+   _bytesInPoolTotal -= alloc->size();
+   _numFreeAllocations--;
+   }
+
+//------------------------------- findPoolCache ------------------------------
+// Return the data cache whose pool space contains ptr, or NULL if ptr was
+// allocated from a reserved data cache
+//----------------------------------------------------------------------------
+TR_DataCache *
+TR_DataCacheManager::findPoolCache(void *ptr)
+   {
+   uint8_t *address = static_cast<uint8_t *>(ptr);
+   for (TR_DataCache *dataCache = _cachesInPool; dataCache; dataCache = dataCache->_next)
+      {
+      if (address >= dataCache->_poolBase && address < dataCache->getCurrentHeapAlloc())
+         return dataCache;
+      }
+   return NULL;
+   }
+
+//--------------------------- coalesceWithFollowing --------------------------
+// Merge alloc, which must not be in the pool, with the free allocations that
+// immediately follow it in the pool space of dataCache
+//----------------------------------------------------------------------------
+TR_DataCacheManager::Allocation *
+TR_DataCacheManager::coalesceWithFollowing(TR_DataCacheManager::Allocation *alloc, TR_DataCache *dataCache)
+   {
+   uint8_t *poolTop = dataCache->getCurrentHeapAlloc();
+   uint8_t *nextAddress = reinterpret_cast<uint8_t *>(alloc) + alloc->size();
+   while (nextAddress < poolTop && reinterpret_cast<Allocation *>(nextAddress)->isFree())
+      {
+      Allocation *next = reinterpret_cast<Allocation *>(nextAddress);
+#if defined(DATA_CACHE_DEBUG) && (DATA_CACHE_VERBOSITY_LEVEL >= 3)
+      fprintf(stderr, "Coalescing allocation %p of size %u with %p of size %u\n", alloc, alloc->size(), next, next->size());
+#endif
+      removeFromPool(next);
+      alloc->coalesce(next);
+      nextAddress = reinterpret_cast<uint8_t *>(alloc) + alloc->size();
+      }
+   return alloc;
+   }
+
+//----------------------------- coalescePoolCache ----------------------------
+// Walk the pool space of dataCache and merge all runs of adjacent free
+// allocations. Freeing only merges forward, so this catches the runs that
+// were freed back to front.
+// Return value:
+//    true if the whole pool space of the data cache is a single free allocation
+//----------------------------------------------------------------------------
+bool
+TR_DataCacheManager::coalescePoolCache(TR_DataCache *dataCache)
+   {
+   uint8_t *poolTop = dataCache->getCurrentHeapAlloc();
+   uint8_t *cursor = dataCache->_poolBase;
+   while (cursor < poolTop)
+      {
+      Allocation *alloc = reinterpret_cast<Allocation *>(cursor);
+      TR_ASSERT(alloc->size() > 0, "Data cache record at %p has size 0", alloc);
+      if (alloc->size() == 0)
+         return false;
+      uint8_t *nextAddress = cursor + alloc->size();
+      if (alloc->isFree() && nextAddress < poolTop && reinterpret_cast<Allocation *>(nextAddress)->isFree())
+         {
+         removeFromPool(alloc);
+         alloc = coalesceWithFollowing(alloc, dataCache);
+         addToPool(alloc);
+         }
+      cursor += alloc->size();
+      }
+   Allocation *first = reinterpret_cast<Allocation *>(dataCache->_poolBase);
+   return first->isFree() && (first->size() == static_cast<uint32_t>(poolTop - dataCache->_poolBase));
+   }
+
+//------------------------------- compactPool --------------------------------
+// Coalesce the free space in every data cache owned by the pool and return the
+// segments that became completely free to the VM. Segments that were used by
+// compilations before being handed to the pool keep their records and are
+// never released. Must be called with the data cache mutex held.
+//----------------------------------------------------------------------------
+void
+TR_DataCacheManager::compactPool()
+   {
+   PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+   J9JavaVM *javaVM = _jitConfig->javaVM;
+   int32_t numReleasedCaches = 0;
+   _bytesFreedSinceCompaction = 0;
+
+   TR_DataCache *prev = NULL;
+   TR_DataCache *dataCache = _cachesInPool;
+   while (dataCache)
+      {
+      TR_DataCache *next = dataCache->_next;
+      J9MemorySegment *segment = dataCache->_segment;
+      // jitConfig->dataCache still points to the most recent segment, so keep it
+      if (coalescePoolCache(dataCache) &&
+          dataCache->_poolBase == segment->heapBase &&
+          segment != _jitConfig->dataCache)
+         {
+         Allocation *alloc = reinterpret_cast<Allocation *>(dataCache->_poolBase);
+         UDATA segmentSize = segment->heapTop - segment->heapBase;
+         removeFromPool(alloc);
+         shrinkHook(alloc->size());
+         if (prev)
+            prev->_next = next;
+         else
+            _cachesInPool = next;
+#if defined(DATA_CACHE_DEBUG)
+         fprintf(stderr, "Releasing free segment %p of size %u for TR_DataCache %p\n", segment, (uint32_t)segmentSize, dataCache);
+#endif
+         dataCache->~TR_DataCache();
+         javaVM->internalVMFunctions->freeMemorySegment(javaVM, segment, true);
+         j9mem_free_memory(dataCache);
+         _numAllocatedCaches--;
+         _totalSegmentMemoryAllocated -= segmentSize;
+         _bytesReleasedToVM += segmentSize;
+         numReleasedCaches++;
+         }
+      else
+         {
+         prev = dataCache;
+         }
+      dataCache = next;
+      }
+
+   if (numReleasedCaches > 0)
+      {
+      _numReleasedCaches += numReleasedCaches;
+      // There is room for new segments again
+      _jitConfig->runtimeFlags &= ~J9JIT_DATA_CACHE_FULL;
+      }
+
+   if (TR::Options::getVerboseOption(TR_VerboseReclamation))
+      printPoolFootprint("compacted");
+   }
+
+//---------------------------- printPoolFootprint ----------------------------
+// Report the footprint and fragmentation of the data cache pool in the
+// verbose log. Must be called with the data cache mutex held.
+//----------------------------------------------------------------------------
+void
+TR_DataCacheManager::printPoolFootprint(const char *reason)
+   {
+   uint32_t largestFree = 0;
+   if (!_sizeList.empty())
+      {
+      InPlaceList<SizeBucket>::Iterator last = _sizeList.end();
+      --last;
+      largestFree = last->size();
+      }
+   // Share of the free bytes that cannot satisfy a request as large as the largest free block
+   uint32_t fragmentation = _bytesInPoolTotal ? (uint32_t)(100 - (100 * (UDATA)largestFree) / _bytesInPoolTotal) : 0;
+   TR_VerboseLog::writeLineLocked(TR_Vlog_RECLAMATION,
+      "Data cache pool %s: segments=%d footprint=%u KB free=%u KB in %u blocks largest=%u bytes fragmentation=%u%% released=%d segments (%u KB)",
+      reason,
+      _numAllocatedCaches,
+      (uint32_t)(_totalSegmentMemoryAllocated >> 10),
+      (uint32_t)(_bytesInPoolTotal >> 10),
+      (uint32_t)_numFreeAllocations,
+      largestFree,
+      fragmentation,
+      _numReleasedCaches,
+      (uint32_t)(_bytesReleasedToVM >> 10));
+   }
+
 void
 TR_DataCacheManager::convertDataCachesToAllocations()
    {
@@ -807,6 +1020,7 @@ TR_DataCacheManager::convertDataCacheToAllocation(TR_DataCache *dataCache)
    uint32_t dataCacheSize = dataCache->remainingSpace();
    if (dataCacheSize >= (_quantumSize * _minQuanta))
       {
+      dataCache->_poolBase = dataCache->getCurrentHeapAlloc();
       returnValue =  new (dataCache->allocateDataCacheSpace(dataCacheSize)) Allocation(dataCacheSize);
       dataCache->_next = _cachesInPool;
       _cachesInPool = dataCache;
@@ -859,6 +1073,11 @@ TR_DataCacheManager::growHook( UDATA allocationSize )
    {
    }
 
+void
+TR_DataCacheManager::shrinkHook( UDATA allocationSize )
+   {
+   }
+
 void
 TR_DataCacheManager::allocationHook( UDATA allocationSize, UDATA requestedSize )
    {
@@ -880,6 +1099,11 @@ void TR_DataCacheManager::removeHook( UDATA allocationSize )
 void
 TR_DataCacheManager::printStatistics()
    {
+   if (_newImplementation && TR::Options::getVerboseOption(TR_VerboseReclamation))
+      {
+      OMR::CriticalSection criticalSection(_mutex);
+      printPoolFootprint("at shutdown");
+      }
    }
 
 void
@@ -962,6 +1186,13 @@ TR_InstrumentedDataCacheManager::growHook(UDATA bytesAdded)
    _freeSpace += bytesAdded;
    }
 
+void
+TR_InstrumentedDataCacheManager::shrinkHook(UDATA bytesRemoved)
+   {
+   _jitSpace -= bytesRemoved;
+   _freeSpace -= bytesRemoved;
+   }
+
 void
 TR_InstrumentedDataCacheManager::allocationHook(UDATA allocationSize, UDATA requestedSize)
    {
@@ -40,6 +40,7 @@ private:
    J9MemorySegment *_segment;   // the segment where the memory for the dataCache is
    J9VMThread      *_vmThread;  // thread that is actively working on this cache; could be NULL
    uint8_t         *_allocationMark; // used if we want to give back memory up to previously set mark
+   uint8_t         *_poolBase;  // start of the space handed to the pool; everything up to heapAlloc is tiled with records
    //TR::Monitor       *_mutex;     // Is this needed?
    int32_t          _status;    // mostly RAS at this point
 public:
@@ -273,7 +274,9 @@ protected:
 #endif
             }
          uint32_t size() { return _header.size; }
+         bool isFree() { return _header.type == J9_JIT_DCE_UNALLOCATED; }
          Allocation *split ( uint32_t size );
+         void coalesce(Allocation *next) { _header.size += next->size(); }
          InPlaceList<Allocation>::ListElement *getListElement() { return &_listElement; }
          void *getBuffer() { return static_cast<void *>(&_listElement); }
          void prepareForUse() { _header.type = J9_JIT_DCE_IN_USE; }
@@ -338,6 +341,13 @@ private:
    const bool _newImplementation;
    const bool _worstFit;
 
+   // Footprint and fragmentation of the pool
+   UDATA            _bytesInPoolTotal;
+   UDATA            _numFreeAllocations;
+   UDATA            _bytesFreedSinceCompaction;
+   UDATA            _bytesReleasedToVM;
+   int32_t          _numReleasedCaches;
+
    TR_DataCache *allocateNewDataCache(uint32_t minimumSize);
    uint8_t *allocateDataCacheSpace(uint32_t size); // Made private for data cache reclamation.
    void freeDataCacheList(TR_DataCache *& head);
@@ -346,6 +356,12 @@ private:
    void addToPool(Allocation *);
    Allocation *getFromPool(uint32_t size);
    Allocation *convertDataCacheToAllocation(TR_DataCache *dataCache);
+   void removeFromPool(Allocation *alloc);
+   TR_DataCache *findPoolCache(void *ptr);
+   Allocation *coalesceWithFollowing(Allocation *alloc, TR_DataCache *dataCache);
+   bool coalescePoolCache(TR_DataCache *dataCache);
+   void compactPool();
+   void printPoolFootprint(const char *reason);
    void *allocateMemoryFromVM(size_t size);
    void freeMemoryToVM(void *ptr);
    uint32_t alignAllocation(uint32_t size)
@@ -364,6 +380,7 @@ protected:
 
    virtual ~TR_DataCacheManager();
    virtual void growHook( UDATA allocationSize );
+   virtual void shrinkHook( UDATA allocationSize );
    virtual void allocationHook( UDATA allocationSize, UDATA requestedSize );
    virtual void freeHook( UDATA allocationSize );
    virtual void insertHook( UDATA allocationSize );
@@ -390,6 +407,8 @@ public:
    void fillDataCacheHeader(J9JITDataCacheHeader *hdr, uint32_t allocationType, uint32_t size);
    double computeDataCacheEfficiency();
    uint32_t getTotalSegmentMemoryAllocated() const { return _totalSegmentMemoryAllocated; }
+   // Must be held to walk the records in the data cache segments
+   TR::Monitor *getMutex() const { return _mutex; }
    void freeDataCacheRecord(void *record);
    void startupOver()
       {
@@ -428,6 +447,7 @@ public:
 
 protected:
    virtual void growHook( UDATA allocationSize );
+   virtual void shrinkHook( UDATA allocationSize );
    virtual void allocationHook( UDATA allocationSize, UDATA requestedSize );
    virtual void freeHook( UDATA allocationSize );
    virtual void insertHook( UDATA allocationSize );
@@ -145,6 +145,14 @@ public:
     */
    virtual bool deinitializeThread(J9VMThread *vmThread) = 0;
 
+   /**
+    * Is hardware profiling initialized on the given app thread. Platforms which do not
+    * keep their state in the thread's RI parameters override this.
+    * @param vmThread The VM thread to query.
+    * @return true if the thread is initialized for profiling; false otherwise.
+    */
+   virtual bool isThreadInitialized(J9VMThread *vmThread) { return IS_THREAD_RI_INITIALIZED(vmThread); }
+
    /**
     * Start a thread to process profiling buffers
     * @param javaVM The javaVM for the current VM Instance.
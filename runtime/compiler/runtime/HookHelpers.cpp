@@ -241,6 +241,13 @@ typedef struct TR_jit_artifact_search_cache
       J9JITExceptionTable * exceptionTable;
    } TR_jit_artifact_search_cache;
 
+#define JIT_ARTIFACT_SEARCH_MRU_SIZE 4
+typedef struct TR_jit_artifact_search_mru
+   {
+      J9JITExceptionTable * bodies[JIT_ARTIFACT_SEARCH_MRU_SIZE];
+      J9JITHashTable * tableHint;
+   } TR_jit_artifact_search_mru;
+
 void cleanUpJitArtifactSearchCache(J9VMThread *vmThread, J9JITExceptionTable *metaData)
    {
    struct J9JavaVM* javaVM=vmThread->javaVM;
@@ -259,6 +266,15 @@ void cleanUpJitArtifactSearchCache(J9VMThread *vmThread, J9JITExceptionTable *me
                searchCache[counter].searchValue=0;
                }
             }
+         // the recently found bodies follow the PC entries
+         TR_jit_artifact_search_mru * mru=(TR_jit_artifact_search_mru *)(searchCache + JIT_ARTIFACT_SEARCH_CACHE_SIZE);
+         for(int counter=0;counter<JIT_ARTIFACT_SEARCH_MRU_SIZE;counter++)
+            {
+            if(mru->bodies[counter] == metaData)
+               {
+               mru->bodies[counter]=NULL;
+               }
+            }
          }
       }
    while ((currentThread = currentThread->linkNext) != javaVM->mainThread);
@@ -214,12 +214,33 @@ TR::CodeCache*
 J9::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeContiguous,
                                       size_t sizeEstimate,
                                       int32_t compThreadID,
-                                      int32_t *numReserved)
+                                      int32_t *numReserved,
+                                      bool hotCode)
    {
-   TR::CodeCache *codeCache = self()->OMR::CodeCacheManager::reserveCodeCache(compilationCodeAllocationsMustBeContiguous,
-                                                                            sizeEstimate,
-                                                                            compThreadID,
-                                                                            numReserved);
+   TR::CodeCache *codeCache = NULL;
+
+   if (TR::Options::getHotCodeCacheLevel() > 0)
+      {
+      // AOT compilations need contiguous allocations and are never placed in the hot code cache
+      hotCode = hotCode && !compilationCodeAllocationsMustBeContiguous;
+      codeCache = self()->reserveCodeCacheForHotCodeLayout(hotCode,
+                                                           compilationCodeAllocationsMustBeContiguous,
+                                                           sizeEstimate,
+                                                           compThreadID,
+                                                           numReserved);
+      // A hot body that could not get the hot code cache may go anywhere, but the default
+      // reservation does not skip the hot code cache so other bodies must not fall back on it
+      if (codeCache == NULL && hotCode)
+         codeCache = self()->OMR::CodeCacheManager::reserveCodeCache(false, sizeEstimate, compThreadID, numReserved);
+      }
+   else
+      {
+      codeCache = self()->OMR::CodeCacheManager::reserveCodeCache(compilationCodeAllocationsMustBeContiguous,
+                                                                 sizeEstimate,
+                                                                 compThreadID,
+                                                                 numReserved);
+      }
+
    if (codeCache == NULL)
       {
       J9JITConfig *jitConfig = self()->fej9()->getJ9JITConfig();
@@ -228,6 +249,129 @@ J9::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeCont
    return codeCache;
    }
 
+TR::CodeCache*
+J9::CodeCacheManager::reserveCodeCacheForHotCodeLayout(bool hotCode,
+                                                       bool compilationCodeAllocationsMustBeContiguous,
+                                                       size_t sizeEstimate,
+                                                       int32_t compThreadID,
+                                                       int32_t *numReserved)
+   {
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+   *numReserved = 0;
+
+   if (hotCode)
+      {
+         {
+         CacheListCriticalSection scanCacheList(self());
+         TR::CodeCache *hotCodeCache = _hotCodeCache;
+         if (hotCodeCache &&
+             (hotCodeCache->almostFull() == TR_yes ||
+              hotCodeCache->getFreeContiguousSpace() < config.lowCodeCacheThreshold()))
+            {
+            // Retire the current hot code cache; it becomes an ordinary code cache
+            if (config.verbosePerformance())
+               TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Hot code cache %p is full", hotCodeCache);
+            _hotCodeCache = hotCodeCache = NULL;
+            }
+
+         if (hotCodeCache)
+            {
+            // Another hot compilation is using it; place this body elsewhere
+            if (hotCodeCache->isReserved())
+               return NULL;
+            hotCodeCache->reserve(compThreadID);
+            return hotCodeCache;
+            }
+
+         if (!self()->canAddNewCodeCache())
+            return NULL;
+         }
+
+      // Start a new hot region in a fresh code cache so that it only ever holds hot bodies
+      TR::CodeCache *hotCodeCache = self()->allocateCodeCacheFromNewSegment(config.codeCacheKB() << 10, compThreadID);
+      if (hotCodeCache)
+         {
+         CacheListCriticalSection scanCacheList(self());
+         if (!hotCodeCache->isReserved())
+            hotCodeCache->reserve(compThreadID);
+         _hotCodeCache = hotCodeCache;
+         if (config.verbosePerformance())
+            TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "Allocated hot code cache %p", hotCodeCache);
+         }
+      return hotCodeCache;
+      }
+
+   // Same policy as the default reservation, except that the hot code cache is skipped
+      {
+      CacheListCriticalSection scanCacheList(self());
+      for (TR::CodeCache *codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next())
+         {
+         if (codeCache == _hotCodeCache)
+            continue;
+         if (codeCache->isReserved())
+            {
+            (*numReserved)++;
+            continue;
+            }
+         if (codeCache->almostFull() != TR_yes &&
+             (!compilationCodeAllocationsMustBeContiguous || codeCache->getFreeContiguousSpace() >= sizeEstimate))
+            {
+            codeCache->reserve(compThreadID);
+            return codeCache;
+            }
+         }
+
+      if (!self()->canAddNewCodeCache())
+         return NULL;
+      }
+
+   // Every ordinary code cache is reserved or full; start a new one rather than use the hot code cache
+   TR::CodeCache *codeCache = self()->allocateCodeCacheFromNewSegment(config.codeCacheKB() << 10, compThreadID);
+   if (codeCache)
+      {
+      CacheListCriticalSection scanCacheList(self());
+      if (!codeCache->isReserved())
+         codeCache->reserve(compThreadID);
+      }
+   return codeCache;
+   }
+
+void
+J9::CodeCacheManager::recordHotBody(TR::CodeCache *codeCache, uint8_t *startPC, uint8_t *endWarmPC)
+   {
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+   uintptr_t pageSize = config.largeCodePageSize() > 0 ? config.largeCodePageSize() : 4096;
+   uintptr_t firstPage = (uintptr_t)startPC / pageSize;
+   uintptr_t lastPage = ((uintptr_t)endWarmPC - 1) / pageSize;
+   size_t pages = lastPage - firstPage + 1;
+
+   CacheListCriticalSection recordingHotBody(self());
+   // Bodies placed back to back in the hot code cache share their boundary page
+   if (firstPage == _lastHotCodePage)
+      pages--;
+   _lastHotCodePage = lastPage;
+   _hotCodePages += pages;
+   _hotCodeBytes += endWarmPC - startPC;
+   _numHotBodies++;
+   if (codeCache != NULL && codeCache == _hotCodeCache)
+      _numHotBodiesInHotCodeCaches++;
+   }
+
+void
+J9::CodeCacheManager::printHotCodeFootprint()
+   {
+   TR::CodeCacheConfig &config = self()->codeCacheConfig();
+   uintptr_t pageSize = config.largeCodePageSize() > 0 ? config.largeCodePageSize() : 4096;
+   CacheListCriticalSection printingHotCodeFootprint(self());
+   TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE,
+      "Hot code: %u bodies (%u in hot code caches) %u KB of warm code spanning %u pages of %u KB (estimated iTLB entries)",
+      _numHotBodies,
+      _numHotBodiesInHotCodeCaches,
+      (uint32_t)(_hotCodeBytes >> 10),
+      (uint32_t)_hotCodePages,
+      (uint32_t)(pageSize >> 10));
+   }
+
 void
 J9::CodeCacheManager::reportCodeLoadEvents()
    {
@@ -53,7 +53,13 @@ class OMR_EXTENSIBLE CodeCacheManager : public OMR::CodeCacheManagerConnector
 public:
    CodeCacheManager(TR_FrontEnd *fe, TR::RawAllocator rawAllocator) :
       OMR::CodeCacheManagerConnector(rawAllocator),
-      _fe(fe)
+      _fe(fe),
+      _hotCodeCache(NULL),
+      _numHotBodies(0),
+      _numHotBodiesInHotCodeCaches(0),
+      _hotCodeBytes(0),
+      _hotCodePages(0),
+      _lastHotCodePage(0)
       {
       _codeCacheManager = reinterpret_cast<TR::CodeCacheManager *>(this);
       }
@@ -87,7 +93,8 @@ public:
    TR::CodeCache * reserveCodeCache(bool compilationCodeAllocationsMustBeContiguous,
                                     size_t sizeEstimate,
                                     int32_t compThreadID,
-                                    int32_t *numReserved);
+                                    int32_t *numReserved,
+                                    bool hotCode = false);
 
    TR::CodeCacheMemorySegment *setupMemorySegmentFromRepository(uint8_t *start,
                                                                 uint8_t *end,
@@ -151,8 +158,45 @@ public:
     */
    void printOccupancyStats();
 
+   /**
+    * @brief Record the warm body of a method compiled at or above the hot
+    *        code cache level, for the iTLB footprint estimate.
+    *
+    * @param[in] codeCache : the code cache holding the body
+    * @param[in] startPC : start of the warm body
+    * @param[in] endWarmPC : end of the warm body
+    */
+   void recordHotBody(TR::CodeCache *codeCache, uint8_t *startPC, uint8_t *endWarmPC);
+
+   /**
+    * @brief Print the number of code pages spanned by hot method bodies,
+    *        an estimate of the iTLB entries they need.
+    */
+   void printHotCodeFootprint();
+
 private :
+   /**
+    * @brief Reserve a code cache while keeping hot bodies apart from the rest:
+    *        hot compilations go to the designated hot code cache, which is a
+    *        code cache allocated for that purpose, and all other compilations
+    *        avoid it, using a new code cache when every other one is reserved
+    *        or full. Returns NULL when no suitable code cache is available; only
+    *        hot compilations may then fall back to the default reservation.
+    */
+   TR::CodeCache *reserveCodeCacheForHotCodeLayout(bool hotCode,
+                                                   bool compilationCodeAllocationsMustBeContiguous,
+                                                   size_t sizeEstimate,
+                                                   int32_t compThreadID,
+                                                   int32_t *numReserved);
+
    TR_FrontEnd *_fe;
+
+   TR::CodeCache *_hotCodeCache;        // code cache currently receiving hot bodies
+   uint32_t _numHotBodies;
+   uint32_t _numHotBodiesInHotCodeCaches;
+   size_t _hotCodeBytes;
+   size_t _hotCodePages;
+   uintptr_t _lastHotCodePage;
    static TR::CodeCacheManager *_codeCacheManager;
    static J9JITConfig *_jitConfig;
    static J9JavaVM *_javaVM;
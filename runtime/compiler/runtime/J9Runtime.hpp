@@ -264,6 +264,9 @@ typedef struct TR_AOTStats
    TR_FailedPerfAssumptionCode failedPerfAssumptionCode;
 
    uint32_t numRelocationsFailedByType[TR_NumExternalRelocationKinds];
+   uint32_t numRelocationsAppliedByType[TR_NumExternalRelocationKinds];
+   uint32_t numRelocationsIgnoredByType[TR_NumExternalRelocationKinds];
+   uint64_t relocationTimeByType[TR_NumExternalRelocationKinds]; // in hires clock ticks, only with TR_EnableAOTStats
 
    } TR_AOTStats;
 
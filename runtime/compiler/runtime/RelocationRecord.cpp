@@ -154,16 +154,24 @@ TR_RelocationRecordGroup::applyRelocations(TR_RelocationRuntime *reloRuntime,
    TR_RelocationRecordBinaryTemplate *recordPointer = firstRecord(reloRuntime, reloTarget);
    TR_RelocationRecordBinaryTemplate *endOfRecords = pastLastRecord(reloTarget);
 
+   // Every record is applied here, before the body is installed; none is deferred to first
+   // execution. Timing every record is only worth its cost when the AOT stats are going to be printed
+   bool timeRecords = aotStats && reloRuntime->options()->getOption(TR_EnableAOTStats);
+   PORT_ACCESS_FROM_JAVAVM(reloRuntime->javaVM());
+
    while (recordPointer < endOfRecords)
       {
       TR_RelocationRecord storage;
+      uint8_t reloType = recordPointer->type(reloTarget);
+      U_64 recordStartTime = timeRecords ? j9time_hires_clock() : 0;
       // Create a specific type of relocation record based on the information
       // in the binary record pointed to by `recordPointer`
       TR_RelocationRecord *reloRecord = TR_RelocationRecord::create(&storage, reloRuntime, reloTarget, recordPointer);
       int32_t rc = handleRelocation(reloRuntime, reloTarget, reloRecord, reloOrigin);
+      if (timeRecords)
+         aotStats->relocationTimeByType[reloType] += j9time_hires_clock() - recordStartTime;
       if (rc != 0)
          {
-         uint8_t reloType = recordPointer->type(reloTarget);
          aotStats->numRelocationsFailedByType[reloType]++;
          return rc;
          }
@@ -188,11 +196,17 @@ TR_RelocationRecordGroup::handleRelocation(TR_RelocationRuntime *reloRuntime,
       {
       case TR_RelocationRecordAction::apply:
          {
+         reloRuntime->incNumRecordsApplied();
+         if (reloRuntime->aotStats())
+            reloRuntime->aotStats()->numRelocationsAppliedByType[reloRecord->type(reloTarget)]++;
          reloRecord->preparePrivateData(reloRuntime, reloTarget);
          return reloRecord->applyRelocationAtAllOffsets(reloRuntime, reloTarget, reloOrigin);
          }
       case TR_RelocationRecordAction::ignore:
          {
+         reloRuntime->incNumRecordsIgnored();
+         if (reloRuntime->aotStats())
+            reloRuntime->aotStats()->numRelocationsIgnoredByType[reloRecord->type(reloTarget)]++;
          RELO_LOG(reloRuntime->reloLogger(), 6, "\tignore!\n");
          return 0;
          }
@@ -141,6 +141,9 @@ TR_RelocationRuntime::TR_RelocationRuntime(J9JITConfig *jitCfg)
       }
 
       _isLoading = false;
+      _numRecordsApplied = 0;
+      _numRecordsIgnored = 0;
+      _recordsApplyTime = 0;
 
 #if defined(DEBUG) || defined(PROD_WITH_ASSUMES)
       _numValidations = 0;
@@ -446,6 +449,9 @@ TR_RelocationRuntime::relocateAOTCodeAndData(U_8 *tempDataStart,
    initializeCacheDeltas();
 
    _newMethodCodeStart = codeStart;
+   _numRecordsApplied = 0;
+   _numRecordsIgnored = 0;
+   _recordsApplyTime = 0;
 
    reloLogger()->relocationDump();
 
@@ -478,6 +484,9 @@ TR_RelocationRuntime::relocateAOTCodeAndData(U_8 *tempDataStart,
          RELO_LOG(reloLogger(), 6, "                        oldDataStart=%x codeStart=%x oldCodeStart=%x classReloAmount=%x cacheEntry=%x\n", oldDataStart, codeStart, oldCodeStart, classReloAmount(), cacheEntry);
          RELO_LOG(reloLogger(), 6, "                        tempDataStart: %p, _aotMethodHeaderEntry: %p, header offset: %x, binaryReloRecords: %p\n", tempDataStart, _aotMethodHeaderEntry, (UDATA)_aotMethodHeaderEntry-(UDATA)tempDataStart, binaryReloRecords);
 
+         PORT_ACCESS_FROM_JAVAVM(javaVM());
+         UDATA applyStartTime = j9time_usec_clock();
+
          try
             {
             _returnCode = reloGroup.applyRelocations(this, reloTarget(), newMethodCodeStart() + codeCacheDelta());
@@ -487,6 +496,8 @@ TR_RelocationRuntime::relocateAOTCodeAndData(U_8 *tempDataStart,
             _returnCode = compilationAotClassReloFailure;
             }
 
+         _recordsApplyTime = j9time_usec_clock() - applyStartTime;
+
          RELO_LOG(reloLogger(), 6, "relocateAOTCodeAndData: return code %d\n", _returnCode);
 
 #if defined(DEBUG) || defined(PROD_WITH_ASSUMES)
@@ -1075,6 +1086,11 @@ TR_SharedCacheRelocationRuntime::validateAOTHeader(TR_FrontEnd *fe, J9VMThread *
          incompatibleCache(J9NLS_RELOCATABLE_CODE_PROCESSING_COMPATIBILITY_FAILURE,
                            "AOT header validation failed: incompatible lockword options");
          }
+      else if (hdrInCache->fieldLayoutHintsHashValue != javaVM()->fieldLayoutHintsHash)
+         {
+         incompatibleCache(J9NLS_RELOCATABLE_CODE_PROCESSING_COMPATIBILITY_FAILURE,
+                           "AOT header validation failed: incompatible field layout hints");
+         }
       else if (hdrInCache->arrayLetLeafSize != TR::Compiler->om.arrayletLeafSize())
          {
          incompatibleCache(J9NLS_RELOCATABLE_CODE_PROCESSING_COMPATIBILITY_FAILURE,
@@ -1133,6 +1149,8 @@ TR_SharedCacheRelocationRuntime::createAOTHeader(TR_FrontEnd *fe)
       aotHeader->processorSignature = TR::Compiler->target.cpu.id();
       aotHeader->gcPolicyFlag = javaVM()->memoryManagerFunctions->j9gc_modron_getWriteBarrierType(javaVM());
       aotHeader->lockwordOptionHashValue = getCurrentLockwordOptionHashValue(javaVM());
+      // Instance field offsets depend on the -XX:FieldLayoutHints= file contents
+      aotHeader->fieldLayoutHintsHashValue = javaVM()->fieldLayoutHintsHash;
       aotHeader->compressedPointerShift = javaVM()->memoryManagerFunctions->j9gc_objaccess_compressedPointersShift(javaVM()->internalVMFunctions->currentVMThread(javaVM()));
 
       aotHeader->processorFeatureFlags = TR::Compiler->target.cpu.getProcessorFeatureFlags();
@@ -57,7 +57,7 @@ extern "C" {
  */
 
 #define TR_AOTHeaderMajorVersion 5
-#define TR_AOTHeaderMinorVersion 1
+#define TR_AOTHeaderMinorVersion 2
 #define TR_AOTHeaderEyeCatcher   0xA0757A27
 
 /* AOT Header Flags */
@@ -101,6 +101,7 @@ typedef struct TR_AOTHeader {
     uintptr_t gcPolicyFlag;
     uintptr_t compressedPointerShift;
     uint32_t lockwordOptionHashValue;
+    uint32_t fieldLayoutHintsHashValue;
     int32_t   arrayLetLeafSize;
     TR_ProcessorFeatureFlags processorFeatureFlags;
 } TR_AOTHeader;
@@ -156,6 +157,14 @@ class TR_RelocationRuntime {
       UDATA reloEndTime()                                         { return _reloEndTime; }
       void setReloEndTime(UDATA time)                             { _reloEndTime = time; }
 
+      // Per method counts of relocation records and the time spent applying them. Relocation is
+      // eager, so these measure the whole cost of the records paid when the method is loaded.
+      void incNumRecordsApplied()                                 { _numRecordsApplied++; }
+      void incNumRecordsIgnored()                                 { _numRecordsIgnored++; }
+      uint32_t getNumRecordsApplied()                             { return _numRecordsApplied; }
+      uint32_t getNumRecordsIgnored()                             { return _numRecordsIgnored; }
+      UDATA recordsApplyTime()                                    { return _recordsApplyTime; }
+
       int32_t returnCode()                                        { return _returnCode; }
       void setReturnCode(int32_t rc)                              { _returnCode = rc; }
 
@@ -319,6 +328,10 @@ class TR_RelocationRuntime {
       UDATA _reloStartTime;
       UDATA _reloEndTime;
 
+      uint32_t _numRecordsApplied;
+      uint32_t _numRecordsIgnored;
+      UDATA _recordsApplyTime;
+
       int32_t _returnCode;
 
       TR::Options *_options;
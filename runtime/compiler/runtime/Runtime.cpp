@@ -42,7 +42,9 @@
 #include "control/Recompilation.hpp"
 #include "control/RecompilationInfo.hpp"
 #include "env/jittypes.h"
+#include "infra/CriticalSection.hpp"
 #include "runtime/CodeCacheManager.hpp"
+#include "runtime/DataCache.hpp"
 #include "runtime/RuntimeAssumptions.hpp"
 #include "runtime/asmprotos.h"
 #include "runtime/codertinit.hpp"
@@ -1942,6 +1944,13 @@ extern "C" void jitReportDynamicCodeLoadEvents(J9VMThread *currentThread)
    J9JavaVM *vm = currentThread->javaVM;
    if (J9_EVENT_IS_HOOKED(vm->hookInterface, J9HOOK_VM_DYNAMIC_CODE_LOAD))
       {
+      TR::CodeCacheManager *codeCacheManager = TR::CodeCacheManager::instance();
+      codeCacheManager->reportCodeLoadEvents();
+
+      // The data cache pool merges freed records and releases empty segments under the
+      // data cache mutex, which can happen on a compilation thread during this walk.
+      // The code caches are reported first so their list lock is not taken while it is held.
+      OMR::CriticalSection walkingDataCaches(TR_DataCacheManager::getManager()->getMutex());
       J9MemorySegment *dataCache = vm->jitConfig->dataCacheList->nextSegment;
       J9JITConfig *jitConfig = vm->jitConfig;
       while (dataCache)
@@ -1994,9 +2003,6 @@ extern "C" void jitReportDynamicCodeLoadEvents(J9VMThread *currentThread)
             }
          dataCache = dataCache->nextSegment;
          }
-
-      TR::CodeCacheManager *codeCacheManager = TR::CodeCacheManager::instance();
-      codeCacheManager->reportCodeLoadEvents();
       }
    }
 
@@ -177,10 +177,13 @@ TR_PersistentCHTable::classGotUnloadedPost(
       TR_VerboseLog::writeLineLocked(TR_Vlog_HD, "subClasses clean up for unloaded class 0x%p \n", classId);
       }
 
+   UpdateTimer timer(this, fe, ClassUnloadUpdate);
    cl = findClassInfo(classId);
    classDepth = TR::Compiler->cls.classDepthOf(classId) - 1;
    uintptrj_t hashPos = TR_RuntimeAssumptionTable::hashCode((uintptrj_t)classId) % CLASSHASHTABLE_SIZE;
+   beginUpdate();
    _classes[hashPos].remove(cl);
+   endUpdate();
 
    if ((classDepth >= 0) &&
        (cl->isInitialized() || fej9->isInterfaceClass(classId)))
@@ -227,59 +230,105 @@ TR_PersistentCHTable::classGotExtended(
       TR_OpaqueClassBlock *superClassId,
       TR_OpaqueClassBlock *subClassId)
    {
-   TR_PersistentClassInfo * cl = findClassInfo(superClassId);
+   return superClassesGotExtended(fe, persistentMemory, &superClassId, 1, subClassId);
+   }
+
+
+/* Record that subClassId extends or implements every class in superClassIds.
+   The class load hook reports the superclass and all interfaces at once so
+   the subclass is looked up once and the assumption table mutex is taken
+   once for the whole batch rather than once per superclass.
+*/
+bool
+TR_PersistentCHTable::superClassesGotExtended(
+      TR_FrontEnd *fe,
+      TR_PersistentMemory *persistentMemory,
+      TR_OpaqueClassBlock **superClassIds,
+      int32_t numSuperClasses,
+      TR_OpaqueClassBlock *subClassId)
+   {
+   UpdateTimer timer(this, fe, ClassExtendUpdate);
    TR_PersistentClassInfo * subClass = findClassInfo(subClassId); // This is actually the class that got loaded extending the superclass
+   bool extended = true;
+   int32_t numExtended = 0;
+
+   for (int32_t i = 0; i < numSuperClasses; i++)
+      {
+      TR_OpaqueClassBlock *superClassId = superClassIds[i];
+      TR_PersistentClassInfo * cl = findClassInfo(superClassId);
 #if defined(JITSERVER_SUPPORT)
-   TR::CompilationInfo::get()->classGotNewlyExtended(superClassId);
+      TR::CompilationInfo::get()->classGotNewlyExtended(superClassId);
 #endif
-   // should have an assume0(cl && subClass) here - but assume does not work rt-code
+      // should have an assume0(cl && subClass) here - but assume does not work rt-code
 
-   TR_SubClass *sc = cl->addSubClass(subClass); // Updating the hierarchy
+      TR_SubClass *sc = cl->addSubClass(subClass); // Updating the hierarchy
 
-   if (!sc)
-      return false;
+      if (!sc)
+         {
+         extended = false;
+         continue;
+         }
 
-   TR_RuntimeAssumptionTable *table = persistentMemory->getPersistentInfo()->getRuntimeAssumptionTable();
-   if (cl->shouldNotBeNewlyExtended())
-      {
-      TR::CompilationInfo *compInfo = TR::CompilationInfo::get();
-      uint8_t mask = cl->getShouldNotBeNewlyExtendedMask().getValue();
-      for (int32_t ID = 0; mask; mask>>=1, ++ID)
+      if (cl->shouldNotBeNewlyExtended())
          {
-         if (mask & 0x1)
+         TR::CompilationInfo *compInfo = TR::CompilationInfo::get();
+         uint8_t mask = cl->getShouldNotBeNewlyExtendedMask().getValue();
+         for (int32_t ID = 0; mask; mask>>=1, ++ID)
             {
-            // Determine the compilation thread that has this ID
-            // and set the fail flag into its corresponding compilation object
-            TR::Compilation *comp = compInfo->getCompilationWithID(ID);
-            if (comp)
-               comp->setFailCHTableCommit(true);
-            else
+            if (mask & 0x1)
                {
-               // The compilation that set the bit has vanished
-               // This can actually happen due to IPA which does not add the class
-               // to the list of classes that should not be newly extended
-               //TR_ASSERT(false, "Compilation has vanished class %p", superClassId);
+               // Determine the compilation thread that has this ID
+               // and set the fail flag into its corresponding compilation object
+               TR::Compilation *comp = compInfo->getCompilationWithID(ID);
+               if (comp)
+                  comp->setFailCHTableCommit(true);
+               else
+                  {
+                  // The compilation that set the bit has vanished
+                  // This can actually happen due to IPA which does not add the class
+                  // to the list of classes that should not be newly extended
+                  //TR_ASSERT(false, "Compilation has vanished class %p", superClassId);
+                  }
                }
             }
+         cl->clearShouldNotBeNewlyExtended(); // flags are not needed anymore
          }
-      cl->clearShouldNotBeNewlyExtended(); // flags are not needed anymore
+
+      // Compact the successfully extended classes so that only their
+      // assumptions get compensated below
+      superClassIds[numExtended++] = superClassId;
       }
 
+   if (numExtended == 0)
+      return extended;
+
+   TR_RuntimeAssumptionTable *table = persistentMemory->getPersistentInfo()->getRuntimeAssumptionTable();
       {
       OMR::CriticalSection classGotExtended(assumptionTableMutex);
-      OMR::RuntimeAssumption ** headPtr = table->getBucketPtr(RuntimeAssumptionOnClassExtend,
-                                         TR_RuntimeAssumptionTable::hashCode((uintptrj_t) superClassId));
-      for (OMR::RuntimeAssumption *cursor = *headPtr; cursor; cursor = cursor->getNext())
+      OMR::RuntimeAssumption *batch[RAT_PATCH_BATCH_SIZE];
+      int32_t batchSize = 0;
+      for (int32_t i = 0; i < numExtended; i++)
          {
-         if (cursor->matches((uintptrj_t) superClassId))
+         TR_OpaqueClassBlock *superClassId = superClassIds[i];
+         OMR::RuntimeAssumption ** headPtr = table->getBucketPtr(RuntimeAssumptionOnClassExtend,
+                                            TR_RuntimeAssumptionTable::hashCode((uintptrj_t) superClassId));
+         for (OMR::RuntimeAssumption *cursor = *headPtr; cursor; cursor = cursor->getNext())
             {
-            cursor->compensate(fe, 0, 0);
-            removeAssumptionFromRAT(cursor);
+            if (cursor->matches((uintptrj_t) superClassId))
+               {
+               if (batchSize == RAT_PATCH_BATCH_SIZE)
+                  {
+                  table->compensateBatch(fe, batch, batchSize);
+                  batchSize = 0;
+                  }
+               batch[batchSize++] = cursor;
+               }
             }
          }
+      table->compensateBatch(fe, batch, batchSize);
       }
 
-   return true;
+   return extended;
    }
 
 
@@ -335,7 +384,9 @@ TR_PersistentCHTable::removeClass(
 
    if (removeInfo)
       {
+      beginUpdate();
       _classes[hashPos].remove(info);
+      endUpdate();
       jitPersistentFree(info);
       }
    }
@@ -363,15 +414,22 @@ TR_PersistentCHTable::classGotInitialized(
       OMR::CriticalSection classGotInitialized(assumptionTableMutex);
       TR_RuntimeAssumptionTable *table = persistentMemory->getPersistentInfo()->getRuntimeAssumptionTable();
       OMR::RuntimeAssumption ** headPtr = table->getBucketPtr(RuntimeAssumptionOnClassPreInitialize, TR_PatchNOPedGuardSiteOnClassPreInitialize::hashCode(sig, sigLen));
+      OMR::RuntimeAssumption *batch[RAT_PATCH_BATCH_SIZE];
+      int32_t batchSize = 0;
 
       for (OMR::RuntimeAssumption *cursor = *headPtr; cursor; cursor = cursor->getNext())
          {
          if (cursor->matches(sig, sigLen))
             {
-            cursor->compensate(fej9, 0, 0);
-            removeAssumptionFromRAT(cursor);
+            if (batchSize == RAT_PATCH_BATCH_SIZE)
+               {
+               table->compensateBatch(fej9, batch, batchSize);
+               batchSize = 0;
+               }
+            batch[batchSize++] = cursor;
             }
          }
+      table->compensateBatch(fej9, batch, batchSize);
       }
 
    return true;
@@ -407,6 +465,7 @@ TR_PersistentCHTable::classGotRedefined(
       TR_OpaqueClassBlock *oldClassId,
       TR_OpaqueClassBlock *newClassId)
    {
+   UpdateTimer timer(this, fe, ClassRedefineUpdate);
    TR_PersistentClassInfo *oldClass = findClassInfo(oldClassId);
 
    OMR::CriticalSection classGotRedefined(assumptionTableMutex);
@@ -434,6 +493,7 @@ TR_PersistentCHTable::classGotRedefined(
    TR_PersistentClassInfo *newClass = findClassInfo(newClassId);
    uintptrj_t oldIndex = TR_RuntimeAssumptionTable::hashCode((uintptrj_t)oldClassId) % CLASSHASHTABLE_SIZE;
    uintptrj_t newIndex = TR_RuntimeAssumptionTable::hashCode((uintptrj_t)newClassId) % CLASSHASHTABLE_SIZE;
+   beginUpdate();
    _classes[oldIndex].remove(oldClass);
    oldClass->setClassId(newClassId);
    _classes[newIndex].add(oldClass);
@@ -447,6 +507,7 @@ TR_PersistentCHTable::classGotRedefined(
       newClass->setClassId(oldClassId);
       _classes[oldIndex].add(newClass);
       }
+   endUpdate();
    }
 
 
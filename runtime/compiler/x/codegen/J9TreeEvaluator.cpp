@@ -9431,6 +9431,246 @@ static TR::Register* inlineIntrinsicIndexOf(TR::Node* node, TR::CodeGenerator* c
    return result;
    }
 
+/**
+ * \brief
+ *   Generate inlined instructions equivalent to java/lang/StringLatin1.indexOf, java/lang/StringUTF16.indexOf,
+ *   com/ibm/jit/JITHelpers.intrinsicIndexOfStringLatin1 or com/ibm/jit/JITHelpers.intrinsicIndexOfStringUTF16
+ *
+ * \param node
+ *   The tree node
+ *
+ * \param cg
+ *   The Code Generator
+ *
+ * \param isLatin1
+ *   True when the strings are Latin1, False when the strings are UTF16
+ *
+ * \details
+ *   The arguments are (s1Value, s1Length, s2Value, s2Length, fromIndex), following an optional receiver, with
+ *   0 <= fromIndex and 0 < s2Length. Each 16 byte block of s1 is compared against the first and the last
+ *   character of s2, and only the positions where both match are compared in full. Positions left over
+ *   after the last whole block are tested one at a time. No memory beyond the end of s1 is read.
+ *
+ * Note that this version does not support discontiguous arrays
+ */
+static TR::Register* inlineIntrinsicStringIndexOf(TR::Node* node, TR::CodeGenerator* cg, bool isLatin1)
+   {
+   static uint8_t MASKOFSIZEONE[] =
+      {
+      0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00,
+      };
+   static uint8_t MASKOFSIZETWO[] =
+      {
+      0x00, 0x01, 0x00, 0x01,
+      0x00, 0x01, 0x00, 0x01,
+      0x00, 0x01, 0x00, 0x01,
+      0x00, 0x01, 0x00, 0x01,
+      };
+
+   const uint8_t width = 16;
+   const uint8_t shift = isLatin1 ? 0 : 1;
+   const int32_t headerSize = TR::Compiler->om.contiguousArrayHeaderSizeInBytes();
+   uint8_t* shuffleMask = isLatin1 ? MASKOFSIZEONE : MASKOFSIZETWO;
+   auto compareOp = isLatin1 ? PCMPEQBRegReg : PCMPEQWRegReg;
+   auto loadOp = isLatin1 ? L1RegMem : L2RegMem;
+   auto charCompareOp = isLatin1 ? CMP1RegMem : CMP2RegMem;
+
+   // StringLatin1/StringUTF16.indexOf are static, the JITHelpers intrinsics have a receiver
+   const bool isStaticCall = node->getSymbolReference()->getSymbol()->castToMethodSymbol()->isStatic();
+   const uint8_t firstCallArgIdx = isStaticCall ? 0 : 1;
+
+   auto s1Value = cg->evaluate(node->getChild(firstCallArgIdx));
+   auto s1Length = cg->evaluate(node->getChild(firstCallArgIdx + 1));
+   auto s2Value = cg->evaluate(node->getChild(firstCallArgIdx + 2));
+   auto s2Length = cg->evaluate(node->getChild(firstCallArgIdx + 3));
+   auto fromIndex = cg->evaluate(node->getChild(firstCallArgIdx + 4));
+
+   auto result = cg->allocateRegister();
+   auto lastIndex = cg->allocateRegister();
+   auto lastOffset = cg->allocateRegister();
+   auto address = cg->allocateRegister();
+   auto mask = cg->allocateRegister();
+   auto candidate = cg->allocateRegister();
+   auto matchAddress = cg->allocateRegister();
+   auto matchOffset = cg->allocateRegister();
+   auto scratch = cg->allocateRegister();
+   auto firstXMM = cg->allocateRegister(TR_VRF);
+   auto lastXMM = cg->allocateRegister(TR_VRF);
+   auto s1FirstXMM = cg->allocateRegister(TR_VRF);
+   auto s1LastXMM = cg->allocateRegister(TR_VRF);
+
+   auto dependencies = generateRegisterDependencyConditions((uint8_t)15, (uint8_t)15, cg);
+   dependencies->addPreCondition(s1Value, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(s2Value, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(result, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(lastIndex, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(lastOffset, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(address, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(mask, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(candidate, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(matchAddress, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(matchOffset, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(scratch, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(firstXMM, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(lastXMM, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(s1FirstXMM, TR::RealRegister::NoReg, cg);
+   dependencies->addPreCondition(s1LastXMM, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(s1Value, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(s2Value, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(result, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(lastIndex, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(lastOffset, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(address, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(mask, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(candidate, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(matchAddress, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(matchOffset, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(scratch, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(firstXMM, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(lastXMM, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(s1FirstXMM, TR::RealRegister::NoReg, cg);
+   dependencies->addPostCondition(s1LastXMM, TR::RealRegister::NoReg, cg);
+
+   auto begLabel = generateLabelSymbol(cg);
+   auto endLabel = generateLabelSymbol(cg);
+   auto blockLoopLabel = generateLabelSymbol(cg);
+   auto candidateLoopLabel = generateLabelSymbol(cg);
+   auto blockMatchLoopLabel = generateLabelSymbol(cg);
+   auto nextCandidateLabel = generateLabelSymbol(cg);
+   auto nextBlockLabel = generateLabelSymbol(cg);
+   auto tailLabel = generateLabelSymbol(cg);
+   auto tailLoopLabel = generateLabelSymbol(cg);
+   auto tailMatchLoopLabel = generateLabelSymbol(cg);
+   auto nextTailLabel = generateLabelSymbol(cg);
+   auto foundLabel = generateLabelSymbol(cg);
+   auto notFoundLabel = generateLabelSymbol(cg);
+   begLabel->setStartInternalControlFlow();
+   endLabel->setEndInternalControlFlow();
+
+   // lastIndex is the last index of s1 at which s2 can start, lastOffset is the byte offset of the last character of s2
+   generateRegRegInstruction(MOV4RegReg, node, result, fromIndex, cg);
+   generateRegRegInstruction(MOV4RegReg, node, lastIndex, s1Length, cg);
+   generateRegRegInstruction(SUB4RegReg, node, lastIndex, s2Length, cg);
+   generateRegRegInstruction(MOV4RegReg, node, lastOffset, s2Length, cg);
+   generateRegImmInstruction(SUB4RegImms, node, lastOffset, 1, cg);
+   if (shift)
+      {
+      generateRegRegInstruction(ADD4RegReg, node, lastOffset, lastOffset, cg);
+      }
+
+   generateLabelInstruction(LABEL, node, begLabel, cg);
+   generateRegRegInstruction(CMP4RegReg, node, result, lastIndex, cg);
+   generateLabelInstruction(JG4, node, notFoundLabel, cg);
+
+   // Broadcast the first and the last character of s2
+   generateRegMemInstruction(loadOp, node, scratch, generateX86MemoryReference(s2Value, headerSize, cg), cg);
+   generateRegRegInstruction(MOVDRegReg4, node, firstXMM, scratch, cg);
+   generateRegMemInstruction(PSHUFBRegMem, node, firstXMM, generateX86MemoryReference(cg->findOrCreate16ByteConstant(node, shuffleMask), cg), cg);
+   generateRegMemInstruction(loadOp, node, scratch, generateX86MemoryReference(s2Value, lastOffset, 0, headerSize, cg), cg);
+   generateRegRegInstruction(MOVDRegReg4, node, lastXMM, scratch, cg);
+   generateRegMemInstruction(PSHUFBRegMem, node, lastXMM, generateX86MemoryReference(cg->findOrCreate16ByteConstant(node, shuffleMask), cg), cg);
+
+   // Whole blocks may be scanned while a block starting at result ends at or before lastIndex
+   generateRegImmInstruction(SUB4RegImms, node, lastIndex, (width >> shift) - 1, cg);
+
+   generateLabelInstruction(LABEL, node, blockLoopLabel, cg);
+   generateRegRegInstruction(CMP4RegReg, node, result, lastIndex, cg);
+   generateLabelInstruction(JG4, node, tailLabel, cg);
+   generateRegMemInstruction(LEARegMem(), node, address, generateX86MemoryReference(s1Value, result, shift, headerSize, cg), cg);
+   generateRegMemInstruction(MOVDQURegMem, node, s1FirstXMM, generateX86MemoryReference(address, 0, cg), cg);
+   generateRegMemInstruction(MOVDQURegMem, node, s1LastXMM, generateX86MemoryReference(address, lastOffset, 0, 0, cg), cg);
+   generateRegRegInstruction(compareOp, node, s1FirstXMM, firstXMM, cg);
+   generateRegRegInstruction(compareOp, node, s1LastXMM, lastXMM, cg);
+   generateRegRegInstruction(PANDRegReg, node, s1FirstXMM, s1LastXMM, cg);
+   generateRegRegInstruction(PMOVMSKB4RegReg, node, mask, s1FirstXMM, cg);
+
+   // Compare s2 in full at each position where its first and last characters match
+   generateLabelInstruction(LABEL, node, candidateLoopLabel, cg);
+   generateRegRegInstruction(TEST4RegReg, node, mask, mask, cg);
+   generateLabelInstruction(JE4, node, nextBlockLabel, cg);
+   generateRegRegInstruction(BSF4RegReg, node, candidate, mask, cg);
+   generateRegMemInstruction(LEARegMem(), node, matchAddress, generateX86MemoryReference(address, candidate, 0, 0, cg), cg);
+   generateRegRegInstruction(XOR4RegReg, node, matchOffset, matchOffset, cg);
+   generateLabelInstruction(LABEL, node, blockMatchLoopLabel, cg);
+   generateRegMemInstruction(loadOp, node, scratch, generateX86MemoryReference(matchAddress, matchOffset, 0, 0, cg), cg);
+   generateRegMemInstruction(charCompareOp, node, scratch, generateX86MemoryReference(s2Value, matchOffset, 0, headerSize, cg), cg);
+   generateLabelInstruction(JNE4, node, nextCandidateLabel, cg);
+   generateRegImmInstruction(ADD4RegImms, node, matchOffset, 1 << shift, cg);
+   generateRegRegInstruction(CMP4RegReg, node, matchOffset, lastOffset, cg);
+   generateLabelInstruction(JLE4, node, blockMatchLoopLabel, cg);
+   if (shift)
+      {
+      generateRegImmInstruction(SHR4RegImm1, node, candidate, shift, cg);
+      }
+   generateRegRegInstruction(ADD4RegReg, node, result, candidate, cg);
+   generateLabelInstruction(JMP4, node, foundLabel, cg);
+
+   // Each UTF16 character sets two bits of the mask
+   generateLabelInstruction(LABEL, node, nextCandidateLabel, cg);
+   for (uint8_t i = 0; i <= shift; i++)
+      {
+      generateRegMemInstruction(LEA4RegMem, node, scratch, generateX86MemoryReference(mask, -1, cg), cg);
+      generateRegRegInstruction(AND4RegReg, node, mask, scratch, cg);
+      }
+   generateLabelInstruction(JMP4, node, candidateLoopLabel, cg);
+
+   generateLabelInstruction(LABEL, node, nextBlockLabel, cg);
+   generateRegImmInstruction(ADD4RegImms, node, result, width >> shift, cg);
+   generateLabelInstruction(JMP4, node, blockLoopLabel, cg);
+
+   // Test the remaining positions one at a time
+   generateLabelInstruction(LABEL, node, tailLabel, cg);
+   generateRegImmInstruction(ADD4RegImms, node, lastIndex, (width >> shift) - 1, cg);
+   generateLabelInstruction(LABEL, node, tailLoopLabel, cg);
+   generateRegRegInstruction(CMP4RegReg, node, result, lastIndex, cg);
+   generateLabelInstruction(JG4, node, notFoundLabel, cg);
+   generateRegMemInstruction(LEARegMem(), node, matchAddress, generateX86MemoryReference(s1Value, result, shift, headerSize, cg), cg);
+   generateRegRegInstruction(XOR4RegReg, node, matchOffset, matchOffset, cg);
+   generateLabelInstruction(LABEL, node, tailMatchLoopLabel, cg);
+   generateRegMemInstruction(loadOp, node, scratch, generateX86MemoryReference(matchAddress, matchOffset, 0, 0, cg), cg);
+   generateRegMemInstruction(charCompareOp, node, scratch, generateX86MemoryReference(s2Value, matchOffset, 0, headerSize, cg), cg);
+   generateLabelInstruction(JNE4, node, nextTailLabel, cg);
+   generateRegImmInstruction(ADD4RegImms, node, matchOffset, 1 << shift, cg);
+   generateRegRegInstruction(CMP4RegReg, node, matchOffset, lastOffset, cg);
+   generateLabelInstruction(JLE4, node, tailMatchLoopLabel, cg);
+   generateLabelInstruction(JMP4, node, foundLabel, cg);
+   generateLabelInstruction(LABEL, node, nextTailLabel, cg);
+   generateRegImmInstruction(ADD4RegImms, node, result, 1, cg);
+   generateLabelInstruction(JMP4, node, tailLoopLabel, cg);
+
+   generateLabelInstruction(LABEL, node, notFoundLabel, cg);
+   generateRegImmInstruction(MOV4RegImm4, node, result, -1, cg);
+   generateLabelInstruction(LABEL, node, foundLabel, cg);
+   generateLabelInstruction(LABEL, node, endLabel, dependencies, cg);
+
+   cg->stopUsingRegister(lastIndex);
+   cg->stopUsingRegister(lastOffset);
+   cg->stopUsingRegister(address);
+   cg->stopUsingRegister(mask);
+   cg->stopUsingRegister(candidate);
+   cg->stopUsingRegister(matchAddress);
+   cg->stopUsingRegister(matchOffset);
+   cg->stopUsingRegister(scratch);
+   cg->stopUsingRegister(firstXMM);
+   cg->stopUsingRegister(lastXMM);
+   cg->stopUsingRegister(s1FirstXMM);
+   cg->stopUsingRegister(s1LastXMM);
+
+   node->setRegister(result);
+   if (!isStaticCall)
+      {
+      cg->recursivelyDecReferenceCount(node->getChild(0));
+      }
+   for (uint8_t i = firstCallArgIdx; i < firstCallArgIdx + 5; i++)
+      {
+      cg->decReferenceCount(node->getChild(i));
+      }
+   return result;
+   }
+
 /**
  * \brief
  *   Generate inlined instructions equivalent to sun/misc/Unsafe.compareAndSwapObject or jdk/internal/misc/Unsafe.compareAndSwapObject
@@ -11625,6 +11865,22 @@ J9::X86::TreeEvaluator::directCallEvaluator(TR::Node *node, TR::CodeGenerator *c
          break;
       }
 
+   // The substring search keeps more values live than 32-bit x86 has registers for
+   if (cg->getSupportsInlineStringIndexOf() && TR::Compiler->target.is64Bit())
+      {
+      switch (symbol->getRecognizedMethod())
+         {
+         case TR::java_lang_StringLatin1_indexOf:
+         case TR::com_ibm_jit_JITHelpers_intrinsicIndexOfStringLatin1:
+            return inlineIntrinsicStringIndexOf(node, cg, true);
+         case TR::java_lang_StringUTF16_indexOf:
+         case TR::com_ibm_jit_JITHelpers_intrinsicIndexOfStringUTF16:
+            return inlineIntrinsicStringIndexOf(node, cg, false);
+         default:
+            break;
+         }
+      }
+
    if (cg->getSupportsInlineStringCaseConversion())
       {
       switch (symbol->getRecognizedMethod())
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "x/runtime/X86HWProfiler.hpp"
+
+#include "j9cfg.h"
+#include "util_api.h"
+#include "codegen/FrontEnd.hpp"
+#include "control/CompilationRuntime.hpp"
+#include "control/Recompilation.hpp"
+#include "control/RecompilationInfo.hpp"
+#include "env/jittypes.h"
+#include "env/VMJ9.h"
+#include "env/VerboseLog.hpp"
+#include "x/runtime/X86HWProfilerPrivate.hpp"
+
+TR_X86HWProfiler::TR_X86HWProfiler(J9JITConfig *jitConfig)
+   : TR_HWProfiler(jitConfig),
+     _x86HWProfilerBufferMemoryAllocated(0), _x86HWProfilerBufferMaximumMemory(TR::Options::_hwprofilerRIBufferPoolSize),
+     _useSoftwareEvent(false),
+     _STATS_SamplesLost(0),
+     _STATS_ThreadsUsingSoftwareEvent(0)
+   {}
+
+bool
+TR_X86HWProfiler::isThreadInitialized(J9VMThread *vmThread)
+   {
+   // Don't use TR_J9VMBase::get() here, it would allocate a front end for threads that never had one
+   TR_J9VMBase *fe = (TR_J9VMBase *)vmThread->jitVMwithThreadInfo;
+   return fe && fe->_hwProfilerContext;
+   }
+
+void
+TR_X86HWProfiler::processBufferRecords(J9VMThread *vmThread, uint8_t *bufferStart, uintptrj_t size, uintptrj_t bufferFilledSize, uint32_t dataTag)
+   {
+   uintptr_t *samples    = (uintptr_t *)bufferStart;
+   uint32_t   numSamples = bufferFilledSize / sizeof(uintptr_t);
+   uint32_t   numJittedSamples = 0;
+   TR_FrontEnd *fe       = TR_J9VMBase::get(_jitConfig, vmThread);
+   bool recompilationEnabled = false;
+   TR::CompilationInfo *compInfo = TR::CompilationInfo::get(_jitConfig);
+
+   if (compInfo->getPersistentInfo()->isRuntimeInstrumentationRecompilationEnabled()
+       && vmThread != NULL
+       && fe != NULL)
+      {
+      recompilationEnabled = true;
+      }
+
+   // Samples arrive in bursts from the same hot loop, so the previous body is the most likely match
+   J9JITExceptionTable *lastMetaData = NULL;
+   J9JITExceptionTable *metaData;
+   for (uint32_t i = 0; i < numSamples; ++i)
+      {
+      uintptr_t ip = samples[i];
+      if (lastMetaData && ip >= lastMetaData->startPC && ip <= lastMetaData->endPC)
+         {
+         metaData = lastMetaData;
+         }
+      else
+         {
+         metaData = jit_artifact_search(_jitConfig->translationArtifacts, ip);
+         if (!metaData)
+            continue;
+         lastMetaData = metaData;
+         }
+
+      ++numJittedSamples;
+
+      TR::Recompilation::hwpGlobalSampleCount++;
+      if (recompilationEnabled && metaData->bodyInfo != NULL)
+         {
+         TR_PersistentJittedBodyInfo *bodyInfo = (TR_PersistentJittedBodyInfo *) metaData->bodyInfo;
+
+         bodyInfo->_hwpInstructionCount++;
+         if (recompilationLogic(bodyInfo,
+                                (void *) metaData->startPC,
+                                bodyInfo->_hwpInstructionStartCount,
+                                bodyInfo->_hwpInstructionCount,
+                                TR::Recompilation::hwpGlobalSampleCount,
+                                fe,
+                                vmThread))
+            {
+            // Start a new interval
+            bodyInfo->_hwpInstructionStartCount   = TR::Recompilation::hwpGlobalSampleCount;
+            bodyInfo->_hwpInstructionCount        = 0;
+            }
+         }
+      }
+
+   _STATS_TotalEntriesProcessed += numSamples;
+   _STATS_TotalInstructionsTracked += numJittedSamples;
+
+   if (bufferFilledSize >= size)
+      _numBuffersCompletelyFilled++;
+
+   _bufferSizeSum += size;
+   _bufferFilledSum += bufferFilledSize;
+   ++_STATS_TotalBuffersProcessed;
+   }
+
+void *
+TR_X86HWProfiler::allocateBuffer(uint64_t size)
+   {
+   void * temp = NULL;
+
+   if (_hwProfilerMonitor)
+      {
+      if (_hwProfilerMonitor->try_enter())
+         return NULL;
+
+      // First try to get a buffer from the free list
+      HWProfilerBuffer *newHWProfilerBuffer = _freeBufferList.pop();
+      if (newHWProfilerBuffer)
+         {
+         temp = (void *)newHWProfilerBuffer->getBuffer();
+         TR_Memory::jitPersistentFree(newHWProfilerBuffer);
+         }
+      // Try to allocate a buffer from jitPersistentAlloc
+      else if (_x86HWProfilerBufferMemoryAllocated + size < _x86HWProfilerBufferMaximumMemory)
+         {
+         _x86HWProfilerBufferMemoryAllocated += size;
+         temp = (void*)TR_Memory::jitPersistentAlloc(size, TR_Memory::HWProfile);
+         }
+
+      _hwProfilerMonitor->exit();
+      }
+
+   return temp;
+   }
+
+void
+TR_X86HWProfiler::freeBuffer(void *buffer, uint64_t size)
+   {
+   if (_hwProfilerMonitor)
+      {
+      _hwProfilerMonitor->enter();
+
+      // Put the buffers into the free list for another thread
+      HWProfilerBuffer *newHWProfilerBuffer = (HWProfilerBuffer*)TR_Memory::jitPersistentAlloc(sizeof(HWProfilerBuffer));
+      if (newHWProfilerBuffer)
+         {
+         newHWProfilerBuffer->setBuffer((U_8*)buffer);
+         newHWProfilerBuffer->setSize(size);
+         newHWProfilerBuffer->setIsInvalidated(false);
+
+         _freeBufferList.add(newHWProfilerBuffer);
+         }
+
+      _hwProfilerMonitor->exit();
+      }
+   }
+
+void
+TR_X86HWProfiler::printStats()
+   {
+   printf("\n");
+   printf("X86 HW profiler buffer memory allocated = %llu B\n", (unsigned long long)_x86HWProfilerBufferMemoryAllocated);
+   printf("Samples lost by the kernel or dropped = %llu\n", (unsigned long long)_STATS_SamplesLost);
+   printf("Threads sampling the software task clock = %u\n", _STATS_ThreadsUsingSoftwareEvent);
+   TR_HWProfiler::printStats();
+   }
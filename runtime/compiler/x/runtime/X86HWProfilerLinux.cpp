@@ -0,0 +1,258 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9cfg.h"
+#include "x/runtime/X86HWProfiler.hpp"
+#include "x/runtime/X86HWProfilerPrivate.hpp"
+#include "control/CompilationThread.hpp"
+#include "env/VMJ9.h"
+#include "env/VerboseLog.hpp"
+
+#include <errno.h>
+#include <string.h>
+#include <syscall.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <linux/perf_event.h>
+
+TR_X86HWProfiler *
+TR_X86HWProfiler::allocate(J9JITConfig *jitConfig)
+   {
+   TR_X86HWProfiler *profiler = new (PERSISTENT_NEW) TR_X86HWProfiler(jitConfig);
+   VERBOSE("HWProfiler initialized.");
+   return profiler;
+   }
+
+static int
+openSamplingEvent(struct perf_event_attr *pe, uint32_t type, uint64_t config)
+   {
+   pe->type = type;
+   pe->config = config;
+   // pid 0, cpu -1: follow the calling thread on whichever CPU it runs
+   return syscall(SYS_perf_event_open, pe, 0, -1, -1, 0);
+   }
+
+bool
+TR_X86HWProfiler::initializeThread(J9VMThread *vmThread)
+   {
+   TR_J9VMBase *fe = TR_J9VMBase::get(_jitConfig, vmThread);
+   if (fe->_hwProfilerContext)
+      return true;
+
+   // If we've already hit our memory budget don't even try to go further
+   if (_x86HWProfilerBufferMemoryAllocated >= _x86HWProfilerBufferMaximumMemory)
+      return false;
+
+   TR_X86HWProfilerContext *context = NULL;
+   struct perf_event_attr   pe;
+   int                      fd = -1;
+   void                    *mapping = MAP_FAILED;
+   uintptr_t               *samples = NULL;
+   bool                     setUnavailableOnFail = true;
+   const uint64_t           pageSize = sysconf(_SC_PAGESIZE);
+   const uint64_t           dataSize = X86HWP_RING_DATA_PAGES * pageSize;
+   const uint64_t           mmapSize = dataSize + pageSize;
+   const uint32_t           maxSamples = dataSize / X86HWP_SAMPLE_RECORD_SIZE;
+
+   memset(&pe, 0, sizeof(struct perf_event_attr));
+   pe.size = sizeof(struct perf_event_attr);
+   // Cycles when counting on the PMU, nanoseconds of thread CPU time when on the task clock
+   pe.sample_period = TR::Options::_hwprofilerPRISamplingRate;
+   pe.sample_type = PERF_SAMPLE_IP;
+   pe.exclude_kernel = 1;
+   pe.exclude_hv = 1;
+   pe.exclude_idle = 1;
+
+   if (!_useSoftwareEvent)
+      {
+      fd = openSamplingEvent(&pe, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+      if (fd < 0)
+         {
+         // Most hypervisors don't virtualize the PMU; every later thread will hit the same error
+         VERBOSE("Failed to open cycle counter for J9VMThread=%p, errno: %d, perf_event_open : %s. Falling back to the software task clock.", vmThread, errno, strerror(errno));
+         _useSoftwareEvent = true;
+         }
+      }
+
+   if (fd < 0)
+      {
+      fd = openSamplingEvent(&pe, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK);
+      if (fd < 0)
+         {
+         VERBOSE("Failed to open task clock for J9VMThread=%p, errno: %d, perf_event_open : %s.", vmThread, errno, strerror(errno));
+         // Running out of descriptors is transient; anything else (e.g. perf_event_paranoid) is not
+         setUnavailableOnFail = (EMFILE != errno) && (ENFILE != errno);
+         goto fail;
+         }
+      ++_STATS_ThreadsUsingSoftwareEvent;
+      }
+
+   mapping = mmap(NULL, mmapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   if (MAP_FAILED == mapping)
+      {
+      VERBOSE("Failed to map perf ring buffer for J9VMThread=%p, errno: %d, mmap : %s.", vmThread, errno, strerror(errno));
+      goto closefd;
+      }
+
+   samples = (uintptr_t *)allocateBuffer(maxSamples * sizeof(uintptr_t));
+   if (!samples)
+      {
+      VERBOSE("Failed to allocate sample buffer for J9VMThread=%p.", vmThread);
+      // Don't have enough memory now, but might in the future, so don't disable HWP completely
+      setUnavailableOnFail = false;
+      goto unmap;
+      }
+
+   context = (TR_X86HWProfilerContext *)TR_Memory::jitPersistentAlloc(sizeof(TR_X86HWProfilerContext), TR_Memory::HWProfile);
+   if (!context)
+      {
+      VERBOSE("Failed to allocate context for J9VMThread=%p.", vmThread);
+      setUnavailableOnFail = false;
+      goto freebuf;
+      }
+
+   context->fd = fd;
+   context->header = (struct perf_event_mmap_page *)mapping;
+   context->data = (uint8_t *)mapping + pageSize;
+   context->dataSize = dataSize;
+   context->mmapSize = mmapSize;
+   context->samples = samples;
+   context->numSamples = 0;
+   context->maxSamples = maxSamples;
+   fe->_hwProfilerContext = context;
+
+   VERBOSE("J9VMThread=%p, initialized for HW profiling (fd=%d, context=%p).", vmThread, fd, context);
+   return true;
+
+freebuf:
+   freeBuffer(samples, maxSamples * sizeof(uintptr_t));
+unmap:
+   munmap(mapping, mmapSize);
+closefd:
+   if (close(fd))
+      VERBOSE("Failed to close perf interface on J9VMThread=%p, errno: %d, close : %s.", vmThread, errno, strerror(errno));
+fail:
+   // Prevent any future threads from trying to initialize if we hit a failure that is not transient
+   if (setUnavailableOnFail)
+      {
+      VERBOSE("Failure on J9VMThread=%p was critical. HW profiling will be unavailable from now on.", vmThread);
+      setHWProfilingAvailable(false);
+      }
+   return false;
+   }
+
+bool
+TR_X86HWProfiler::deinitializeThread(J9VMThread *vmThread)
+   {
+   TR_J9VMBase *fe = (TR_J9VMBase *)vmThread->jitVMwithThreadInfo;
+   if (!fe || !fe->_hwProfilerContext)
+      return true;
+
+   TR_X86HWProfilerContext *context = (TR_X86HWProfilerContext *)fe->_hwProfilerContext;
+   fe->_hwProfilerContext = NULL;
+
+   if (close(context->fd))
+      VERBOSE("Failed to close perf interface (fd=%d) on J9VMThread=%p, errno: %d, close : %s.", context->fd, vmThread, errno, strerror(errno));
+   munmap(context->header, context->mmapSize);
+   freeBuffer(context->samples, context->maxSamples * sizeof(uintptr_t));
+   TR_Memory::jitPersistentFree(context);
+
+   VERBOSE("J9VMThread=%p, deinitialized for HW profiling.", vmThread);
+   return true;
+   }
+
+bool
+TR_X86HWProfiler::processBuffers(J9VMThread *vmThread, TR_J9VMBase *fe)
+   {
+   TR_X86HWProfilerContext *context = (TR_X86HWProfilerContext *)fe->_hwProfilerContext;
+   if (!context)
+      return false;
+
+   struct perf_event_mmap_page *header = context->header;
+   const uint64_t mask = context->dataSize - 1;
+
+   // data_head is advanced by the kernel; the acquire pairs with its write barrier so the records below it are visible
+   uint64_t head = __atomic_load_n(&header->data_head, __ATOMIC_ACQUIRE);
+   uint64_t tail = header->data_tail;
+
+   if ((head - tail) * 100 < context->dataSize * TR::Options::_hwprofilerRIBufferThreshold)
+      return true;
+
+   while (tail < head)
+      {
+      // Records are 8 byte aligned, so neither the header nor any 8 byte field straddles the end of the ring
+      struct perf_event_header *record = (struct perf_event_header *)(context->data + (tail & mask));
+      if (OMR_UNLIKELY(record->size == 0))
+         break;
+
+      if (record->type == PERF_RECORD_SAMPLE)
+         {
+         uint64_t ip = *(uint64_t *)(context->data + ((tail + sizeof(struct perf_event_header)) & mask));
+         if (context->numSamples < context->maxSamples)
+            context->samples[context->numSamples++] = (uintptr_t)ip;
+         else
+            ++_STATS_SamplesLost;
+         }
+      else if (record->type == PERF_RECORD_LOST)
+         {
+         // Layout is { header, id, lost }
+         _STATS_SamplesLost += *(uint64_t *)(context->data + ((tail + sizeof(struct perf_event_header) + sizeof(uint64_t)) & mask));
+         }
+
+      tail += record->size;
+      }
+
+   // Hand the space back to the kernel only after the records have been read
+   __atomic_store_n(&header->data_tail, head, __ATOMIC_RELEASE);
+
+   if (context->numSamples == 0)
+      return true;
+
+   uint32_t bufferSizeInBytes = context->maxSamples * sizeof(uintptr_t);
+   uint32_t bufferFilledSizeInBytes = context->numSamples * sizeof(uintptr_t);
+
+   _numRequests++;
+
+   uint8_t *newBuffer = swapBufferToWorkingQueue((U_8*)context->samples,
+                                                  bufferSizeInBytes,
+                                                  bufferFilledSizeInBytes);
+   if (OMR_LIKELY(newBuffer != NULL))
+      {
+      context->samples = (uintptr_t *)newBuffer;
+      }
+   else if (TR::Options::getCmdLineOptions()->getOption(TR_DisableHWProfilerThread) ||
+            (100*_numRequestsSkipped) >= ((uint64_t)TR::Options::_hwProfilerBufferMaxPercentageToDiscard * _numRequests))
+      {
+      // Process buffer by application thread and reuse the buffer
+      processBufferRecords(vmThread, (U_8*)context->samples,
+                           bufferSizeInBytes,
+                           bufferFilledSizeInBytes);
+      _STATS_BuffersProcessedByAppThread++;
+      }
+   else
+      {
+      _numRequestsSkipped++;
+      }
+   context->numSamples = 0;
+
+   return true;
+   }
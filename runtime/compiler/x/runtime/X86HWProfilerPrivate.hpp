@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef X86HWPROFILERPRIVATE_INCL
+#define X86HWPROFILERPRIVATE_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "infra/Annotations.hpp"
+
+#define VERBOSE(...)                                                                    \
+   do                                                                                   \
+      {                                                                                 \
+      if (OMR_UNLIKELY(TR::Options::isAnyVerboseOptionSet(TR_VerboseHWProfiler)))        \
+         {                                                                              \
+         TR_VerboseLog::writeLineLocked(TR_Vlog_HWPROFILER, __VA_ARGS__);               \
+         }                                                                              \
+      }                                                                                 \
+   while (0)
+
+// Number of data pages in each thread's perf ring buffer; must be a power of 2
+#define X86HWP_RING_DATA_PAGES 8
+
+// A PERF_RECORD_SAMPLE with PERF_SAMPLE_IP is an 8 byte header followed by the IP
+#define X86HWP_SAMPLE_RECORD_SIZE 16
+
+struct perf_event_mmap_page;
+
+/**
+ * Per-thread sampling state, hung off TR_J9VMBase::_hwProfilerContext.
+ */
+struct TR_X86HWProfilerContext
+   {
+   int                          fd;
+   struct perf_event_mmap_page *header;      // first page of the mapping, holds data_head/data_tail
+   uint8_t                     *data;        // ring of records following the header page
+   uint64_t                     dataSize;    // bytes in the ring, a power of 2
+   uint64_t                     mmapSize;
+   uintptr_t                   *samples;     // sampled IPs waiting to be handed to the profiler thread
+   uint32_t                     numSamples;
+   uint32_t                     maxSamples;
+   };
+
+#endif /* X86HWPROFILERPRIVATE_INCL */
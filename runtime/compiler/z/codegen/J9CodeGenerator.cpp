@@ -109,6 +109,7 @@ J9::Z::CodeGenerator::CodeGenerator() :
 
    // Invoke Class.newInstanceImpl() from the JIT directly
    cg->setSupportsNewInstanceImplOpt();
+   cg->setSupportsArrayCmpLen();
 
    // Still being set in the S390CodeGenerator constructor, as zLinux sTR requires this.
    //cg->setSupportsJavaFloatSemantics();
@@ -388,11 +388,13 @@ MM_HeapRootScanner::scanJNIGlobalReferences()
 	reportScanningStarted(RootScannerEntity_JNIGlobalReferences);
 	setReachability(RootScannerEntityReachability_Strong);
 
-	GC_JNIGlobalReferenceIterator jniGlobalReferenceIterator(_javaVM->jniGlobalReferences);
-	J9Object **slot;
+	for (UDATA i = 0; i < _javaVM->jniGlobalReferenceStripeCount; i++) {
+		GC_JNIGlobalReferenceIterator jniGlobalReferenceIterator(_javaVM->jniGlobalReferenceStripes[i].globalReferences);
+		J9Object **slot;
 
-	while((slot = (J9Object **)jniGlobalReferenceIterator.nextSlot()) != NULL) {
-		doJNIGlobalReferenceSlot(slot, &jniGlobalReferenceIterator);
+		while((slot = (J9Object **)jniGlobalReferenceIterator.nextSlot()) != NULL) {
+			doJNIGlobalReferenceSlot(slot, &jniGlobalReferenceIterator);
+		}
 	}
 
 	reportScanningEnded(RootScannerEntity_JNIGlobalReferences);
@@ -513,11 +515,13 @@ MM_HeapRootScanner::scanJNIWeakGlobalReferences()
 	reportScanningStarted(RootScannerEntity_JNIWeakGlobalReferences);
 	setReachability(RootScannerEntityReachability_Weak);
 	
-	GC_JNIWeakGlobalReferenceIterator jniWeakGlobalReferenceIterator(_javaVM->jniWeakGlobalReferences);
-	J9Object **slot;
+	for (UDATA i = 0; i < _javaVM->jniGlobalReferenceStripeCount; i++) {
+		GC_JNIWeakGlobalReferenceIterator jniWeakGlobalReferenceIterator(_javaVM->jniGlobalReferenceStripes[i].weakGlobalReferences);
+		J9Object **slot;
 
-	while((slot = (J9Object **)jniWeakGlobalReferenceIterator.nextSlot()) != NULL) {
-		doJNIWeakGlobalReference(slot);
+		while((slot = (J9Object **)jniWeakGlobalReferenceIterator.nextSlot()) != NULL) {
+			doJNIWeakGlobalReference(slot);
+		}
 	}
 
 	reportScanningEnded(RootScannerEntity_JNIWeakGlobalReferences);
@@ -110,6 +110,8 @@ MM_GCExtensions::initialize(MM_EnvironmentBase *env)
 
 	padToPageSize = J9_ARE_ALL_BITS_SET(getJavaVM()->runtimeFlags, J9_RUNTIME_AGGRESSIVE);
 
+	memset(&jniCriticalArrayStats, 0, sizeof(jniCriticalArrayStats));
+
 	if (J9HookInitializeInterface(getHookInterface(), OMRPORT_FROM_J9PORT(PORTLIB), sizeof(hookInterface))) {
 		goto failed;
 	}
@@ -180,8 +180,17 @@ public:
 
 	bool _HeapManagementMXBeanBackCompatibilityEnabled;
 
+	struct {
+		volatile UDATA _copies; /**< Number of JNI critical array and Get<Type>ArrayElements accesses which copied the array data to a native buffer */
+		volatile UDATA _copiedBytes; /**< Bytes copied to native buffers by those accesses */
+		volatile UDATA _mappings; /**< Number of JNI critical array accesses which returned the double mapped view of a discontiguous array */
+		volatile UDATA _mappedBytes; /**< Bytes accessed through double mapped views by JNI critical array accesses */
+	} jniCriticalArrayStats;
+
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
+	UDATA idleHeapReleaseWindow; /**< Time in ms over which free heap pages are released in slices once the VM is idle, 0 to release them all within the idle GC */
+	UDATA idleHeapReleaseSlices; /**< Number of slices idleHeapReleaseWindow is divided into */
 #endif
 
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
@@ -312,6 +321,8 @@ public:
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
+		, idleHeapReleaseWindow(0)
+		, idleHeapReleaseSlices(10)
 #endif
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
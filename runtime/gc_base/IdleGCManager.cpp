@@ -27,12 +27,17 @@
 #include "j9protos.h"
 #include "j9consts.h"
 #include "vmhook_internal.h"
+#include "mmhook_internal.h"
 
 #include "IdleGCManager.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 #include "OMRVMInterface.hpp"
 #include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapMemoryPoolIterator.hpp"
+#include "Math.hpp"
+#include "MemoryPool.hpp"
 
 MM_IdleGCManager *
 MM_IdleGCManager::newInstance(MM_EnvironmentBase* env)
@@ -80,9 +85,115 @@ MM_IdleGCManager::manageFreeHeap(J9VMThread* currentThread)
 	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(currentThread->omrVMThread);
 	MM_GCExtensions* _extensions = MM_GCExtensions::getExtensions(env);
 
-	_javaVM->internalVMFunctions->internalAcquireVMAccess(currentThread);
-	_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
-	_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
+	if (0 == _extensions->idleHeapReleaseWindow) {
+		_javaVM->internalVMFunctions->internalAcquireVMAccess(currentThread);
+		_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
+		_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
+	} else {
+		releaseFreeHeapGradually(env);
+	}
+}
+
+bool
+MM_IdleGCManager::waitWhileIdle(UDATA millis)
+{
+	J9VMRuntimeStateListener* listener = &_javaVM->vmRuntimeStateListener;
+	bool idle = false;
+
+	/* the hook runs on the listener thread, so any state change while waiting notifies this monitor */
+	omrthread_monitor_enter(listener->runtimeStateListenerMutex);
+	idle = (J9VM_RUNTIME_STATE_IDLE == listener->vmRuntimeState) && (J9VM_RUNTIME_STATE_LISTENER_STARTED == listener->runtimeStateListenerState);
+	if (idle && (0 != millis)) {
+		omrthread_monitor_wait_timed(listener->runtimeStateListenerMutex, millis, 0);
+		idle = (J9VM_RUNTIME_STATE_IDLE == listener->vmRuntimeState) && (J9VM_RUNTIME_STATE_LISTENER_STARTED == listener->runtimeStateListenerState);
+	}
+	omrthread_monitor_exit(listener->runtimeStateListenerMutex);
+
+	return idle;
+}
+
+void
+MM_IdleGCManager::releaseFreeHeapGradually(MM_EnvironmentBase* env)
+{
+	J9VMThread* currentThread = (J9VMThread*)env->getLanguageVMThread();
+	MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
+	J9InternalVMFunctions const * const vmFuncs = _javaVM->internalVMFunctions;
+	UDATA sliceCount = extensions->idleHeapReleaseSlices;
+	UDATA sliceInterval = extensions->idleHeapReleaseWindow / sliceCount;
+	UDATA totalReleasedBytes = 0;
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+
+	/* a VM which is idle only briefly does not pay for the collection at all */
+	if (!waitWhileIdle(sliceInterval)) {
+		return;
+	}
+
+	/* the idle GC code would release every free page within the collection pause, leave that to the slices */
+	vmFuncs->internalAcquireVMAccess(currentThread);
+	extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_NOT_AGGRESSIVE);
+	UDATA freeBytes = extensions->heap->getApproximateFreeMemorySize();
+	vmFuncs->internalReleaseVMAccess(currentThread);
+
+	/* idleMinimumFree is the percentage of the free heap which stays committed */
+	UDATA releasableBytes = freeBytes - (UDATA)(((U_64)freeBytes * extensions->idleMinimumFree) / 100);
+	UDATA heapBase = (UDATA)extensions->heap->getHeapBase();
+	UDATA heapSize = (UDATA)extensions->heap->getHeapTop() - heapBase;
+
+	for (UDATA slice = 1; (slice <= sliceCount) && (totalReleasedBytes < releasableBytes); slice++) {
+		if (!waitWhileIdle((1 == slice) ? 0 : sliceInterval)) {
+			TRIGGER_J9HOOK_MM_IDLE_HEAP_RELEASE_SLICE(extensions->hookInterface, currentThread, j9time_hires_clock(), slice, sliceCount, 0, totalReleasedBytes, 0, 1);
+			break;
+		}
+
+		void* lowAddress = (void*)(heapBase + ((slice - 1) * (heapSize / sliceCount)));
+		void* highAddress = (void*)((slice == sliceCount) ? (heapBase + heapSize) : (heapBase + (slice * (heapSize / sliceCount))));
+		U_64 startTime = j9time_hires_clock();
+
+		vmFuncs->internalAcquireVMAccess(currentThread);
+		env->acquireExclusiveVMAccess();
+		UDATA releasedBytes = releaseFreeHeapRange(env, lowAddress, highAddress, releasableBytes - totalReleasedBytes);
+		env->releaseExclusiveVMAccess();
+		vmFuncs->internalReleaseVMAccess(currentThread);
+
+		U_64 endTime = j9time_hires_clock();
+		totalReleasedBytes += releasedBytes;
+		TRIGGER_J9HOOK_MM_IDLE_HEAP_RELEASE_SLICE(extensions->hookInterface, currentThread, endTime, slice, sliceCount, releasedBytes, totalReleasedBytes,
+				j9time_hires_delta(startTime, endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS), 0);
+	}
+}
+
+UDATA
+MM_IdleGCManager::releaseFreeHeapRange(MM_EnvironmentBase* env, void* lowAddress, void* highAddress, UDATA maximumBytes)
+{
+	MM_Heap* heap = MM_GCExtensions::getExtensions(env)->heap;
+	UDATA pageSize = heap->getPageSize();
+	UDATA releasedBytes = 0;
+	MM_HeapMemoryPoolIterator poolIterator(env, heap);
+	MM_MemoryPool* memoryPool = NULL;
+
+	while ((releasedBytes < maximumBytes) && (NULL != (memoryPool = poolIterator.nextPool()))) {
+		MM_HeapLinkedFreeHeader* freeEntry = (MM_HeapLinkedFreeHeader*)memoryPool->getFirstFreeStartingAddr(env);
+		while ((releasedBytes < maximumBytes) && (NULL != freeEntry)) {
+			if (((void*)freeEntry >= lowAddress) && ((void*)freeEntry < highAddress)) {
+				/* the free entry header stays committed, only the whole pages behind it are released */
+				UDATA entryTop = (UDATA)freeEntry + freeEntry->getSize();
+				UDATA releaseBase = MM_Math::roundToCeiling(pageSize, (UDATA)(freeEntry + 1));
+				UDATA releaseTop = MM_Math::roundToFloor(pageSize, entryTop);
+				if (releaseTop > releaseBase) {
+					UDATA releaseSize = MM_Math::roundToFloor(pageSize, OMR_MIN(releaseTop - releaseBase, maximumBytes - releasedBytes));
+					if (0 == releaseSize) {
+						break;
+					}
+					if (heap->decommitMemory((void*)releaseBase, releaseSize, (void*)(freeEntry + 1), (void*)entryTop)) {
+						releasedBytes += releaseSize;
+					}
+				}
+			}
+			freeEntry = (MM_HeapLinkedFreeHeader*)memoryPool->getNextFreeStartingAddr(env, freeEntry);
+		}
+	}
+
+	return releasedBytes;
 }
 
 extern "C" {
@@ -57,6 +57,24 @@ protected:
 public:
 
 private:
+	/**
+	 * Waits up to the given time for the VM to leave the idle state.
+	 * @param millis time to wait, 0 to only check the current state
+	 * @return true if the VM is still idle and the listener has not been stopped
+	 */
+	bool waitWhileIdle(UDATA millis);
+	/**
+	 * Collects once and then releases the free heap over idleHeapReleaseWindow, a slice of the heap address
+	 * range at a time, stopping as soon as the VM becomes active again or only idleMinimumFree is left committed.
+	 */
+	void releaseFreeHeapGradually(MM_EnvironmentBase* env);
+	/**
+	 * Decommits the whole pages inside free entries which start within [lowAddress, highAddress).
+	 * Caller must hold exclusive VM access so the free lists cannot change underneath the walk.
+	 * @param maximumBytes upper bound on the bytes to decommit
+	 * @return the number of bytes decommitted
+	 */
+	UDATA releaseFreeHeapRange(MM_EnvironmentBase* env, void* lowAddress, void* highAddress, UDATA maximumBytes);
 protected:
 	/**
 	 * Initialize the object of this class and registers for Runtime State hook
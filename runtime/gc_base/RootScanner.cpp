@@ -585,23 +585,28 @@ MM_RootScanner::scanFinalizableObjects(MM_EnvironmentBase *env)
 #endif /* J9VM_GC_FINALIZATION */
 
 /**
- * @todo Provide function documentation
+ * Scan the JNI global references. Each stripe of the references is a separate
+ * work unit so that multiple GC threads can share a large set of references.
  */
 void
 MM_RootScanner::scanJNIGlobalReferences(MM_EnvironmentBase *env)
 {
+	J9JavaVM *javaVM = static_cast<J9JavaVM*>(_omrVM->_language_vm);
+
 	/* JNI Global References */
-	if(_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-		reportScanningStarted(RootScannerEntity_JNIGlobalReferences);
+	for (uintptr_t i = 0; i < javaVM->jniGlobalReferenceStripeCount; i++) {
+		if(_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			reportScanningStarted(RootScannerEntity_JNIGlobalReferences);
 
-		GC_JNIGlobalReferenceIterator jniGlobalReferenceIterator(static_cast<J9JavaVM*>(_omrVM->_language_vm)->jniGlobalReferences);
-		J9Object **slot;
+			GC_JNIGlobalReferenceIterator jniGlobalReferenceIterator(javaVM->jniGlobalReferenceStripes[i].globalReferences);
+			J9Object **slot;
 
-		while((slot = (J9Object **)jniGlobalReferenceIterator.nextSlot()) != NULL) {
-			doJNIGlobalReferenceSlot(slot, &jniGlobalReferenceIterator);
-		}
+			while((slot = (J9Object **)jniGlobalReferenceIterator.nextSlot()) != NULL) {
+				doJNIGlobalReferenceSlot(slot, &jniGlobalReferenceIterator);
+			}
 
-		reportScanningEnded(RootScannerEntity_JNIGlobalReferences);
+			reportScanningEnded(RootScannerEntity_JNIGlobalReferences);
+		}
 	}
 }
 
@@ -789,22 +794,27 @@ MM_RootScanner::scanMonitorReferences(MM_EnvironmentBase *env)
 }
 
 /**
- * @todo Provide function documentation
+ * Scan the JNI weak global references, one work unit per stripe.
+ * @see MM_RootScanner::scanJNIGlobalReferences()
  */
 void
 MM_RootScanner::scanJNIWeakGlobalReferences(MM_EnvironmentBase *env)
 {
-	if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-		reportScanningStarted(RootScannerEntity_JNIWeakGlobalReferences);
+	J9JavaVM *javaVM = static_cast<J9JavaVM*>(_omrVM->_language_vm);
 
-		GC_JNIWeakGlobalReferenceIterator jniWeakGlobalReferenceIterator(static_cast<J9JavaVM*>(_omrVM->_language_vm)->jniWeakGlobalReferences);
-		J9Object **slot;
+	for (uintptr_t i = 0; i < javaVM->jniGlobalReferenceStripeCount; i++) {
+		if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			reportScanningStarted(RootScannerEntity_JNIWeakGlobalReferences);
 
-		while((slot = (J9Object **)jniWeakGlobalReferenceIterator.nextSlot()) != NULL) {
-			doJNIWeakGlobalReference(slot);
-		}
+			GC_JNIWeakGlobalReferenceIterator jniWeakGlobalReferenceIterator(javaVM->jniGlobalReferenceStripes[i].weakGlobalReferences);
+			J9Object **slot;
 
-		reportScanningEnded(RootScannerEntity_JNIWeakGlobalReferences);
+			while((slot = (J9Object **)jniWeakGlobalReferenceIterator.nextSlot()) != NULL) {
+				doJNIWeakGlobalReference(slot);
+			}
+
+			reportScanningEnded(RootScannerEntity_JNIWeakGlobalReferences);
+		}
 	}
 }
 
@@ -130,24 +130,24 @@ GC_VMInterface::unlockClasses(MM_GCExtensions *extensions)
 }
 
 /**
- * Acquire exclusive access to JNI global references.
+ * Acquire exclusive access to one stripe of the JNI global references.
  */
 void
-GC_VMInterface::lockJNIGlobalReferences(MM_GCExtensions *extensions)
+GC_VMInterface::lockJNIGlobalReferences(MM_GCExtensions *extensions, J9JNIGlobalReferenceStripe *stripe)
 {
 #if defined(J9VM_THR_PREEMPTIVE)
-	omrthread_monitor_enter(((J9JavaVM *)extensions->getOmrVM()->_language_vm)->jniFrameMutex);
+	omrthread_monitor_enter(stripe->mutex);
 #endif /* J9VM_THR_PREEMPTIVE */
 }
 
 /**
- * Release exclusive access to JNI global references.
+ * Release exclusive access to one stripe of the JNI global references.
  */
 void
-GC_VMInterface::unlockJNIGlobalReferences(MM_GCExtensions *extensions)
+GC_VMInterface::unlockJNIGlobalReferences(MM_GCExtensions *extensions, J9JNIGlobalReferenceStripe *stripe)
 {
 #if defined(J9VM_THR_PREEMPTIVE)
-	omrthread_monitor_exit(((J9JavaVM *)extensions->getOmrVM()->_language_vm)->jniFrameMutex);
+	omrthread_monitor_exit(stripe->mutex);
 #endif /* J9VM_THR_PREEMPTIVE */
 }
 
@@ -60,8 +60,8 @@ public:
 	static void unlockClassMemorySegmentList(MM_GCExtensions *extensions);
 	static void lockClasses(MM_GCExtensions *extensions);
 	static void unlockClasses(MM_GCExtensions *extensions);
-	static void lockJNIGlobalReferences(MM_GCExtensions *extensions);
-	static void unlockJNIGlobalReferences(MM_GCExtensions *extensions);
+	static void lockJNIGlobalReferences(MM_GCExtensions *extensions, J9JNIGlobalReferenceStripe *stripe);
+	static void unlockJNIGlobalReferences(MM_GCExtensions *extensions, J9JNIGlobalReferenceStripe *stripe);
 	static void lockVMThreadList(MM_GCExtensions *extensions);
 	static void unlockVMThreadList(MM_GCExtensions *extensions);
 	static void lockFinalizeList(MM_GCExtensions *extensions);
@@ -277,6 +277,8 @@ extern UDATA j9gc_stringHashEqualFn (void *leftKey, void *rightKey, void *userDa
 
 /* modronapi.cpp */
 extern J9_CFUNC UDATA j9gc_get_bytes_allocated_by_thread(J9VMThread* vmThread);
+extern J9_CFUNC void j9gc_jni_array_copied(J9VMThread *vmThread, UDATA byteCount);
+extern J9_CFUNC void j9gc_get_jni_array_stats(J9JavaVM *javaVM, UDATA *copies, UDATA *copiedBytes, UDATA *mappings, UDATA *mappedBytes);
 
 #ifdef __cplusplus
 }
@@ -31,6 +31,7 @@
 #include "modronapi.hpp"
 #include "modronopt.h"
 
+#include "AtomicOperations.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
@@ -976,6 +977,39 @@ j9gc_notifyGCOfClassReplacement(J9VMThread *vmThread, J9Class *oldClass, J9Class
 	}
 }
 
+/**
+ * Records a JNI array access which copied the array data to a native buffer
+ * outside of the GC access barrier, e.g. Get<Type>ArrayElements.
+ * @param[in] vmThread the current thread
+ * @param[in] byteCount number of bytes copied
+ */
+void
+j9gc_jni_array_copied(J9VMThread *vmThread, UDATA byteCount)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vmThread->javaVM);
+	MM_AtomicOperations::add(&extensions->jniCriticalArrayStats._copies, 1);
+	MM_AtomicOperations::add(&extensions->jniCriticalArrayStats._copiedBytes, byteCount);
+}
+
+/**
+ * Return the cumulative counts of JNI array accesses which copied the array data
+ * and of those served from a double mapped view of a discontiguous array.
+ * @param[in] javaVM the J9JavaVM
+ * @param[out] copies number of accesses which copied the array data
+ * @param[out] copiedBytes bytes copied by those accesses
+ * @param[out] mappings number of accesses which returned a double mapped view
+ * @param[out] mappedBytes bytes accessed through double mapped views
+ */
+void
+j9gc_get_jni_array_stats(J9JavaVM *javaVM, UDATA *copies, UDATA *copiedBytes, UDATA *mappings, UDATA *mappedBytes)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	*copies = extensions->jniCriticalArrayStats._copies;
+	*copiedBytes = extensions->jniCriticalArrayStats._copiedBytes;
+	*mappings = extensions->jniCriticalArrayStats._mappings;
+	*mappedBytes = extensions->jniCriticalArrayStats._mappedBytes;
+}
+
 /* JAZZ 90354 Temporarily move obsolete GC table exported functions, to be removed shortly. */
 /* These calls remain, due to legacy symbol names - see Jazz 13097 for more information */
 #if defined (OMR_GC_MODRON_CONCURRENT_MARK) || defined (J9VM_GC_VLHGC)
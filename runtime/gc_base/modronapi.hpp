@@ -111,6 +111,8 @@ UDATA ownableSynchronizerObjectCreated(J9VMThread *vmThread, j9object_t object);
  * @param isFastHCR Flag to indicate wether it replacement was done via fastHCR or not
  */
 void j9gc_notifyGCOfClassReplacement(J9VMThread *vmThread, J9Class *originalClass, J9Class *replacementClass, UDATA isFastHCR);
+void j9gc_jni_array_copied(J9VMThread *vmThread, UDATA byteCount);
+void j9gc_get_jni_array_stats(J9JavaVM *javaVM, UDATA *copies, UDATA *copiedBytes, UDATA *mappings, UDATA *mappedBytes);
 }
 
 #endif /* MODRONAPI_HPP_ */
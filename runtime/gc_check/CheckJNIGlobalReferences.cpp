@@ -47,12 +47,14 @@ GC_CheckJNIGlobalReferences::kill()
 void
 GC_CheckJNIGlobalReferences::check()
 {
-	GC_JNIGlobalReferenceIterator jniGlobalReferenceIterator(_javaVM->jniGlobalReferences);
-	J9Object **slotPtr;
-		
-	while((slotPtr = (J9Object **)jniGlobalReferenceIterator.nextSlot()) != NULL) {
-		if (_engine->checkSlotPool(_javaVM, slotPtr, _javaVM->jniGlobalReferences) != J9MODRON_SLOT_ITERATOR_OK ){
-			return;
+	for (UDATA i = 0; i < _javaVM->jniGlobalReferenceStripeCount; i++) {
+		J9Pool *pool = _javaVM->jniGlobalReferenceStripes[i].globalReferences;
+		GC_JNIGlobalReferenceIterator jniGlobalReferenceIterator(pool);
+		J9Object **slotPtr;
+		while((slotPtr = (J9Object **)jniGlobalReferenceIterator.nextSlot()) != NULL) {
+			if (_engine->checkSlotPool(_javaVM, slotPtr, pool) != J9MODRON_SLOT_ITERATOR_OK ){
+				return;
+			}
 		}
 	}
 }
@@ -60,13 +62,15 @@ GC_CheckJNIGlobalReferences::check()
 void
 GC_CheckJNIGlobalReferences::print()
 {
-	J9Pool *pool = _javaVM->jniGlobalReferences;
-	GC_PoolIterator poolReferenceIterator(pool);
-	J9Object **slotPtr;
+	for (UDATA i = 0; i < _javaVM->jniGlobalReferenceStripeCount; i++) {
+		J9Pool *pool = _javaVM->jniGlobalReferenceStripes[i].globalReferences;
+		GC_PoolIterator poolReferenceIterator(pool);
+		J9Object **slotPtr;
 
-	GC_ScanFormatter formatter(_portLibrary, "jniGlobalReferences", (void *) pool);
-	while((slotPtr = (J9Object **)poolReferenceIterator.nextSlot()) != NULL) {
-		formatter.entry((void *)*slotPtr);
+		GC_ScanFormatter formatter(_portLibrary, "jniGlobalReferences", (void *) pool);
+		while((slotPtr = (J9Object **)poolReferenceIterator.nextSlot()) != NULL) {
+			formatter.entry((void *)*slotPtr);
+		}
+		formatter.end("jniGlobalReferences", (void *)pool);
 	}
-	formatter.end("jniGlobalReferences", (void *)pool);
 }
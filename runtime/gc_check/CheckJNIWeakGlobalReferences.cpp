@@ -47,11 +47,14 @@ GC_CheckJNIWeakGlobalReferences::kill()
 void
 GC_CheckJNIWeakGlobalReferences::check()
 {
-	GC_JNIWeakGlobalReferenceIterator jniWeakGlobalReferenceIterator(_javaVM->jniWeakGlobalReferences);
-	J9Object **slotPtr;
-	while((slotPtr = (J9Object **)jniWeakGlobalReferenceIterator.nextSlot()) != NULL) {
-		if (_engine->checkSlotPool(_javaVM, slotPtr, _javaVM->jniWeakGlobalReferences) != J9MODRON_SLOT_ITERATOR_OK ){
-			return;
+	for (UDATA i = 0; i < _javaVM->jniGlobalReferenceStripeCount; i++) {
+		J9Pool *pool = _javaVM->jniGlobalReferenceStripes[i].weakGlobalReferences;
+		GC_JNIWeakGlobalReferenceIterator jniWeakGlobalReferenceIterator(pool);
+		J9Object **slotPtr;
+		while((slotPtr = (J9Object **)jniWeakGlobalReferenceIterator.nextSlot()) != NULL) {
+			if (_engine->checkSlotPool(_javaVM, slotPtr, pool) != J9MODRON_SLOT_ITERATOR_OK ){
+				return;
+			}
 		}
 	}
 }
@@ -59,13 +62,15 @@ GC_CheckJNIWeakGlobalReferences::check()
 void
 GC_CheckJNIWeakGlobalReferences::print()
 {
-	J9Pool *pool = _javaVM->jniWeakGlobalReferences;
-	GC_PoolIterator poolReferenceIterator(pool);
-	J9Object **slotPtr;
+	for (UDATA i = 0; i < _javaVM->jniGlobalReferenceStripeCount; i++) {
+		J9Pool *pool = _javaVM->jniGlobalReferenceStripes[i].weakGlobalReferences;
+		GC_PoolIterator poolReferenceIterator(pool);
+		J9Object **slotPtr;
 
-	GC_ScanFormatter formatter(_portLibrary, "jniWeakGlobalReferences", (void *) pool);
-	while((slotPtr = (J9Object **)poolReferenceIterator.nextSlot()) != NULL) {
-		formatter.entry((void *)*slotPtr);
+		GC_ScanFormatter formatter(_portLibrary, "jniWeakGlobalReferences", (void *) pool);
+		while((slotPtr = (J9Object **)poolReferenceIterator.nextSlot()) != NULL) {
+			formatter.entry((void *)*slotPtr);
+		}
+		formatter.end("jniWeakGlobalReferences", (void *)pool);
 	}
-	formatter.end("jniWeakGlobalReferences", (void *)pool);
 }
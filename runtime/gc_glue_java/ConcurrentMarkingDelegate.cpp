@@ -199,23 +199,29 @@ MM_ConcurrentMarkingDelegate::collectJNIRoots(MM_EnvironmentBase *env, bool *com
 
 	Assert_GC_true_with_message(env, ((J9VMThread *)env->getLanguageVMThread())->privateFlags & J9_PRIVATE_FLAGS_CONCURRENT_MARK_ACTIVE, "MM_ConcurrentStats::_executionMode = %zu\n", _collector->getConcurrentGCStats()->getExecutionMode());
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
-	GC_VMInterface::lockJNIGlobalReferences(extensions);
-	GC_PoolIterator jniGlobalReferenceIterator(_javaVM->jniGlobalReferences);
-	omrobjectptr_t *slotPtr;
 	uintptr_t slotNum = 0;
-	while((slotPtr = (omrobjectptr_t *)jniGlobalReferenceIterator.nextSlot()) != NULL) {
-		slotNum += 1;
-		if (_collector->isExclusiveAccessRequestWaitingSparseSample(env, slotNum)) {
-			goto quitTracingJNIRefs;
-		} else {
-			_markingScheme->markObject(env, *slotPtr);
+	for (uintptr_t i = 0; i < _javaVM->jniGlobalReferenceStripeCount; i++) {
+		J9JNIGlobalReferenceStripe *stripe = &_javaVM->jniGlobalReferenceStripes[i];
+		bool quitTracing = false;
+		GC_VMInterface::lockJNIGlobalReferences(extensions, stripe);
+		GC_PoolIterator jniGlobalReferenceIterator(stripe->globalReferences);
+		omrobjectptr_t *slotPtr;
+		while((slotPtr = (omrobjectptr_t *)jniGlobalReferenceIterator.nextSlot()) != NULL) {
+			slotNum += 1;
+			if (_collector->isExclusiveAccessRequestWaitingSparseSample(env, slotNum)) {
+				quitTracing = true;
+				break;
+			} else {
+				_markingScheme->markObject(env, *slotPtr);
+			}
+		}
+		GC_VMInterface::unlockJNIGlobalReferences(extensions, stripe);
+		if (quitTracing) {
+			return;
 		}
 	}
 
 	*completedJNIRoots = true;
-
-quitTracingJNIRefs:
-	GC_VMInterface::unlockJNIGlobalReferences(extensions);
 }
 
 /**
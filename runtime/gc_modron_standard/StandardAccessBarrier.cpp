@@ -404,6 +404,8 @@ MM_StandardAccessBarrier::jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jar
 			if(NULL != isCopy) {
 				*isCopy = JNI_TRUE;
 			}
+			MM_AtomicOperations::add(&_extensions->jniCriticalArrayStats._copies, 1);
+			MM_AtomicOperations::add(&_extensions->jniCriticalArrayStats._copiedBytes, sizeInBytes);
 		}
 		vmThread->jniCriticalCopyCount += 1;
 		VM_VMAccess::inlineExitVMToJNI(vmThread);
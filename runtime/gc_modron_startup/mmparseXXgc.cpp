@@ -1005,6 +1005,26 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->gcOnIdleCompactThreshold = ((float)percentage) / 100.0f;
 			continue;
 		}
+
+		if (try_scan(&scan_start, "idleHeapReleaseWindow=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->idleHeapReleaseWindow, "idleHeapReleaseWindow=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "idleHeapReleaseSlices=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->idleHeapReleaseSlices, "idleHeapReleaseSlices=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->idleHeapReleaseSlices) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 #if defined (J9VM_GC_VLHGC)
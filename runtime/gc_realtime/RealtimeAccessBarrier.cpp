@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "ArrayletObjectModel.hpp"
+#include "AtomicOperations.hpp"
 #include "Bits.hpp"
 #include "EnvironmentRealtime.hpp"
 #include "HeapRegionDescriptorRealtime.hpp"
@@ -408,6 +409,8 @@ MM_RealtimeAccessBarrier::jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jar
 			if(NULL != isCopy) {
 				*isCopy = JNI_TRUE;
 			}
+			MM_AtomicOperations::add(&_extensions->jniCriticalArrayStats._copies, 1);
+			MM_AtomicOperations::add(&_extensions->jniCriticalArrayStats._copiedBytes, sizeInBytes);
 		}
 		vmThread->jniCriticalCopyCount += 1;
 		VM_VMAccess::inlineExitVMToJNI(vmThread);
@@ -41,6 +41,9 @@
 static void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 static void verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+static void verboseHandlerIdleHeapReleaseSlice(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandardJava::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -90,6 +93,9 @@ MM_VerboseHandlerOutputStandardJava::enableVerbose()
 	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookRegisterWithCallSite(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, OMR_GET_CALLSITE(), (void *)this);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_IDLE_HEAP_RELEASE_SLICE, verboseHandlerIdleHeapReleaseSlice, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -102,6 +108,9 @@ MM_VerboseHandlerOutputStandardJava::disableVerbose()
 	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, NULL);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookUnregister(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, NULL);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_IDLE_HEAP_RELEASE_SLICE, verboseHandlerIdleHeapReleaseSlice, NULL);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -188,6 +197,27 @@ MM_VerboseHandlerOutputStandardJava::handleSlowExclusive(J9HookInterface **hook,
 
 }
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+MM_VerboseHandlerOutputStandardJava::handleIdleHeapReleaseSlice(J9HookInterface **hook, UDATA eventNum, void *eventData)
+{
+	MM_IdleHeapReleaseSliceEvent *event = (MM_IdleHeapReleaseSliceEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread);
+	MM_VerboseWriterChain *writer = getManager()->getWriterChain();
+
+	enterAtomicReportingBlock();
+	if (0 != event->aborted) {
+		writer->formatAndOutput(env, 0, "<idle-heap-release slice=\"%zu\" slices=\"%zu\" totalreleasedbytes=\"%zu\" aborted=\"true\" />",
+				event->slice, event->sliceCount, event->totalReleasedBytes);
+	} else {
+		writer->formatAndOutput(env, 0, "<idle-heap-release slice=\"%zu\" slices=\"%zu\" releasedbytes=\"%zu\" totalreleasedbytes=\"%zu\" durationus=\"%llu\" />",
+				event->slice, event->sliceCount, event->releasedBytes, event->totalReleasedBytes, event->duration);
+	}
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 void
 MM_VerboseHandlerOutputStandardJava::handleClassUnloadEnd(J9HookInterface** hook, UDATA eventNum, void* eventData)
@@ -326,3 +356,11 @@ verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventD
 {
 	((MM_VerboseHandlerOutputStandardJava *)userData)->handleSlowExclusive(hook, eventNum, eventData);
 }
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+verboseHandlerIdleHeapReleaseSlice(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	((MM_VerboseHandlerOutputStandardJava *)userData)->handleIdleHeapReleaseSlice(hook, eventNum, eventData);
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
@@ -332,6 +332,13 @@ MM_VerboseHandlerOutputVLHGC::outputMemoryInfoInnerStanza(MM_EnvironmentBase *en
 				stats->_arrayletUnknownObjects, stats->_arrayletUnknownLeaves);
 	}
 
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+	if ((0 != extensions->jniCriticalArrayStats._copies) || (0 != extensions->jniCriticalArrayStats._mappings)) {
+		writer->formatAndOutput(env, indent, "<jni-critical-arrays copies=\"%zu\" copiedbytes=\"%zu\" mappings=\"%zu\" mappedbytes=\"%zu\" />",
+				extensions->jniCriticalArrayStats._copies, extensions->jniCriticalArrayStats._copiedBytes,
+				extensions->jniCriticalArrayStats._mappings, extensions->jniCriticalArrayStats._mappedBytes);
+	}
+
 	if (0 != stats->_numaNodes) {
 		UDATA total = stats->_commonNumaNodeBytes + stats->_localNumaNodeBytes + stats->_nonLocalNumaNodeBytes;
 		UDATA nonLocalPercent = 0;
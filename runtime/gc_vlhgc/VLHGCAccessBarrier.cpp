@@ -267,6 +267,8 @@ MM_VLHGCAccessBarrier::copyArrayCritical(J9VMThread *vmThread, GC_ArrayObjectMod
 		if (NULL != isCopy) {
 			*isCopy = JNI_TRUE;
 		}
+		MM_AtomicOperations::add(&_extensions->jniCriticalArrayStats._copies, 1);
+		MM_AtomicOperations::add(&_extensions->jniCriticalArrayStats._copiedBytes, sizeInBytes);
 	}
 }
 
@@ -305,6 +307,10 @@ MM_VLHGCAccessBarrier::jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jarray
 				if (NULL == data) {
 					/* Doublemap failed, but we still need to continue execution; therefore fallback to previous approach */
 					copyArrayCritical(vmThread, indexableObjectModel, functions, &data, arrayObject, isCopy);
+				} else {
+					/* Arraylet leaves never move, so the contiguous view stays valid without blocking the GC */
+					MM_AtomicOperations::add(&_extensions->jniCriticalArrayStats._mappings, 1);
+					MM_AtomicOperations::add(&_extensions->jniCriticalArrayStats._mappedBytes, indexableObjectModel->getDataSizeInBytes(arrayObject));
 				}
 			/* Corner case where there's only one arraylet leaf */
 			} else if (indexableObjectModel->isArrayletDataContiguous(arrayObject)) {
@@ -79,6 +79,7 @@ typedef struct J9ZipFunctionTable {
 	I_32 (*zip_openZipFile)(J9PortLibrary *portLib, char *filename, J9ZipFile *zipFile, J9ZipCachePool *cachePool, U_32 flags);
 	I_32 (*zip_releaseZipFile)(J9PortLibrary* portLib, struct J9ZipFile* zipFile);
 	void (*zip_resetZipFile)(J9PortLibrary* portLib, J9ZipFile* zipFile, IDATA *nextEntryPointer);
+	I_32 (*zip_getZipEntryDataPointer)(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8** data);
 } J9ZipFunctionTable;
 
 /* ---------------- zcpool.c ---------------- */
@@ -467,6 +468,18 @@ I_32
 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8* buffer, U_32 bufferSize);
 
 
+/**
+* @brief
+* @param portLib
+* @param zipFile
+* @param entry
+* @param data
+* @return I_32
+*/
+I_32 
+zip_getZipEntryDataPointer(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8** data);
+
+
 /**
 * @brief
 * @param portLib
@@ -445,6 +445,11 @@ JVM_FillInStackTrace(JNIEnv* env, jobject throwable)
 			flags |= J9_STACKWALK_HIDE_EXCEPTION_FRAMES;
 			walkState->restartException = unwrappedThrowable;
 		}
+		/* Only record the innermost frames if -XX:MaxJavaStackTraceDepth is in effect */
+		if (0 != javaVM->maxStackTraceDepth) {
+			flags |= J9_STACKWALK_COUNT_SPECIFIED;
+			walkState->maxFrames = javaVM->maxStackTraceDepth;
+		}
 		walkState->skipCount = 1; /* skip the INL frame -- TODO revisit this */
 		walkState->walkThread = currentThread;
 		walkState->flags = flags;
@@ -460,6 +465,14 @@ JVM_FillInStackTrace(JNIEnv* env, jobject throwable)
 			goto done;
 		}
 		framesWalked = walkState->framesWalked;
+		if (J9_ARE_ANY_BITS_SET(javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_COMPACT_STACK_TRACES)) {
+			/* An existing array must not end part way through a repeated frame */
+			UDATA maxEntries = UDATA_MAX;
+			if ((NULL != result) && (J9_PRIVATE_FLAGS_FILL_EXISTING_TRACE == (currentThread->privateFlags & J9_PRIVATE_FLAGS_FILL_EXISTING_TRACE))) {
+				maxEntries = J9INDEXABLEOBJECT_SIZE(currentThread, result);
+			}
+			framesWalked = vmfns->compactStackTrace(walkState->cache, framesWalked, maxEntries);
+		}
 
 		/* If there is no stack trace in the exception, or we are not in the out of memory case, allocate a new stack trace. */
 		if ((NULL == result) || (0 == (currentThread->privateFlags & J9_PRIVATE_FLAGS_FILL_EXISTING_TRACE))) {
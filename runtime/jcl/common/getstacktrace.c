@@ -33,6 +33,18 @@
 #include "vmaccess.h"
 
 
+static UDATA cacheStackTracePCs(J9VMThread *currentThread, J9VMThread *targetThread, void *userData);
+
+/* Handshake operation: walk the halted target thread's stack and cache the PCs */
+static UDATA
+cacheStackTracePCs(J9VMThread *currentThread, J9VMThread *targetThread, void *userData)
+{
+	J9StackWalkState *walkState = (J9StackWalkState *)userData;
+
+	walkState->walkThread = targetThread;
+	walkState->flags = J9_STACKWALK_CACHE_PCS | J9_STACKWALK_WALK_TRANSLATE_PC | J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_INCLUDE_NATIVES | J9_STACKWALK_VISIBLE_ONLY;
+	return currentThread->javaVM->walkStackFrames(currentThread, walkState);
+}
 
 j9object_t
 getStackTraceForThread(J9VMThread *currentThread, J9VMThread *targetThread, UDATA skipCount)
@@ -43,17 +55,9 @@ getStackTraceForThread(J9VMThread *currentThread, J9VMThread *targetThread, UDAT
 	J9StackWalkState walkState;
 	UDATA rc;
 
-	/* Halt the target thread */
-	vmfns->haltThreadForInspection(currentThread, targetThread);
-
-	/* walk stack and cache PCs */
-	walkState.walkThread = targetThread;
-	walkState.flags = J9_STACKWALK_CACHE_PCS | J9_STACKWALK_WALK_TRANSLATE_PC | J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_INCLUDE_NATIVES | J9_STACKWALK_VISIBLE_ONLY;
+	/* Only the target thread needs to be stopped while its stack is walked */
 	walkState.skipCount = skipCount;
-	rc = vm->walkStackFrames(currentThread, &walkState);
-
-	/* Now that the stack trace has been copied, resume the thread */
-	vmfns->resumeThreadForInspection(currentThread, targetThread);
+	rc = vmfns->handshakeThread(currentThread, targetThread, cacheStackTracePCs, &walkState);
 
 	/* Check for stack walk failure */
 	if (rc != J9_STACKWALK_RC_NONE) {
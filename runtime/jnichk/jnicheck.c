@@ -79,6 +79,8 @@ static IDATA jniCheckParseOptions(J9JavaVM* javaVM, char* options);
 static IDATA jniCheckProcessCommandLine(J9JavaVM* javaVM, J9VMDllLoadInfo* loadInfo);
 static UDATA globrefHashTableHashFn(void *entry, void *userData);
 static UDATA globrefHashTableEqualFn(void *leftEntry, void *rightEntry, void *userData);
+static UDATA jniGlobalReferenceStripesInclude (J9JavaVM* vm, jobject reference, BOOLEAN isWeak);
+static UDATA jniGlobalReferenceStripesCapacity (J9JavaVM* vm, BOOLEAN isWeak);
 
 static UDATA keyInitCount = 0;
 omrthread_tls_key_t jniEntryCountKey;
@@ -1123,6 +1125,46 @@ static UDATA jniIsLocalRef(JNIEnv * currentEnv, JNIEnv* env, jobject reference)
 
 
 
+/* Check whether any stripe of the JNI global (or weak global) references contains the reference */
+static UDATA
+jniGlobalReferenceStripesInclude(J9JavaVM* vm, jobject reference, BOOLEAN isWeak)
+{
+	UDATA rc = FALSE;
+	UDATA i = 0;
+
+	for (i = 0; (i < vm->jniGlobalReferenceStripeCount) && !rc; i++) {
+		J9JNIGlobalReferenceStripe* stripe = &vm->jniGlobalReferenceStripes[i];
+
+#ifdef J9VM_THR_PREEMPTIVE
+		omrthread_monitor_enter(stripe->mutex);
+#endif
+		rc = pool_includesElement(isWeak ? stripe->weakGlobalReferences : stripe->globalReferences, reference);
+#ifdef J9VM_THR_PREEMPTIVE
+		omrthread_monitor_exit(stripe->mutex);
+#endif
+	}
+
+	return rc;
+}
+
+
+
+static UDATA
+jniGlobalReferenceStripesCapacity(J9JavaVM* vm, BOOLEAN isWeak)
+{
+	UDATA capacity = 0;
+	UDATA i = 0;
+
+	for (i = 0; i < vm->jniGlobalReferenceStripeCount; i++) {
+		J9JNIGlobalReferenceStripe* stripe = &vm->jniGlobalReferenceStripes[i];
+		capacity += pool_capacity(isWeak ? stripe->weakGlobalReferences : stripe->globalReferences);
+	}
+
+	return capacity;
+}
+
+
+
 static UDATA
 jniIsGlobalRef(JNIEnv* env, jobject reference)
 {
@@ -1137,8 +1179,8 @@ jniIsGlobalRef(JNIEnv* env, jobject reference)
 #ifdef J9VM_THR_PREEMPTIVE
 	omrthread_monitor_enter(vm->jniFrameMutex);
 #endif
-	/* walk the JNIGlobalReferences pool */
-	rc = pool_includesElement(vm->jniGlobalReferences, reference);
+	/* walk the JNIGlobalReferences pools */
+	rc = jniGlobalReferenceStripesInclude(vm, reference, FALSE);
 
 	if (!rc) {
 		j9object_t heapclass;
@@ -1261,14 +1303,8 @@ static UDATA jniIsWeakGlobalRef(JNIEnv* env, jobject reference) {
 
 	enterVM(vmThread);
 
-#ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
-#endif
-	/* walk the JNIWeakGlobalReferences pool */
-	rc = pool_includesElement(vm->jniWeakGlobalReferences, reference);
-#ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
-#endif
+	/* walk the JNIWeakGlobalReferences pools */
+	rc = jniGlobalReferenceStripesInclude(vm, reference, TRUE);
 
 	exitVM(vmThread);
 
@@ -1653,8 +1689,8 @@ static void fillInLocalRefTracking(JNIEnv* env, J9JniCheckLocalRefState* refTrac
 		refTracking->topFrameCapacity = J9_SSF_CO_REF_SLOT_CNT;
 	}
 
-	refTracking->globalRefCapacity = pool_capacity(vmThread->javaVM->jniGlobalReferences);
-	refTracking->weakRefCapacity = pool_capacity(vmThread->javaVM->jniWeakGlobalReferences);
+	refTracking->globalRefCapacity = jniGlobalReferenceStripesCapacity(vmThread->javaVM, FALSE);
+	refTracking->weakRefCapacity = jniGlobalReferenceStripesCapacity(vmThread->javaVM, TRUE);
 }
 
 
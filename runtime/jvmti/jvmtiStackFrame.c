@@ -180,6 +180,8 @@ jvmtiGetThreadListStackTraces(jvmtiEnv* env,
 	rc = getCurrentVMThread(vm, &currentThread);
 	if (rc == JVMTI_ERROR_NONE) {
 		jvmtiStackInfo * stackInfo;
+		BOOLEAN singleThread = FALSE;
+		J9VMThread * haltedThread = NULL;
 
 		vm->internalVMFunctions->internalEnterVMFromJNI(currentThread);
 
@@ -190,7 +192,29 @@ jvmtiGetThreadListStackTraces(jvmtiEnv* env,
 		ENSURE_NON_NEGATIVE(max_frame_count);
 		ENSURE_NON_NULL(stack_info_ptr);
 
-		vm->internalVMFunctions->acquireExclusiveVMAccess(currentThread);
+		/* A single thread only needs to be halted itself to get a consistent stack trace */
+		singleThread = (1 == thread_count);
+		if (singleThread) {
+			jthread thread = *thread_list;
+
+			if (thread == NULL) {
+				rc = JVMTI_ERROR_NULL_POINTER;
+				goto done;
+			}
+			if (!isSameOrSuperClassOf(J9VMJAVALANGTHREAD_OR_NULL(vm), J9OBJECT_CLAZZ(currentThread, *((j9object_t *) thread)))) {
+				rc = JVMTI_ERROR_INVALID_THREAD;
+				goto done;
+			}
+			rc = getVMThread(currentThread, thread, &haltedThread, FALSE, FALSE);
+			if (rc != JVMTI_ERROR_NONE) {
+				goto done;
+			}
+			if (NULL != haltedThread) {
+				vm->internalVMFunctions->haltThreadForInspection(currentThread, haltedThread);
+			}
+		} else {
+			vm->internalVMFunctions->acquireExclusiveVMAccess(currentThread);
+		}
 
 		stackInfo = j9mem_allocate_memory(((sizeof(jvmtiStackInfo) + (max_frame_count * sizeof(jvmtiFrameInfo))) * thread_count) + sizeof(jlocation), J9MEM_CATEGORY_JVMTI_ALLOCATE);
 		if (stackInfo == NULL) {
@@ -215,7 +239,11 @@ jvmtiGetThreadListStackTraces(jvmtiEnv* env,
 				}
 
 				threadObject = *((j9object_t*) thread);
-				targetThread = J9VMJAVALANGTHREAD_THREADREF(currentThread, threadObject);
+				if (singleThread) {
+					targetThread = haltedThread;
+				} else {
+					targetThread = J9VMJAVALANGTHREAD_THREADREF(currentThread, threadObject);
+				}
 				if (targetThread == NULL) {
 					currentStackInfo->frame_count = 0;
 				} else {
@@ -245,7 +273,14 @@ deallocate:
 			rv_stack_info = stackInfo;
 		}
 fail:
-		vm->internalVMFunctions->releaseExclusiveVMAccess(currentThread);
+		if (singleThread) {
+			if (NULL != haltedThread) {
+				vm->internalVMFunctions->resumeThreadForInspection(currentThread, haltedThread);
+				releaseVMThread(currentThread, haltedThread);
+			}
+		} else {
+			vm->internalVMFunctions->releaseExclusiveVMAccess(currentThread);
+		}
 
 done:
 		vm->internalVMFunctions->internalExitVMToJNI(currentThread);
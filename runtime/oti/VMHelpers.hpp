@@ -502,6 +502,44 @@ public:
 		return isSubclass;
 	}
 
+	/**
+	 * Find the iTable for an interface in the iTables of a class. The hashed iTable
+	 * index is used if the class has one, otherwise the iTable list is walked.
+	 * The lastITable cache is neither read nor updated.
+	 *
+	 * @param clazz[in] the class whose iTables are searched
+	 * @param interfaceClass[in] the interface class to search for
+	 *
+	 * @returns the iTable for interfaceClass, or NULL if clazz does not implement it
+	 */
+	static VMINLINE J9ITable*
+	findITable(J9Class *clazz, J9Class *interfaceClass)
+	{
+		J9ITable *iTable = NULL;
+		J9ITableIndex *iTableIndex = clazz->iTableIndex;
+		if (NULL != iTableIndex) {
+			J9ITable **slots = J9ITABLEINDEX_SLOTS(iTableIndex);
+			UDATA const mask = iTableIndex->mask;
+			UDATA slot = J9ITABLEINDEX_HASH(interfaceClass) & mask;
+			/* The index is never full, so the probe ends at an empty slot */
+			while (NULL != (iTable = slots[slot])) {
+				if (interfaceClass == iTable->interfaceClass) {
+					break;
+				}
+				slot = (slot + 1) & mask;
+			}
+		} else {
+			iTable = (J9ITable*)clazz->iTable;
+			while (NULL != iTable) {
+				if (interfaceClass == iTable->interfaceClass) {
+					break;
+				}
+				iTable = iTable->next;
+			}
+		}
+		return iTable;
+	}
+
 	/**
 	 * Determine if a class is castable to another.  If updateCache is true, the current thread
 	 * must have VM access (or otherwise be blocking the GC) as writes back to classes which might
@@ -542,19 +580,16 @@ retry:
 				if (iTable->interfaceClass == castClass) {
 					goto cacheCastable;
 				}
-				iTable = (J9ITable*)instanceClass->iTable;
-				while (NULL != iTable) {
-					if (iTable->interfaceClass == castClass) {
-						if (updateCache) {
-							instanceClass->lastITable = iTable;
-						}
+				iTable = findITable(instanceClass, castClass);
+				if (NULL != iTable) {
+					if (updateCache) {
+						instanceClass->lastITable = iTable;
+					}
 cacheCastable:
-						if (updateCache) {
-							instanceClass->castClassCache = (UDATA)castClass;
-						}
-						goto done;
+					if (updateCache) {
+						instanceClass->castClassCache = (UDATA)castClass;
 					}
-					iTable = iTable->next;
+					goto done;
 				}
 			} else if (J9CLASS_IS_ARRAY(castClass)) {
 				/* the instanceClass must be an array to continue */
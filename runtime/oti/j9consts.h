@@ -330,6 +330,8 @@ extern "C" {
 #define J9_EXTENDED_RUNTIME2_LOAD_AGENT_MODULE 0x8
 #define J9_EXTENDED_RUNTIME2_ENABLE_DEEPSCAN 0x10
 #define J9_EXTENDED_RUNTIME2_ENABLE_CLASS_RELATIONSHIP_VERIFIER 0x20
+#define J9_EXTENDED_RUNTIME2_COMPACT_STACK_TRACES 0x40
+#define J9_EXTENDED_RUNTIME2_VALIDATE_FIELD_LAYOUT_HINTS 0x80
 
 
 /* TODO: Define this until the JIT removes it */
@@ -386,6 +388,9 @@ extern "C" {
 #define J9_STACKWALK_ITERATE_HIDDEN_JIT_FRAMES 0x40000000
 #define J9_STACKWALK_INCLUDE_CALL_IN_FRAMES 0x80000000
 
+/* Marks a repeated frame in a compacted Throwable walkback; the following entry holds the repeat count */
+#define J9_STACK_TRACE_REPEAT_TAG 1
+
 #define J9_FINDCLASS_FLAG_THROW_ON_FAIL 0x1
 #define J9_FINDCLASS_FLAG_NO_DEBUG_EVENTS 0x2
 #define J9_FINDCLASS_FLAG_EXISTING_ONLY 0x4
@@ -1575,6 +1575,19 @@ typedef struct J9ROMFieldOffsetWalkResult {
 #endif /* J9VM_OPT_VALHALLA_VALUE_TYPES */
 } J9ROMFieldOffsetWalkResult;
 
+typedef struct J9FieldLayoutHintField {
+	U_8* name;
+	UDATA nameLength;
+} J9FieldLayoutHintField;
+
+/* Hot instance fields of one class, read from -XX:FieldLayoutHints= */
+typedef struct J9FieldLayoutHint {
+	U_8* className;
+	UDATA classNameLength;
+	struct J9FieldLayoutHintField* hotFields;
+	UDATA hotFieldCount;
+} J9FieldLayoutHint;
+
 typedef struct J9HiddenInstanceField {
 	struct J9UTF8* className;
 	struct J9ROMFieldShape* shape;
@@ -1608,6 +1621,13 @@ typedef struct J9ROMFieldOffsetWalkState {
 	struct J9HiddenInstanceField* hiddenInstanceFields[J9VM_MAX_HIDDEN_FIELDS_PER_CLASS];
 	UDATA hiddenInstanceFieldCount;
 	UDATA hiddenInstanceFieldWalkIndex;
+	struct J9FieldLayoutHint* layoutHint;
+	U_32 hotSingleCount;
+	U_32 hotObjectCount;
+	U_32 hotDoubleCount;
+	U_32 hotSinglesSeen;
+	U_32 hotObjectsSeen;
+	U_32 hotDoublesSeen;
 #ifdef J9VM_OPT_VALHALLA_VALUE_TYPES
 	struct J9FlattenedClassCache *flattenedClassCache;
 	UDATA firstFlatSingleOffset;
@@ -1830,6 +1850,7 @@ typedef struct J9TranslationBufferSet {
 	U_8* sunClassFileBuffer;
 	UDATA sunClassFileSize;
 	UDATA currentSunClassFileSize;
+	U_8* currentSunClassFileData;
 	U_8* searchFilenameBuffer;
 	UDATA searchFilenameSize;
 	UDATA relocatorDLLHandle;
@@ -2142,6 +2163,22 @@ typedef struct J9RAMVirtualMethodRef {
 	struct J9Method *volatile method;
 } J9RAMVirtualMethodRef;
 
+/* An entry in the interpreter's invokeinterface cache, which maps a call site (the
+ * resolved J9RAMInterfaceMethodRef) and receiver class to the vTable offset of the
+ * target. Each set holds J9_INTERFACE_CALL_SITE_CACHE_WAYS entries for the call sites
+ * which hash to it. An entry is only valid while its sequence is even, and unchanged
+ * across the read of the other fields.
+ */
+typedef struct J9InterfaceCallSiteCacheEntry {
+	UDATA volatile sequence;
+	struct J9RAMInterfaceMethodRef *volatile callSite;
+	struct J9Class *volatile receiverClass;
+	UDATA volatile vTableOffset;
+} J9InterfaceCallSiteCacheEntry;
+
+#define J9_INTERFACE_CALL_SITE_CACHE_WAYS 2
+#define J9_INTERFACE_CALL_SITE_CACHE_DEFAULT_SETS 1024
+
 typedef struct J9RAMMethodTypeRef {
 	j9object_t type;
 	UDATA slotCount;
@@ -3017,6 +3054,7 @@ typedef struct J9Class {
 	struct J9Class* nestHost;
 #endif /* defined(J9VM_OPT_VALHALLA_NESTMATES) */
 	struct J9FlattenedClassCache* flattenedClassCache;
+	struct J9ITableIndex* iTableIndex;
 } J9Class;
 
 /* Interface classes can never be instantiated, so the following fields in J9Class will not be used:
@@ -3086,6 +3124,7 @@ typedef struct J9ArrayClass {
 #endif /* defined(J9VM_OPT_VALHALLA_NESTMATES) */
 	/* Added temporarily for consistency */
 	UDATA flattenedElementSize;
+	struct J9ITableIndex* iTableIndex;
 } J9ArrayClass;
 
 
@@ -3435,6 +3474,17 @@ typedef struct J9ITable {
 	struct J9ITable* next;
 } J9ITable;
 
+/* Open addressed hash table of the iTables of a class, keyed by interface class.
+ * The slots follow the header. Unused slots are NULL.
+ */
+typedef struct J9ITableIndex {
+	UDATA mask;
+} J9ITableIndex;
+
+#define J9ITABLEINDEX_SLOTS(index) ((J9ITable **)((index) + 1))
+#define J9ITABLEINDEX_HASH(interfaceClass) (((UDATA)(interfaceClass)) / J9_REQUIRED_CLASS_ALIGNMENT)
+#define J9_ITABLE_INDEX_DEFAULT_THRESHOLD 16
+
 typedef struct J9VTableHeader {
 	UDATA size;
 	J9Method* initialVirtualMethod;
@@ -4459,6 +4509,8 @@ typedef struct J9MemoryManagerFunctions {
 	I_32  ( *j9gc_get_jit_string_dedup_policy)(struct J9JavaVM *javaVM) ;
 	UDATA ( *j9gc_stringHashFn)(void *key, void *userData);
 	UDATA ( *j9gc_stringHashEqualFn)(void *leftKey, void *rightKey, void *userData);
+	void  ( *j9gc_jni_array_copied)(struct J9VMThread *vmThread, UDATA byteCount) ;
+	void  ( *j9gc_get_jni_array_stats)(struct J9JavaVM *javaVM, UDATA *copies, UDATA *copiedBytes, UDATA *mappings, UDATA *mappedBytes) ;
 } J9MemoryManagerFunctions;
 
 typedef struct J9InternalVMFunctions {
@@ -4802,6 +4854,8 @@ typedef struct J9InternalVMFunctions {
 	void ( *setNestmatesError)(struct J9VMThread *vmThread, struct J9Class *nestMember, struct J9Class *nestHost, IDATA errorCode);
 #endif /* J9VM_OPT_VALHALLA_NESTMATES */
 	BOOLEAN ( *areValueTypesEnabled)(struct J9JavaVM *vm);
+	UDATA ( *handshakeThread)(struct J9VMThread *currentThread, struct J9VMThread *targetThread, UDATA (*function)(struct J9VMThread *currentThread, struct J9VMThread *targetThread, void *userData), void *userData);
+	UDATA ( *compactStackTrace)(UDATA *cache, UDATA count, UDATA maxCount);
 } J9InternalVMFunctions;
 
 /* Jazz 99339: define a new structure to replace JavaVM so as to pass J9NativeLibrary to JVMTIEnv  */
@@ -5003,6 +5057,8 @@ typedef struct J9VMThread {
 #endif /* OMR_GC_COMPRESSED_POINTERS */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	UDATA safePointCount;
+	UDATA interfaceCallSiteCacheHits;
+	UDATA interfaceCallSiteCacheMisses;
 } J9VMThread;
 
 #define J9VMTHREAD_ALIGNMENT  0x100
@@ -5109,6 +5165,19 @@ typedef struct J9VMRuntimeStateListener {
 #define J9VM_RUNTIME_STATE_LISTENER_ABORT 3
 #define J9VM_RUNTIME_STATE_LISTENER_TERMINATED 4
 
+/* @ddr_namespace: map_to_type=J9JNIGlobalReferenceStripe */
+
+/* JNI global and weak global references are spread over stripes, each with its own pools
+ * and lock, so that threads creating and deleting references do not all contend on one mutex.
+ */
+typedef struct J9JNIGlobalReferenceStripe {
+	struct J9Pool* globalReferences;
+	struct J9Pool* weakGlobalReferences;
+	omrthread_monitor_t mutex;
+} J9JNIGlobalReferenceStripe;
+
+#define J9JNI_GLOBAL_REFERENCE_STRIPE_COUNT 8
+
 /* @ddr_namespace: map_to_type=J9JavaVM */
 
 typedef struct J9JavaVM {
@@ -5164,6 +5233,8 @@ typedef struct J9JavaVM {
 	omrthread_monitor_t exclusiveAccessMutex;
 	struct J9Pool* jniGlobalReferences;
 	struct J9Pool* jniWeakGlobalReferences;
+	struct J9JNIGlobalReferenceStripe* jniGlobalReferenceStripes;
+	UDATA jniGlobalReferenceStripeCount;
 	omrthread_monitor_t vmThreadListMutex;
 	j9object_t selectorHashTable;
 	struct J9Pool* classLoaderBlocks;
@@ -5188,6 +5259,8 @@ typedef struct J9JavaVM {
 	struct J9VMThread* mainThread;
 	struct J9VMThread* deadThreadList;
 	UDATA exclusiveAccessState;
+	UDATA exclusiveVMAccessRequestCount;
+	UDATA inspectionHaltCount;
 	omrthread_monitor_t classTableMutex;
 	UDATA anonClassCount;
 	UDATA totalThreadCount;
@@ -5418,6 +5491,9 @@ typedef struct J9JavaVM {
 	struct J9SharedCacheAPI* sharedCacheAPI;
 	UDATA lockwordMode;
 	struct J9HashTable* lockwordExceptions;
+	struct J9HashTable* fieldLayoutHints;
+	U_8* fieldLayoutHintsData;
+	U_32 fieldLayoutHintsHash;
 	void  ( *sidecarClearInterruptFunction)(struct J9VMThread * vmThread) ;
 	UDATA phase;
 #if defined(J9VM_PORT_ZOS_CEEHDLRSUPPORT)
@@ -5451,6 +5527,12 @@ typedef struct J9JavaVM {
 	struct J9Pool *customSpinOptions;
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
 	UDATA romMethodSortThreshold;
+	UDATA maxStackTraceDepth;
+	struct J9InterfaceCallSiteCacheEntry* interfaceCallSiteCache;
+	UDATA interfaceCallSiteCacheMask;
+	UDATA interfaceCallSiteCacheHits;
+	UDATA interfaceCallSiteCacheMisses;
+	UDATA iTableIndexThreshold;
 #if defined(J9VM_THR_ASYNC_NAME_UPDATE)
 	IDATA threadNameHandlerKey;
 #endif /* J9VM_THR_ASYNC_NAME_UPDATE */
@@ -316,6 +316,11 @@ enum INIT_STAGE {
 #define VMOPT_XNORTSJ "-Xnortsj"
 #define VMOPT_XXNOSTACKTRACEINTHROWABLE "-XX:-StackTraceInThrowable"
 #define VMOPT_XXSTACKTRACEINTHROWABLE "-XX:+StackTraceInThrowable"
+#define VMOPT_XXNOCOMPACTSTACKTRACEINTHROWABLE "-XX:-CompactStackTraceInThrowable"
+#define VMOPT_XXCOMPACTSTACKTRACEINTHROWABLE "-XX:+CompactStackTraceInThrowable"
+#define VMOPT_XXMAXJAVASTACKTRACEDEPTH_EQUALS "-XX:MaxJavaStackTraceDepth="
+#define VMOPT_XXINTERFACECALLSITECACHESIZE_EQUALS "-XX:InterfaceCallSiteCacheSize="
+#define VMOPT_XXITABLEINDEXTHRESHOLD_EQUALS "-XX:ITableIndexThreshold="
 #define VMOPT_XXNOPAGEALIGNDIRECTMEMORY "-XX:-PageAlignDirectMemory"
 #define VMOPT_XXPAGEALIGNDIRECTMEMORY   "-XX:+PageAlignDirectMemory"
 #define VMOPT_XXVMLOCKCLASSLOADERENABLE "-XX:+VMLockClassLoader"
@@ -357,6 +362,8 @@ enum INIT_STAGE {
 #define VMOPT_XSOFTMX "-Xsoftmx"
 #define VMOPT_XXNODISCLAIMVIRTUALMEMORY "-XX:-DisclaimVirtualMemory"
 #define VMOPT_XXDISCLAIMVIRTUALMEMORY "-XX:+DisclaimVirtualMemory"
+#define VMOPT_XXSHAREBOOTZIPCACHE "-XX:+ShareBootZipCache"
+#define VMOPT_XXNOSHAREBOOTZIPCACHE "-XX:-ShareBootZipCache"
 #define VMOPT_OPT_XXNOINTERLEAVEMEMORY "-XX:-InterleaveMemory"
 #define VMOPT_OPT_XXINTERLEAVEMEMORY "-XX:+InterleaveMemory"
 #define VMOPT_ROMMETHODSORTTHRESHOLD_EQUALS "-XX:ROMMethodSortThreshold="
@@ -435,6 +442,9 @@ enum INIT_STAGE {
 #define VMOPT_XXNORESTRICTCONTENDED "-XX:-RestrictContended"
 #define VMOPT_XXCONTENDEDFIELDS "-XX:+ContendedFields"
 #define VMOPT_XXNOCONTENDEDFIELDS "-XX:-ContendedFields"
+#define VMOPT_XXFIELDLAYOUTHINTS_EQUALS "-XX:FieldLayoutHints="
+#define VMOPT_XXVALIDATEFIELDLAYOUTHINTS "-XX:+ValidateFieldLayoutHints"
+#define VMOPT_XXNOVALIDATEFIELDLAYOUTHINTS "-XX:-ValidateFieldLayoutHints"
 
 #define VMOPT_XXRESTRICTIFA "-XX:+RestrictIFA"
 #define VMOPT_XXNORESTRICTIFA "-XX:-RestrictIFA"
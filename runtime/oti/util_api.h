@@ -1161,6 +1161,17 @@ J9JITExceptionTable* hash_jit_artifact_search(J9JITHashTable *table, UDATA searc
 J9JITExceptionTable* jit_artifact_search(J9AVLTree *tree, UDATA searchValue);
 
 
+/**
+* @brief Search for the metadata covering searchValue, probing the code cache hash table in
+* *tableHint first and updating *tableHint when the search has to fall back to the tree.
+* @param *tree
+* @param **tableHint
+* @param searchValue
+* @return J9JITExceptionTable*
+*/
+J9JITExceptionTable* jit_artifact_search_with_table_hint(J9AVLTree *tree, J9JITHashTable **tableHint, UDATA searchValue);
+
+
 #endif /* J9VM_INTERP_NATIVE_SUPPORT */ /* End File Level Build Flags */
 
 
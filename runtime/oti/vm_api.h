@@ -537,6 +537,16 @@ IDATA shutdownDLL(J9JavaVM * vm, UDATA descriptor, UDATA shutdownDueToExit);
 void JNICALL   
 exceptionDescribe(JNIEnv * env);
 
+/**
+* @brief Collapse runs of identical frames in a cached stack walk in place.
+* @param cache
+* @param count
+* @param maxCount the maximum number of entries to keep; repeated frames are never split
+* @return UDATA the number of entries remaining in cache
+*/
+UDATA
+compactStackTrace(UDATA *cache, UDATA count, UDATA maxCount);
+
 void   
 internalExceptionDescribe(J9VMThread *vmThread);
 
@@ -1062,6 +1072,15 @@ void
 initializeJNITable(J9JavaVM *vm);
 
 
+/**
+* @brief Allocate the JNI global reference stripes, each with its own pools and mutex.
+* @param *vm
+* @return 0 on success, non-zero on failure
+*/
+UDATA
+initializeJNIGlobalReferenceStripes(J9JavaVM *vm);
+
+
 /**
 * @brief
 * @param *env
@@ -1731,6 +1750,27 @@ hashClassTableDelete(J9ClassLoader *classLoader, U_8 *className, UDATA className
 J9HashTable *
 hashClassTableNew(J9JavaVM *javaVM, U_32 initialSize);
 
+/**
+* @brief Stop the class hash table of a loader from being grown in place, so that it may be
+* searched without owning the classTableMutex. A full table is replaced by a larger copy, and
+* the old copy is freed when exclusive VM access is next released.
+* Caller must own the classTableMutex, or the loader must not yet be visible to other threads.
+* @param *classLoader
+* @return void
+*/
+void
+hashClassTableSetLockFreeReads(J9ClassLoader *classLoader);
+
+
+/**
+* @brief Query whether the class hash table of a loader may be searched without owning the classTableMutex.
+* @param *classLoader
+* @return BOOLEAN
+*/
+BOOLEAN
+hashClassTableHasLockFreeReads(J9ClassLoader *classLoader);
+
+
 
 /**
 * @brief
@@ -3174,6 +3214,18 @@ void
 resumeThreadForInspection(J9VMThread * currentThread, J9VMThread * vmThread);
 
 
+/**
+* Run function on behalf of targetThread while only that thread is halted.
+* @param currentThread
+* @param targetThread
+* @param function
+* @param userData
+* @return the value returned by function
+*/
+UDATA
+handshakeThread(J9VMThread *currentThread, J9VMThread *targetThread, UDATA (*function)(J9VMThread *currentThread, J9VMThread *targetThread, void *userData), void *userData);
+
+
 /**
 * @brief
 * @param vmThread
@@ -31,6 +31,7 @@
 TextFileStream::TextFileStream(J9PortLibrary* portLibrary) :
 	_Buffer(NULL),
 	_IsOpen(false),
+	_DeferWrites(false),
 	_BufferPos(0),
 	_BufferSize(16*1024),
 	_PortLibrary(portLibrary),
@@ -51,7 +52,7 @@ TextFileStream::~TextFileStream()
 
 /* Method for opening the file */
 void
-TextFileStream::open(const char* fileName, bool cacheWrites)
+TextFileStream::open(const char* fileName, bool cacheWrites, bool deferWrites)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
 	if (0 == strcmp(fileName, J9RAS_STDOUT_NAME)) {
@@ -67,9 +68,81 @@ TextFileStream::open(const char* fileName, bool cacheWrites)
 	}
 	if(!cacheWrites) {
 		_BufferSize = 0;
+	} else if (_BufferSize != 0) {
+		/* Deferred writes keep the whole dump in memory until flush() is called */
+		_DeferWrites = deferWrites;
 	}
 }
 
+/* Method for writing any deferred data out to the file */
+void
+TextFileStream::flush(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	if ((_FileHandle != -1) && (_BufferSize != 0) && (_BufferPos != 0)) {
+		_Error = _Error || j9file_write_text(_FileHandle, _Buffer, _BufferPos);
+	}
+	_BufferPos = 0;
+	_DeferWrites = false;
+}
+
+/* Method for getting the position the next deferred write will go to */
+UDATA
+TextFileStream::getDeferredPosition(void) const
+{
+	return _BufferPos;
+}
+
+/* Method for moving the deferred data written from start onwards back to an earlier position,
+ * returns false if the data has already been written to the file
+ */
+bool
+TextFileStream::moveDeferredData(UDATA position, UDATA start)
+{
+	if (!_DeferWrites || (position > start) || (start > _BufferPos)) {
+		return false;
+	}
+
+	/* Rotate the data in place: reversing both parts and then the whole range swaps them over */
+	reverseBuffer(position, start);
+	reverseBuffer(start, _BufferPos);
+	reverseBuffer(position, _BufferPos);
+	return true;
+}
+
+/* Method for reversing the order of the deferred data between start and end */
+void
+TextFileStream::reverseBuffer(UDATA start, UDATA end)
+{
+	while ((start + 1) < end) {
+		char swap = _Buffer[start];
+		end -= 1;
+		_Buffer[start] = _Buffer[end];
+		_Buffer[end] = swap;
+		start += 1;
+	}
+}
+
+/* Method for growing the buffer used for deferred writes, returns false if the memory is not available */
+bool
+TextFileStream::growBuffer(UDATA required)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	UDATA newSize = _BufferSize * 2;
+	while (newSize < required) {
+		newSize *= 2;
+	}
+	char *newBuffer = (char *) j9mem_allocate_memory(newSize, OMRMEM_CATEGORY_VM);
+	if (NULL == newBuffer) {
+		return false;
+	}
+	memcpy(newBuffer, _Buffer, _BufferPos);
+	j9mem_free_memory(_Buffer);
+	_Buffer = newBuffer;
+	_BufferSize = newSize;
+	return true;
+}
+
 /* Method for closing the file */
 void 
 TextFileStream::close(void)
@@ -78,6 +151,7 @@ TextFileStream::close(void)
 	if (_FileHandle != -1) {
 		if(_BufferSize != 0) {
 			j9file_write_text(_FileHandle, _Buffer, _BufferPos);
+			_BufferPos = 0;
 		}
 		j9file_sync(_FileHandle);
 		if (_IsOpen) {
@@ -119,6 +193,16 @@ TextFileStream::writeCharacters(const char* data, IDATA length)
 		return;
 	}
 
+	if (_DeferWrites) {
+		/* keep everything in memory, falling back to normal cached writes if the buffer cannot grow */
+		if (((_BufferPos + (UDATA) length) <= _BufferSize) || growBuffer(_BufferPos + (UDATA) length)) {
+			memcpy(&_Buffer[_BufferPos], data, length);
+			_BufferPos += length;
+			return;
+		}
+		flush();
+	}
+
 	/* we are now in a cached state.  3 possible cases
 		1) the data fits in a buffer without flushing - just copy it in
 		2) simple overflows - finish this buffer, write it out, then put remaining in the newly empty buffer
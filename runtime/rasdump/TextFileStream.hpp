@@ -43,7 +43,14 @@ public :
 	~TextFileStream();
 
 	/* Method for opening the file */
-	void open(const char* fileName, bool cacheWrites);
+	void open(const char* fileName, bool cacheWrites, bool deferWrites=false);
+
+	/* Method for writing any deferred data out to the file */
+	void flush(void);
+
+	/* Methods for writing deferred data out of order */
+	UDATA getDeferredPosition(void) const;
+	bool moveDeferredData(UDATA position, UDATA start);
 
 	/* Method for closing the file */
 	void close(void);
@@ -66,8 +73,11 @@ private :
 	/* Prevent use of the copy constructor and assignment operator */
 	TextFileStream(const TextFileStream& source);
 	TextFileStream& operator=(const TextFileStream& source);
+	bool growBuffer(UDATA required);
+	void reverseBuffer(UDATA start, UDATA end);
 	char *_Buffer;
 	bool _IsOpen;
+	bool _DeferWrites;
 	UDATA _BufferPos;
 	UDATA _BufferSize;
 
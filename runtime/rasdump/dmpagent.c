@@ -166,7 +166,8 @@ static const J9RASdumpRequest rasDumpRequests[] =
 	{ "prepwalk",  "DO_PREPARE_HEAP_FOR_WALK",   J9RAS_DUMP_DO_PREPARE_HEAP_FOR_WALK },
 	{ "serial",    "DO_SUSPEND_OTHER_DUMPS",     J9RAS_DUMP_DO_SUSPEND_OTHER_DUMPS },
 	{ "attach",    "DO_ATTACH_THREAD",           J9RAS_DUMP_DO_ATTACH_THREAD },
-	{ "preempt",   "DO_PREEMPT_THREADS",         J9RAS_DUMP_DO_PREEMPT_THREADS }
+	{ "preempt",   "DO_PREEMPT_THREADS",         J9RAS_DUMP_DO_PREEMPT_THREADS },
+	{ "lowpause",  "DO_LOW_PAUSE",               J9RAS_DUMP_DO_LOW_PAUSE }
 };
 
 #define J9RAS_DUMP_KNOWN_REQUESTS  ( sizeof(rasDumpRequests) / sizeof(J9RASdumpRequest) )
@@ -2809,6 +2810,8 @@ runDumpAgent(struct J9JavaVM *vm, J9RASdumpAgent * agent, J9RASdumpContext * con
 			agent->prepState = *state;
 			TRIGGER_J9HOOK_VM_DUMP_START(vm->hookInterface, vm->internalVMFunctions->currentVMThread(vm), label, detail);
 			retVal = runDumpFunction( agent, label, context );
+			/* The dump function may have released exclusive access early (javadump request=lowpause) */
+			*state = agent->prepState;
 			TRIGGER_J9HOOK_VM_DUMP_END(vm->hookInterface, vm->internalVMFunctions->currentVMThread(vm), label, detail);
 			
 			if (context->dumpList) {
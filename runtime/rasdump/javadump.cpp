@@ -76,6 +76,8 @@
 /* Callback Function prototypes */
 UDATA writeFrameCallBack          (J9VMThread* vmThread, J9StackWalkState* state);
 UDATA writeExceptionFrameCallBack (J9VMThread* vmThread, void* userData, J9ROMClass* romClass, J9ROMMethod* romMethod, J9UTF8* sourceFile, UDATA lineNumber, J9ClassLoader* classLoader);
+UDATA captureFrameCallBack        (J9VMThread* vmThread, J9StackWalkState* state);
+UDATA captureExceptionFrameCallBack (J9VMThread* vmThread, void* userData, J9ROMClass* romClass, J9ROMMethod* romMethod, J9UTF8* sourceFile, UDATA lineNumber, J9ClassLoader* classLoader);
 void  writeLoaderCallBack         (void* classLoader, void* userData);
 void  writeLibrariesCallBack      (void* classLoader, void* userData);
 void  writeClassesCallBack        (void* classLoader, void* userData);
@@ -86,6 +88,9 @@ static UDATA innerMemCategoryCallBack (U_32 categoryCode, const char * categoryN
 static jvmtiIterationControl heapIteratorCallback   (J9JavaVM* vm, J9MM_IterateHeapDescriptor*   heapDescriptor,    void* userData);
 static jvmtiIterationControl spaceIteratorCallback  (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
 static jvmtiIterationControl regionIteratorCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+static jvmtiIterationControl captureHeapIteratorCallback   (J9JavaVM* vm, J9MM_IterateHeapDescriptor*   heapDescriptor,    void* userData);
+static jvmtiIterationControl captureSpaceIteratorCallback  (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
+static jvmtiIterationControl captureRegionIteratorCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
 static UDATA getObjectMonitorCount(J9JavaVM *vm);
 static UDATA getAllocatedVMThreadCount (J9JavaVM *vm);
 
@@ -119,6 +124,10 @@ UDATA handlerGetOwnedObjectMonitors (struct J9PortLibrary *, U_32, void *, void
 UDATA handlerIterateStackTrace      (struct J9PortLibrary *, U_32, void *, void *);
 UDATA handlerWriteJavaLangThreadInfo(struct J9PortLibrary *, U_32, void *, void *);
 UDATA handlerWriteStacks            (struct J9PortLibrary *, U_32, void *, void *);
+UDATA protectedCaptureStackTrace    (struct J9PortLibrary *, void *);
+UDATA protectedCaptureThreadBlockers (struct J9PortLibrary *, void *);
+UDATA protectedCaptureJavaLangThreadInfo (struct J9PortLibrary *, void *);
+UDATA handlerCaptureSnapshot        (struct J9PortLibrary *, U_32, void *, void *);
 
 /* associated structures for passing arguments are below the JavaCoreDumpWriter declaration */
 }
@@ -216,6 +225,8 @@ private :
 	/* Allow the callback functions access */
 	friend UDATA writeFrameCallBack          (J9VMThread* vmThread, J9StackWalkState* state);
 	friend UDATA writeExceptionFrameCallBack (J9VMThread* vmThread, void* userData, J9ROMClass* romClass, J9ROMMethod* romMethod, J9UTF8* sourceFile, UDATA lineNumber, J9ClassLoader* classLoader);
+	friend UDATA captureFrameCallBack        (J9VMThread* vmThread, J9StackWalkState* state);
+	friend UDATA captureExceptionFrameCallBack (J9VMThread* vmThread, void* userData, J9ROMClass* romClass, J9ROMMethod* romMethod, J9UTF8* sourceFile, UDATA lineNumber, J9ClassLoader* classLoader);
 	friend void  writeLoaderCallBack         (void* classLoader, void* userData);
 	friend void  writeLibrariesCallBack      (void* classLoader, void* userData);
 	friend void  writeClassesCallBack        (void* classLoader, void* userData);
@@ -225,6 +236,9 @@ private :
 	friend jvmtiIterationControl heapIteratorCallback   (J9JavaVM* vm, J9MM_IterateHeapDescriptor*   heapDescriptor,    void* userData);
 	friend jvmtiIterationControl spaceIteratorCallback  (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
 	friend jvmtiIterationControl regionIteratorCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend jvmtiIterationControl captureHeapIteratorCallback   (J9JavaVM* vm, J9MM_IterateHeapDescriptor*   heapDescriptor,    void* userData);
+	friend jvmtiIterationControl captureSpaceIteratorCallback  (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
+	friend jvmtiIterationControl captureRegionIteratorCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
 
 	/* sig_protect wrappers functions and handlers */
 	friend UDATA protectedWriteSection       (struct J9PortLibrary *, void *);
@@ -245,11 +259,20 @@ private :
 	friend UDATA handlerIterateStackTrace    (struct J9PortLibrary *, U_32, void *, void *);
 	friend UDATA handlerWriteJavaLangThreadInfo(struct J9PortLibrary *, U_32, void *, void *);
 	friend UDATA handlerWriteStacks(struct J9PortLibrary *, U_32, void *, void *);
+	friend UDATA protectedCaptureStackTrace  (struct J9PortLibrary *, void *);
+	friend UDATA protectedCaptureThreadBlockers (struct J9PortLibrary *, void *);
+	friend UDATA protectedCaptureJavaLangThreadInfo (struct J9PortLibrary *, void *);
 
 	/* Allow the functions used by hash tables access */
 	friend UDATA lockHashFunction(void* key, void* user);
 	friend UDATA lockHashEqualFunction(void* left, void* right, void* user);
 
+	/* Time spent writing one first level section */
+	struct SectionTime {
+		const char *name;
+		U_64 micros;
+	};
+
 	/* Directed node in lock graph */
 	struct DeadLockGraphNode {
 		J9VMThread *thread;
@@ -259,6 +282,159 @@ private :
 		UDATA cycle;
 	};
 
+	/* Object captured by a low pause snapshot, the class is kept as the object may move once the VM resumes */
+	struct SnapshotObject {
+		j9object_t object;
+		J9ROMClass *romClass;
+	};
+
+	/* Java stack frame captured by a low pause snapshot */
+	struct SnapshotFrame {
+		J9Method *method;
+		UDATA bytecodePCOffset;
+		UDATA framesWalked;
+		bool compiled;
+		/* Frames recovered from a throwable are already resolved to a location */
+		J9ROMClass *romClass;
+		J9ROMMethod *romMethod;
+		J9UTF8 *sourceFile;
+		UDATA lineNumber;
+	};
+
+	/* Object monitor entered by a thread, captured by a low pause snapshot */
+	struct SnapshotEnteredLock {
+		SnapshotObject object;
+		UDATA count;
+		UDATA depth;
+	};
+
+	/* Thread state captured by a low pause snapshot */
+	struct SnapshotThread {
+		SnapshotThread *next;
+		J9VMThread *vmThread;
+		J9AbstractThread *osThread;
+		j9object_t threadObject;
+		const char *name;
+		bool isCurrent;
+		UDATA javaState;
+		UDATA vmState;
+		UDATA javaPriority;
+		UDATA publicFlags;
+		bool javaLangThreadFailed;
+		I_64 javaLangThreadID;
+		bool isDaemon;
+		UDATA nativeThreadID;
+		UDATA nativePriority;
+		bool hasStackRange;
+		void *stackStart;
+		void *stackEnd;
+		I_64 cpuTime;
+		I_64 userTime;
+		UDATA category;
+		omrthread_monitor_t blockingMonitor;
+		bool blockingMonitorIsObject;
+		const char *blockingMonitorName;
+		SnapshotObject lockObject;
+		J9VMThread *lockOwner;
+		const char *lockOwnerName;
+		j9object_t lockOwnerThreadObject;
+		j9object_t lockOwnerObject;
+		const char *lockOwnerObjectName;
+		bool blockersFailed;
+		UDATA bytesAllocated;
+		SnapshotFrame *frames;
+		UDATA frameCount;
+		bool framesTruncated;
+		bool framesFromThrowable;
+		bool stackWalkFailed;
+		SnapshotEnteredLock *enteredLocks;
+		UDATA enteredLockCount;
+		bool enteredLocksFailed;
+	};
+
+	/* Monitor captured by a low pause snapshot, only the monitors the javacore reports are kept */
+	struct SnapshotMonitor {
+		SnapshotMonitor *next;
+		J9ThreadMonitor *monitor;
+		SnapshotObject object;
+		const char *name;
+		bool owned;
+		bool inflated;
+		J9VMThread *owner;
+		const char *ownerName;
+		UDATA ownerOSThreadID;
+		UDATA count;
+	};
+
+	/* Heap region captured by a low pause snapshot */
+	struct SnapshotHeapRegion {
+		SnapshotHeapRegion *next;
+		UDATA id;
+		const void *start;
+		UDATA size;
+		const char *name;
+	};
+
+	/* Heap space captured by a low pause snapshot, balanced spaces only keep the region totals */
+	struct SnapshotHeapSpace {
+		SnapshotHeapSpace *next;
+		UDATA id;
+		const char *name;
+		const void *regionStart;
+		UDATA regionSize;
+		SnapshotHeapRegion *regions;
+		SnapshotHeapRegion **regionTail;
+	};
+
+	/* Block of memory the snapshot records are carved out of */
+	struct SnapshotChunk {
+		SnapshotChunk *next;
+		UDATA used;
+		UDATA size;
+	};
+
+	/* With request=lowpause the raw thread, monitor and heap state is captured while the VM is
+	 * paused and only formatted once exclusive VM access has been released. The classUnloadMutex
+	 * is held for read until then, so the classes and methods referenced cannot be unloaded.
+	 */
+	struct Snapshot {
+		SnapshotChunk *chunks;
+		SnapshotFrame *frameScratch;
+		UDATA frameScratchSize;
+		UDATA frameScratchCount;
+		bool outOfMemory;
+		/* MEMINFO heap sub-section */
+		UDATA heapPosition;
+		bool heapFailed;
+		SnapshotHeapSpace *heapSpaces;
+		SnapshotHeapSpace **heapSpaceTail;
+		SnapshotHeapSpace *lastHeapSpace;
+		UDATA heapTotal;
+		UDATA heapTarget;
+		UDATA heapFree;
+		/* LOCKS section */
+		UDATA locksPosition;
+		bool monitorsLocked;
+		bool monitorsFailed;
+		UDATA monitorPoolTotal;
+		SnapshotMonitor *objectMonitors;
+		SnapshotMonitor **objectMonitorTail;
+		SnapshotMonitor *systemMonitors;
+		SnapshotMonitor **systemMonitorTail;
+		/* THREADS section */
+		bool threadsFailed;
+		bool threadWalkAborted;
+		SnapshotThread *threads;
+		SnapshotThread **threadTail;
+		UDATA threadCount;
+		/* Threads sorted by J9VMThread, built after release for the LOCKS section lookups */
+		SnapshotThread **threadIndex;
+		UDATA liveThreads;
+		UDATA daemonThreads;
+		UDATA exclusiveRequests;
+		UDATA inspectionHalts;
+	};
+
 	/* Internal convenience method for testing the context */
 	bool avoidLocks(void);
 
@@ -286,8 +462,38 @@ private :
 	void writeSharedClassSectionAllLayersStatsHelper(J9SharedClassJavacoreDataDescriptor* javacoreData);
 
 #endif
+	void writeSectionTimings(void);
 	void writeTrailer(void);
 
+	/* Internal methods for capturing the low pause snapshot and writing the sections from it */
+	void        startSnapshot                (void);
+	void        freeSnapshot                 (void);
+	void*       allocateSnapshotMemory       (UDATA size);
+	const char* copySnapshotString           (const char* string);
+	const char* captureThreadName            (J9VMThread* vmThread);
+	void        captureHeapSnapshot          (void);
+	void        captureMonitorSnapshot       (void);
+	void        captureThreadSnapshot        (void);
+	void        captureThread                (J9VMThread* vmThread, bool isCurrent);
+	void        captureThreadBlockers        (SnapshotThread* thread);
+	void        captureJavaLangThreadInfo    (SnapshotThread* thread);
+	UDATA       captureFrame                 (J9StackWalkState* state);
+	UDATA       captureExceptionFrame        (J9ROMClass* romClass, J9ROMMethod* romMethod, J9UTF8* sourceFile, UDATA lineNumber);
+	bool        addSnapshotFrame             (SnapshotFrame* frame);
+	void        indexSnapshotThreads         (void);
+	SnapshotThread* findSnapshotThread       (J9VMThread* vmThread);
+	static int  compareSnapshotThreads       (const void* left, const void* right);
+	void        writeSnapshotHeap            (void);
+	void        writeSnapshotMonitorSection  (void);
+	void        writeSnapshotMonitor         (SnapshotMonitor* monitor);
+	void        writeSnapshotDeadLocks       (void);
+	void        writeSnapshotDeadLockNode    (SnapshotThread* thread, int count);
+	void        writeMonitorSectionUnavailable (void);
+	void        writeSnapshotThreadSection   (void);
+	void        writeSnapshotThread          (SnapshotThread* thread);
+	void        writeSnapshotThreadBlockers  (SnapshotThread* thread);
+	void        writeSnapshotJavaStack       (SnapshotThread* thread);
+
 	/* Internal methods for writing the nested sections */
 	void        writeVMRuntimeState          (U_32 vmRuntimeState);
 	void        writeExceptionDetail         (j9object_t* exceptionRef);
@@ -303,11 +509,15 @@ private :
 	void        writeMonitorObject           (J9ThreadMonitor* monitor, j9object_t obj, blocked_thread_record *threadStore);
 	void        writeMonitor                 (J9ThreadMonitor* monitor);
 	void        writeSystemMonitor           (J9ThreadMonitor* monitor);
+	void        writeSystemMonitor           (J9ThreadMonitor* monitor, const char* name);
 	void        writeObject                  (j9object_t obj);
+	void        writeObject                  (j9object_t obj, J9ROMClass* romClass);
+	J9ROMClass* getObjectROMClass            (j9object_t obj);
 	void        writeThread                  (J9VMThread* vmThread, J9PlatformThread *nativeThread, UDATA vmstate, UDATA javaState, UDATA javaPriority, j9object_t lockObject, J9VMThread *lockOwnerThread);
 	void        writeThreadName              (J9VMThread* vmThread);
 	void        writeThreadBlockers          (J9VMThread* vmThread, UDATA vmstate, j9object_t lockObject, J9VMThread *lockOwnerThread );
 	UDATA       writeFrame                   (J9StackWalkState* state);
+	bool        writeFrameLocation           (J9Method* method, UDATA offsetPC, bool compiledMethod);
 	UDATA       writeExceptionFrame          (void *userData, J9ROMClass* romClass, J9ROMMethod* romMethod, J9UTF8* sourceFile, UDATA lineNumber);
 	void        writeLoader                  (J9ClassLoader* classLoader);
 	void        writeLibraries               (J9ClassLoader* classLoader);
@@ -317,6 +527,7 @@ private :
 	void        writeNativeAllocator         (const char * name, U_32 depth, BOOLEAN isRoot, UDATA liveBytes, UDATA liveAllocations);
 	IDATA       getOwnedObjectMonitors       (J9VMThread* vmThread, J9ObjectMonitorInfo* monitorInfos);
 	void        writeJavaLangThreadInfo      (J9VMThread* vmThread);
+	void        writeJavaLangThreadInfo      (I_64 threadID, bool isDaemon);
 	void        writeCPUinfo                 (void);
 #if defined(LINUX)
 	void        writeCgroupMetrics(void);
@@ -324,10 +535,19 @@ private :
 	void        writeThreadsWithNativeStacks(void);
 	void        writeThreadsJavaOnly(void);
 	void        writeThreadTime              (const char * timerName, I_64 nanoTime);
+	void        writeThreadCPUUsage          (I_64 cpuTime, I_64 userTime, UDATA category);
+	void        writeThreadPoolInfo          (UDATA liveThreads, UDATA daemonThreads, UDATA exclusiveRequests, UDATA inspectionHalts);
+	void        writeThreadSectionTrailer    (void);
+	void        writeHeapSpaceColumns        (void);
+	void        writeHeapSpace               (UDATA id, const char* name);
+	void        writeHeapSpace               (UDATA id, const void* regionStart, UDATA regionSize, const char* name);
+	void        writeHeapRegion              (UDATA id, const void* regionStart, UDATA regionSize, const char* spaceName, const char* regionName);
+	void        writeHeapTotals              (UDATA sizeTotal, UDATA sizeTarget, UDATA freeTotal);
 	void        writeThreadsUsageSummary     (void);
 	void        writeHookInfo                (struct OMRHookInfo4Dump *hookInfo);
 	void        writeHookInterface           (struct J9HookInterface **hookInterface);
 	/* Other internal methods */
+	void recordSectionTime(const char* name, U_64 startTime);
 	j9object_t getClassLoaderObject(J9ClassLoader* loader);
 	UDATA createPadding(const char* str, UDATA fieldWidth, char padChar, char* buffer);
 	void writeThreadState(UDATA threadState);
@@ -350,6 +570,10 @@ private :
 	const char *      _SpaceDescriptorName;
 	I_32              _TotalCategories;
 	UDATA             _AllocatedVMThreadCount;
+	bool              _LowPause;
+	Snapshot*         _Snapshot;
+	UDATA             _SectionCount;
+	SectionTime       _SectionTimes[16];
 
 	/* Static declared data */
 	static const unsigned int _MaximumExceptionNameLength;
@@ -360,6 +584,8 @@ private :
 	static const unsigned int _MaximumJavaStackDepth;
 	static const int _MaximumGCHistoryLines;
 	static const int _MaximumMonitorInfosPerThread;
+	static const UDATA _MaximumTimedSections;
+	static const UDATA _SnapshotChunkSize;
 };
 
 /* Static declared data instantiation */
@@ -371,6 +597,8 @@ const unsigned int JavaCoreDumpWriter::_MaximumGPValueLength(512);
 const unsigned int JavaCoreDumpWriter::_MaximumJavaStackDepth(100000);
 const int JavaCoreDumpWriter::_MaximumGCHistoryLines(2000);
 const int JavaCoreDumpWriter::_MaximumMonitorInfosPerThread(32);
+const UDATA JavaCoreDumpWriter::_MaximumTimedSections(16);
+const UDATA JavaCoreDumpWriter::_SnapshotChunkSize(64 * 1024);
 
 class sectionClosure {
 private:
@@ -403,7 +631,21 @@ struct walkClosure {
 	do { \
 		sectionClosure closure(&JavaCoreDumpWriter::section, this); \
 		UDATA sink; \
+		U_64 sectionStart = j9time_hires_clock(); \
 		retVal = j9sig_protect(protectedWriteSection, &closure, handlerWriteSection, this, J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN, &sink) || retVal; \
+		recordSectionTime(#section, sectionStart); \
+	} while (0);
+
+/* As CALL_PROTECT, but for capturing the low pause snapshot. Nothing is written while capturing,
+ * so a failure is only recorded and reported when the snapshot is formatted.
+ */
+#define CAPTURE_PROTECT(capture, failed) \
+	do { \
+		sectionClosure closure(&JavaCoreDumpWriter::capture, this); \
+		UDATA sink; \
+		U_64 sectionStart = j9time_hires_clock(); \
+		failed = (J9PORT_SIG_EXCEPTION_OCCURRED == j9sig_protect(protectedWriteSection, &closure, handlerCaptureSnapshot, this, J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN, &sink)) || failed; \
+		recordSectionTime(#capture, sectionStart); \
 	} while (0);
 
 /**************************************************************************************************/
@@ -427,7 +669,10 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	_PreemptLocked(false),
 	_ThreadsWalkStarted(false),
 	_Agent(agent),
-	_TotalCategories(-1)
+	_TotalCategories(-1),
+	_LowPause(false),
+	_Snapshot(NULL),
+	_SectionCount(0)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
 	bool bufferWrites=false;
@@ -456,8 +701,17 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	  && ((_Context->eventFlags & (J9RAS_DUMP_ON_GP_FAULT | J9RAS_DUMP_ON_ABORT_SIGNAL)) == 0)
 	  && ((_Agent->prepState & J9RAS_DUMP_GOT_EXCLUSIVE_VM_ACCESS) == J9RAS_DUMP_GOT_EXCLUSIVE_VM_ACCESS);
 
+	/* With request=lowpause the dump is buffered in memory and the file is only written once
+	 * exclusive access has been released. Where possible the thread, monitor and heap state is
+	 * only captured in the pause and formatted after release as well, see startSnapshot().
+	 */
+	_LowPause = bufferWrites && ((_Agent->requestMask & J9RAS_DUMP_DO_LOW_PAUSE) == J9RAS_DUMP_DO_LOW_PAUSE);
+
 	/* It's a single file so open it */
-	_OutputStream.open(_FileName, bufferWrites);
+	_OutputStream.open(_FileName, bufferWrites, _LowPause);
+
+	/* Decide whether the thread, monitor and heap state can be formatted after the pause */
+	startSnapshot();
 
 	/* Write the sections, these return void so we throw away the per section return value.
 	 * We consolidate the return values for all of the sections so we know after we finish
@@ -476,18 +730,20 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	 */
 	omrthread_monitor_enter(_VirtualMachine->monitorTableMutex);
 	omrthread_t self = omrthread_self();
-	if (!omrthread_lib_try_lock(self)) {
+	if (NULL != _Snapshot) {
+		/* The LOCKS and THREADS sections are formatted here once exclusive access has been released */
+		_Snapshot->locksPosition = _OutputStream.getDeferredPosition();
+		if (!omrthread_lib_try_lock(self)) {
+			_Snapshot->monitorsLocked = true;
+			CAPTURE_PROTECT(captureMonitorSnapshot, _Snapshot->monitorsFailed);
+			omrthread_lib_unlock(self);
+		}
+	} else if (!omrthread_lib_try_lock(self)) {
 		/* got both locks so we shouldn't deadlock getting thread state */
 		CALL_PROTECT(writeMonitorSection, _Error);
 		omrthread_lib_unlock(self);
 	} else {
-		/* Write the section header */
-		_OutputStream.writeCharacters(
-			"0SECTION       LOCKS subcomponent dump routine\n"
-			"NULL           ===============================\n"
-			"1LKMONPOOLDUMP Monitor Pool Dump unavailable [locked]\n"
-			"1LKREGMONDUMP  JVM System Monitor Dump unavailable [locked]\n"
-			"NULL           ------------------------------------------------------------------------\n");
+		writeMonitorSectionUnavailable();
 	}
 	omrthread_monitor_exit(_VirtualMachine->monitorTableMutex);
 
@@ -497,7 +753,11 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 			_PreemptLocked = true; /* we got the lock */
 		}
 	}
-	CALL_PROTECT(writeThreadSection, _Error);
+	if (NULL != _Snapshot) {
+		CAPTURE_PROTECT(captureThreadSnapshot, _Snapshot->threadsFailed);
+	} else {
+		CALL_PROTECT(writeThreadSection, _Error);
+	}
 	if (_PreemptLocked) {
 		compareAndSwapUDATA(&rasDumpPreemptLock, 1, 0);
 		_PreemptLocked = false;
@@ -514,8 +774,34 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	CALL_PROTECT(writeSharedClassSection, _Error);
 #endif
 	CALL_PROTECT(writeClassSection, _Error);
+	CALL_PROTECT(writeSectionTimings, _Error);
 	CALL_PROTECT(writeTrailer, _Error);
 
+	if (_LowPause) {
+		/* Everything needing the paused VM has been captured, let the Java threads run
+		 * again before formatting the snapshot and doing the file I/O.
+		 */
+		_Agent->prepState = releaseExclusiveAfterDump(_VirtualMachine, _Context, _Agent->prepState);
+
+		if (NULL != _Snapshot) {
+			/* The snapshot sections are written at the end of the buffer and then moved back into place,
+			 * the later position first so that the earlier one is still valid.
+			 */
+			UDATA start = _OutputStream.getDeferredPosition();
+			CALL_PROTECT(writeSnapshotMonitorSection, _Error);
+			CALL_PROTECT(writeSnapshotThreadSection, _Error);
+			_OutputStream.moveDeferredData(_Snapshot->locksPosition, start);
+
+			start = _OutputStream.getDeferredPosition();
+			CALL_PROTECT(writeSnapshotHeap, _Error);
+			_OutputStream.moveDeferredData(_Snapshot->heapPosition, start);
+
+			freeSnapshot();
+		}
+
+		_OutputStream.flush();
+	}
+
 	/* Record the status of the operation */
 	_FileMode = _FileMode || _OutputStream.isOpen();
 	_Error    = _Error    || _OutputStream.isError();
@@ -694,8 +980,16 @@ JavaCoreDumpWriter::writeTitleSection(void)
 			}
 		}
 
+		moreRequests = moreRequests >> 1;
 		if ((_Agent->requestMask & J9RAS_DUMP_DO_PREEMPT_THREADS) == J9RAS_DUMP_DO_PREEMPT_THREADS) {
 			_OutputStream.writeCharacters("preempt");
+			if (moreRequests) {
+				_OutputStream.writeCharacters("+");
+			}
+		}
+
+		if ((_Agent->requestMask & J9RAS_DUMP_DO_LOW_PAUSE) == J9RAS_DUMP_DO_LOW_PAUSE) {
+			_OutputStream.writeCharacters("lowpause");
 		}
 
 		_OutputStream.writeCharacters(")");
@@ -1363,6 +1657,23 @@ JavaCoreDumpWriter::writeEnvironmentSection(void)
 	);
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::recordSectionTime() method implementation                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::recordSectionTime(const char* name, U_64 startTime)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (_SectionCount < _MaximumTimedSections) {
+		_SectionTimes[_SectionCount].name = name;
+		_SectionTimes[_SectionCount].micros = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+		_SectionCount += 1;
+	}
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* JavaCoreDumpWriter::createPadding() method implementation                            */
@@ -1403,7 +1714,13 @@ JavaCoreDumpWriter::writeMemorySection(void)
 		"NULL           \n"
 		"1STHEAPTYPE    Object Memory\n"
 	);
-	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_heaps(_VirtualMachine, _PortLibrary, 0, heapIteratorCallback, this);
+	if (NULL != _Snapshot) {
+		/* The heap is written here from the snapshot once exclusive access has been released */
+		_Snapshot->heapPosition = _OutputStream.getDeferredPosition();
+		CAPTURE_PROTECT(captureHeapSnapshot, _Snapshot->heapFailed);
+	} else {
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_heaps(_VirtualMachine, _PortLibrary, 0, heapIteratorCallback, this);
+	}
 
 	/* Write the VM memory segments sub-section */
 	_OutputStream.writeCharacters(
@@ -1470,6 +1787,134 @@ JavaCoreDumpWriter::writeMemorySection(void)
 	);
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeHeapSpaceColumns() method implementation                              */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeHeapSpaceColumns(void)
+{
+	_OutputStream.writeCharacters("NULL           ");
+#if defined(J9VM_ENV_DATA64)
+	_OutputStream.writeCharacters(
+		"id                 start              end                size               space");
+#else
+	_OutputStream.writeCharacters(
+		"id         start      end        size       space");
+#endif
+
+	/* Balanced (VLHGC) has a lot more regions than the normal GC modes so we collapse down to spaces */
+	if (J9_GC_POLICY_BALANCED == ((OMR_VM *)_VirtualMachine->omrVM)->gcPolicy) {
+		_OutputStream.writeCharacters("\n");
+	} else {
+		_OutputStream.writeCharacters("/region\n");
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeHeapSpace() method implementation                                     */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeHeapSpace(UDATA id, const char* name)
+{
+	/* A space whose regions are listed individually after it */
+	_OutputStream.writeCharacters("1STHEAPSPACE   ");
+	_OutputStream.writePointer((void *)id);
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writeVPrintf("%*c--%*c",  sizeof(void *), ' ',  sizeof(void *), ' ');
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writeVPrintf("%*c--%*c",  sizeof(void *), ' ',  sizeof(void *), ' ');
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writeVPrintf("%*c--%*c",  sizeof(void *), ' ',  sizeof(void *), ' ');
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writeCharacters(name);
+	_OutputStream.writeCharacters(" \n");
+}
+
+void
+JavaCoreDumpWriter::writeHeapSpace(UDATA id, const void* regionStart, UDATA regionSize, const char* name)
+{
+	/* A space summarising all of its regions */
+	_OutputStream.writeCharacters("1STHEAPSPACE   ");
+	_OutputStream.writePointer((void *)id);
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writePointer(regionStart);
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writePointer((const void*)((UDATA)regionStart + regionSize));
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, regionSize);
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writeCharacters(name);
+	_OutputStream.writeCharacters(" \n");
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeHeapRegion() method implementation                                    */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeHeapRegion(UDATA id, const void* regionStart, UDATA regionSize, const char* spaceName, const char* regionName)
+{
+	_OutputStream.writeCharacters("1STHEAPREGION  ");
+	_OutputStream.writePointer((void *)id);
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writePointer(regionStart);
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writePointer((const void*)((UDATA)regionStart + regionSize));
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, regionSize);
+	_OutputStream.writeCharacters(" ");
+	_OutputStream.writeCharacters(spaceName);
+	_OutputStream.writeCharacters("/");
+	_OutputStream.writeCharacters(regionName);
+	_OutputStream.writeCharacters(" \n");
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeHeapTotals() method implementation                                    */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeHeapTotals(UDATA sizeTotal, UDATA sizeTarget, UDATA freeTotal)
+{
+	UDATA allocTotal = sizeTotal - freeTotal;
+	int decimalLength = sizeof(void*) == 4 ? 10 : 20;
+
+	_OutputStream.writeCharacters("NULL\n");
+	_OutputStream.writeCharacters("1STHEAPTOTAL   ");
+	_OutputStream.writeCharacters("Total memory:        ");
+	_OutputStream.writeVPrintf(FORMAT_SIZE_DECIMAL, decimalLength, sizeTotal);
+	_OutputStream.writeCharacters(" (");
+	_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, sizeTotal);
+	_OutputStream.writeCharacters(")\n");
+	if (sizeTarget != 0) {
+		_OutputStream.writeCharacters("1STHEAPTARGET  ");
+		_OutputStream.writeCharacters("Target memory:       ");
+		_OutputStream.writeVPrintf(FORMAT_SIZE_DECIMAL, decimalLength, sizeTarget);
+		_OutputStream.writeCharacters(" (");
+		_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, sizeTarget);
+		_OutputStream.writeCharacters(")\n");
+	}
+	_OutputStream.writeCharacters("1STHEAPINUSE   ");
+	_OutputStream.writeCharacters("Total memory in use: ");
+	_OutputStream.writeVPrintf(FORMAT_SIZE_DECIMAL, decimalLength, allocTotal);
+	_OutputStream.writeCharacters(" (");
+	_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, allocTotal);
+	_OutputStream.writeCharacters(")\n");
+	_OutputStream.writeCharacters("1STHEAPFREE    ");
+	_OutputStream.writeCharacters("Total memory free:   ");
+	_OutputStream.writeVPrintf(FORMAT_SIZE_DECIMAL, decimalLength, freeTotal);
+	_OutputStream.writeCharacters(" (");
+	_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, freeTotal);
+	_OutputStream.writeCharacters(")\n");
+	_OutputStream.writeCharacters("NULL\n");
+}
+
 /**
  * Callback used by to count memory categories with j9mem_walk_categories
  */
@@ -1841,21 +2286,8 @@ JavaCoreDumpWriter::writeThreadSection(void)
 	);
 
 	/* Write the thread counts */
-	_OutputStream.writeCharacters("NULL\n");
-	_OutputStream.writeCharacters(
-		"1XMPOOLINFO    JVM Thread pool info:\n");
-	_OutputStream.writeCharacters(
-		"2XMPOOLTOTAL       Current total number of pooled threads: ");
-	_OutputStream.writeInteger(_AllocatedVMThreadCount, "%i");
-	_OutputStream.writeCharacters("\n");
-	_OutputStream.writeCharacters(
-		"2XMPOOLLIVE        Current total number of live threads: ");
-	_OutputStream.writeInteger(_VirtualMachine->totalThreadCount, "%i");
-	_OutputStream.writeCharacters("\n");
-		_OutputStream.writeCharacters(
-		"2XMPOOLDAEMON      Current total number of live daemon threads: ");
-	_OutputStream.writeInteger(_VirtualMachine->daemonThreadCount, "%i");
-	_OutputStream.writeCharacters("\n");
+	writeThreadPoolInfo(_VirtualMachine->totalThreadCount, _VirtualMachine->daemonThreadCount,
+		_VirtualMachine->exclusiveVMAccessRequestCount, _VirtualMachine->inspectionHaltCount);
 
 #if !defined(OSX)
 	/* if thread preempt is enabled, and we have the lock, then collect the native stacks */
@@ -1895,6 +2327,52 @@ JavaCoreDumpWriter::writeThreadSection(void)
 		_OutputStream.writeCharacters("1XMWLKTHDINF   Multiple dumps in progress, native stacks not collected\n");
 	}
 
+	writeThreadSectionTrailer();
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeThreadPoolInfo() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeThreadPoolInfo(UDATA liveThreads, UDATA daemonThreads, UDATA exclusiveRequests, UDATA inspectionHalts)
+{
+	_OutputStream.writeCharacters("NULL\n");
+	_OutputStream.writeCharacters(
+		"1XMPOOLINFO    JVM Thread pool info:\n");
+	_OutputStream.writeCharacters(
+		"2XMPOOLTOTAL       Current total number of pooled threads: ");
+	_OutputStream.writeInteger(_AllocatedVMThreadCount, "%i");
+	_OutputStream.writeCharacters("\n");
+	_OutputStream.writeCharacters(
+		"2XMPOOLLIVE        Current total number of live threads: ");
+	_OutputStream.writeInteger(liveThreads, "%i");
+	_OutputStream.writeCharacters("\n");
+		_OutputStream.writeCharacters(
+		"2XMPOOLDAEMON      Current total number of live daemon threads: ");
+	_OutputStream.writeInteger(daemonThreads, "%i");
+	_OutputStream.writeCharacters("\n");
+	_OutputStream.writeCharacters(
+		"2XMEXCLUSIVE       Exclusive VM access requests: ");
+	_OutputStream.writeInteger(exclusiveRequests, "%zu");
+	_OutputStream.writeCharacters("\n");
+	_OutputStream.writeCharacters(
+		"2XMINSPECTHALT     Single thread halts for inspection: ");
+	_OutputStream.writeInteger(inspectionHalts, "%zu");
+	_OutputStream.writeCharacters("\n");
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeThreadSectionTrailer() method implementation                          */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeThreadSectionTrailer(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
 	/* Only display the thread trace if we have a current thread, if this is event where "current thread" is meaningful
 	 * and this isn't a thrstop event. Trace may receive the call to the J9HOOK_VM_THREAD_END hook first and clean up
 	 * the trace data for this thread first.
@@ -2459,50 +2937,1468 @@ JavaCoreDumpWriter::writeThreadsJavaOnly(void)
 	_OutputStream.writeCharacters("NULL           ------------------------------------------------------------------------\n");
 }
 
-
 /**************************************************************************************************/
 /*                                                                                                */
-/* JavaCoreDumpWriter::writeClassSection() method implementation                                  */
+/* JavaCoreDumpWriter::startSnapshot() method implementation                                      */
 /*                                                                                                */
 /**************************************************************************************************/
 void
-JavaCoreDumpWriter::writeClassSection(void)
+JavaCoreDumpWriter::startSnapshot(void)
 {
-	/* Write the section and first sub-section header */
-	_OutputStream.writeCharacters(
-		"0SECTION       CLASSES subcomponent dump routine\n"
-		"NULL           =================================\n"
-		"1CLTEXTCLLOS   \tClassloader summaries\n"
-		"1CLTEXTCLLSS   \t\t12345678: 1=primordial,2=extension,3=shareable,4=middleware,5=system,6=trusted,7=application,8=delegating\n"
-	);
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	J9VMThread* vmThread = _Context->onThread;
 
-	pool_do(_VirtualMachine->classLoaderBlocks,writeLoaderCallBack, this);
+	if (!_LowPause || avoidLocks()) {
+		return;
+	}
 
-	/* Write the sub-section header */
-	_OutputStream.writeCharacters(
-		"1CLTEXTCLLIB   \tClassLoader loaded libraries\n"
-	);
+	/* Native stacks can only be collected from the paused threads, and a dump taken with nested
+	 * exclusive access (e.g. from inside a GC) would hold the class unload lock against itself.
+	 * Both keep formatting the sections in the pause.
+	 */
+	if (((_Agent->requestMask & J9RAS_DUMP_DO_PREEMPT_THREADS) == J9RAS_DUMP_DO_PREEMPT_THREADS)
+		|| ((NULL != vmThread) && (1 != vmThread->omrVMThread->exclusiveCount))
+	) {
+		return;
+	}
 
-	pool_do(_VirtualMachine->classLoaderBlocks, writeLibrariesCallBack, this);
+	Snapshot* snapshot = (Snapshot*)j9mem_allocate_memory(sizeof(Snapshot), OMRMEM_CATEGORY_VM);
+	if (NULL == snapshot) {
+		return;
+	}
 
-	/* Write the sub-section header */
-	_OutputStream.writeCharacters(
-		"1CLTEXTCLLOD   \tClassLoader loaded classes\n"
-	);
+	/* Only the GC takes the class unload lock for write and it cannot run while we hold exclusive
+	 * access, so the read lock is available. Holding it until the snapshot is freed keeps the
+	 * classes and methods it references loaded once the VM resumes.
+	 */
+#if defined(J9VM_JIT_CLASS_UNLOAD_RWMONITOR)
+	omrthread_rwmutex_enter_read(_VirtualMachine->classUnloadMutex);
+#else
+	if (0 != omrthread_monitor_try_enter(_VirtualMachine->classUnloadMutex)) {
+		j9mem_free_memory(snapshot);
+		return;
+	}
+#endif /* J9VM_JIT_CLASS_UNLOAD_RWMONITOR */
 
-	pool_do(_VirtualMachine->classLoaderBlocks, writeClassesCallBack, this);
+	memset(snapshot, 0, sizeof(Snapshot));
+	snapshot->heapSpaceTail = &snapshot->heapSpaces;
+	snapshot->objectMonitorTail = &snapshot->objectMonitors;
+	snapshot->systemMonitorTail = &snapshot->systemMonitors;
+	snapshot->threadTail = &snapshot->threads;
+	_Snapshot = snapshot;
+}
 
-	/* Write the section trailer */
-	_OutputStream.writeCharacters(
-		"NULL           ------------------------------------------------------------------------\n"
-	);
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::freeSnapshot() method implementation                                       */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::freeSnapshot(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	SnapshotChunk* chunk = _Snapshot->chunks;
+
+	while (NULL != chunk) {
+		SnapshotChunk* next = chunk->next;
+		j9mem_free_memory(chunk);
+		chunk = next;
+	}
+	if (NULL != _Snapshot->frameScratch) {
+		j9mem_free_memory(_Snapshot->frameScratch);
+	}
+	if (NULL != _Snapshot->threadIndex) {
+		j9mem_free_memory(_Snapshot->threadIndex);
+	}
+
+#if defined(J9VM_JIT_CLASS_UNLOAD_RWMONITOR)
+	omrthread_rwmutex_exit_read(_VirtualMachine->classUnloadMutex);
+#else
+	omrthread_monitor_exit(_VirtualMachine->classUnloadMutex);
+#endif /* J9VM_JIT_CLASS_UNLOAD_RWMONITOR */
+
+	j9mem_free_memory(_Snapshot);
+	_Snapshot = NULL;
 }
 
-/**
- * JavaCoreDumpWriter::writeHookSection() method implementation
- *
- * 0SECTION       HOOK subcomponent dump routine
- * NULL           ==============================
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::allocateSnapshotMemory() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void*
+JavaCoreDumpWriter::allocateSnapshotMemory(UDATA size)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	SnapshotChunk* chunk = _Snapshot->chunks;
+	UDATA alignedSize = (size + sizeof(UDATA) - 1) & ~(sizeof(UDATA) - 1);
+
+	if ((NULL == chunk) || ((chunk->size - chunk->used) < alignedSize)) {
+		UDATA chunkSize = OMR_MAX(alignedSize, _SnapshotChunkSize);
+
+		chunk = (SnapshotChunk*)j9mem_allocate_memory(sizeof(SnapshotChunk) + chunkSize, OMRMEM_CATEGORY_VM);
+		if (NULL == chunk) {
+			_Snapshot->outOfMemory = true;
+			return NULL;
+		}
+		chunk->next = _Snapshot->chunks;
+		chunk->used = 0;
+		chunk->size = chunkSize;
+		_Snapshot->chunks = chunk;
+	}
+
+	void* memory = ((U_8*)(chunk + 1)) + chunk->used;
+	chunk->used += alignedSize;
+	memset(memory, 0, size);
+
+	return memory;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::copySnapshotString() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+const char*
+JavaCoreDumpWriter::copySnapshotString(const char* string)
+{
+	if (NULL == string) {
+		return NULL;
+	}
+
+	UDATA length = strlen(string) + 1;
+	char* copy = (char*)allocateSnapshotMemory(length);
+	if (NULL == copy) {
+		return "<name unavailable>";
+	}
+	memcpy(copy, string, length);
+
+	return copy;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::captureThreadName() method implementation                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+const char*
+JavaCoreDumpWriter::captureThreadName(J9VMThread* vmThread)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	const char* name = "[osthread]";
+
+	if (vmThread) {
+		void *args[] = {_VirtualMachine, vmThread};
+		const char *nameClean = "";
+		const char *nameFault = nameClean;
+
+		/* As writeThreadName(), the name is copied as the thread object can change once the VM resumes */
+		if (j9sig_protect(protectedGetVMThreadName, args, handlerGetVMThreadName, (UDATA*)&nameFault, J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN, (UDATA*)&nameClean) == J9PORT_SIG_EXCEPTION_OCCURRED) {
+			name = nameFault;
+		} else if (nameClean != NULL) {
+			name = copySnapshotString(nameClean);
+		} else {
+			name = "<name locked>";
+		}
+		releaseOMRVMThreadName(vmThread->omrVMThread);
+	}
+
+	return name;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::captureHeapSnapshot() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::captureHeapSnapshot(void)
+{
+	J9MemoryManagerFunctions* mmFuncs = _VirtualMachine->memoryManagerFunctions;
+
+	mmFuncs->j9mm_iterate_heaps(_VirtualMachine, _PortLibrary, 0, captureHeapIteratorCallback, this);
+
+	_Snapshot->heapTotal = mmFuncs->j9gc_heap_total_memory(_VirtualMachine);
+	_Snapshot->heapTarget = mmFuncs->j9gc_get_softmx(_VirtualMachine);
+	_Snapshot->heapFree = mmFuncs->j9gc_heap_free_memory(_VirtualMachine);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeSnapshotHeap() method implementation                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeSnapshotHeap(void)
+{
+	bool balanced = (J9_GC_POLICY_BALANCED == ((OMR_VM *)_VirtualMachine->omrVM)->gcPolicy);
+
+	for (SnapshotHeapSpace* space = _Snapshot->heapSpaces; NULL != space; space = space->next) {
+		writeHeapSpaceColumns();
+		if (balanced) {
+			writeHeapSpace(space->id, space->regionStart, space->regionSize, space->name);
+		} else {
+			writeHeapSpace(space->id, space->name);
+			for (SnapshotHeapRegion* region = space->regions; NULL != region; region = region->next) {
+				writeHeapRegion(region->id, region->start, region->size, space->name, region->name);
+			}
+		}
+		writeHeapTotals(_Snapshot->heapTotal, _Snapshot->heapTarget, _Snapshot->heapFree);
+	}
+
+	if (_Snapshot->heapFailed) {
+		_OutputStream.writeCharacters("1INTERNAL      In-flight data encountered. Output may be missing or incomplete.\n");
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::captureMonitorSnapshot() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::captureMonitorSnapshot(void)
+{
+	/* As writeMonitorSection(), the caller holds the monitorTableMutex and the thread library monitor_mutex */
+	J9ThreadMonitor* monitor = NULL;
+	omrthread_monitor_walk_state_t walkState;
+
+	_Snapshot->monitorPoolTotal = getObjectMonitorCount(_VirtualMachine);
+
+	omrthread_monitor_init_walk(&walkState);
+
+	while ( NULL != (monitor = omrthread_monitor_walk_no_locking(&walkState)) ) {
+		J9ThreadAbstractMonitor* lock = (J9ThreadAbstractMonitor*)monitor;
+		bool isObjectMonitor = ((lock->flags & J9THREAD_MONITOR_OBJECT) == J9THREAD_MONITOR_OBJECT);
+		j9object_t obj = isObjectMonitor ? (j9object_t)lock->userData : NULL;
+		J9VMThread* owner = NULL;
+		UDATA count = 0;
+		/* lock->owner is volatile and may change underneath us, cache the value since this is a snapshot of VM state. */
+		J9Thread* lockOwner = lock->owner;
+
+		if (obj) {
+			J9VMThread tenantMarker;
+
+			memset(&tenantMarker, 0, sizeof(J9VMThread));
+
+			owner = getObjectMonitorOwner(_VirtualMachine, &tenantMarker, obj, &count);
+		} else if (lockOwner) {
+			owner = getVMThreadFromOMRThread(_VirtualMachine, lockOwner);
+			count = lock->count;
+		}
+
+		/* Skip monitor if not interesting, as writeMonitorObject() does */
+		if ((obj || (lock->name == 0)) && (owner == 0) && (lockOwner == 0) && (lock->waiting == 0)) {
+			continue;
+		}
+
+		SnapshotMonitor* record = (SnapshotMonitor*)allocateSnapshotMemory(sizeof(SnapshotMonitor));
+		if (NULL == record) {
+			break;
+		}
+
+		record->monitor = monitor;
+		if (obj) {
+			record->object.object = obj;
+			record->object.romClass = getObjectROMClass(obj);
+		} else {
+			record->name = copySnapshotString(omrthread_monitor_get_name(monitor));
+		}
+		record->inflated = (lock->flags & J9THREAD_MONITOR_INFLATED) != 0;
+		record->owned = (NULL != owner) || (NULL != lockOwner);
+		record->owner = owner;
+		record->count = count;
+
+		if (record->owned) {
+			/* See jvmfree.c : recycleVMThread, dead threads are stored in "halted for inspection mode" */
+			if (owner && owner->publicFlags == J9_PUBLIC_FLAGS_HALT_THREAD_INSPECTION) {
+				record->ownerName = "<dead thread>";
+			} else {
+				record->ownerName = captureThreadName(owner);
+			}
+			if (NULL == owner) {
+				record->ownerOSThreadID = omrthread_get_osId(lockOwner);
+			}
+		}
+
+		if (isObjectMonitor) {
+			*_Snapshot->objectMonitorTail = record;
+			_Snapshot->objectMonitorTail = &record->next;
+		} else {
+			*_Snapshot->systemMonitorTail = record;
+			_Snapshot->systemMonitorTail = &record->next;
+		}
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeMonitorSectionUnavailable() method implementation                     */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeMonitorSectionUnavailable(void)
+{
+	/* Write the section header */
+	_OutputStream.writeCharacters(
+		"0SECTION       LOCKS subcomponent dump routine\n"
+		"NULL           ===============================\n"
+		"1LKMONPOOLDUMP Monitor Pool Dump unavailable [locked]\n"
+		"1LKREGMONDUMP  JVM System Monitor Dump unavailable [locked]\n"
+		"NULL           ------------------------------------------------------------------------\n");
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeSnapshotMonitorSection() method implementation                        */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeSnapshotMonitorSection(void)
+{
+	SnapshotMonitor* monitor = NULL;
+
+	if (!_Snapshot->monitorsLocked) {
+		writeMonitorSectionUnavailable();
+		return;
+	}
+
+	/* Write the section header */
+	_OutputStream.writeCharacters(
+		"0SECTION       LOCKS subcomponent dump routine\n"
+		"NULL           ===============================\n"
+	);
+
+	/* Write the object locks */
+	_OutputStream.writeCharacters(
+		"NULL           \n"
+		"1LKPOOLINFO    Monitor pool info:\n"
+		"2LKPOOLTOTAL     Current total number of monitors: "
+	);
+
+	_OutputStream.writeInteger(_Snapshot->monitorPoolTotal, "%zu");
+	_OutputStream.writeCharacters("\n");
+	_OutputStream.writeCharacters("NULL           \n");
+
+	if (_Snapshot->threadWalkAborted) {
+		_OutputStream.writeCharacters(
+			"1LKTHRERR            <aborting search for blocked and waiting threads due to exiting thread>\n"
+			"NULL           \n" );
+	}
+
+	/* Write the object monitors */
+	_OutputStream.writeCharacters("1LKMONPOOLDUMP Monitor Pool Dump (flat & inflated object-monitors):\n");
+
+	for (monitor = _Snapshot->objectMonitors; NULL != monitor; monitor = monitor->next) {
+		writeSnapshotMonitor(monitor);
+	}
+
+	/* Write the system monitors */
+	_OutputStream.writeCharacters(
+		"NULL           \n"
+		"1LKREGMONDUMP  JVM System Monitor Dump (registered monitors):\n"
+	);
+
+	for (monitor = _Snapshot->systemMonitors; NULL != monitor; monitor = monitor->next) {
+		writeSnapshotMonitor(monitor);
+	}
+
+	if (_Snapshot->monitorsFailed) {
+		_OutputStream.writeCharacters("1INTERNAL      In-flight data encountered. Output may be missing or incomplete.\n");
+	}
+
+	/* Write the deadlocks */
+	writeSnapshotDeadLocks();
+
+	/* Write the section trailer */
+	_OutputStream.writeCharacters(
+		"NULL           \n"
+		"NULL           ------------------------------------------------------------------------\n"
+	);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeSnapshotMonitor() method implementation                               */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeSnapshotMonitor(SnapshotMonitor* monitor)
+{
+	SnapshotThread* thread = NULL;
+	int blockedThreadCount = 0;
+	int waitingThreadCount = 0;
+
+	/* Describe the monitor */
+	if (monitor->object.object) {
+		_OutputStream.writeCharacters("2LKMONINUSE      ");
+		writeMonitor(monitor->monitor);
+		_OutputStream.writeCharacters("\n");
+		_OutputStream.writeCharacters("3LKMONOBJECT       ");
+		writeObject(monitor->object.object, monitor->object.romClass);
+		_OutputStream.writeCharacters(": ");
+	} else {
+		_OutputStream.writeCharacters("2LKREGMON          ");
+		writeSystemMonitor(monitor->monitor, monitor->name);
+	}
+
+	/* Describe its owning thread */
+	if (monitor->owned) {
+		if (monitor->inflated) {
+			_OutputStream.writeCharacters("owner \"");
+		} else {
+			_OutputStream.writeCharacters("Flat locked by \"");
+		}
+		_OutputStream.writeCharacters(monitor->ownerName);
+		_OutputStream.writeCharacters("\" (");
+		if (monitor->owner) {
+			_OutputStream.writeCharacters("J9VMThread:");
+			_OutputStream.writePointer((void*)monitor->owner);
+		} else {
+			_OutputStream.writeCharacters("native thread ID:");
+			_OutputStream.writeInteger(monitor->ownerOSThreadID);
+		}
+		_OutputStream.writeCharacters("), entry count ");
+		_OutputStream.writeInteger(monitor->count, "%zu");
+	} else {
+		_OutputStream.writeCharacters("<unowned>");
+	}
+
+	_OutputStream.writeCharacters("\n");
+
+	for (thread = _Snapshot->threads; NULL != thread; thread = thread->next) {
+		if ((thread->blockingMonitor == monitor->monitor) && (thread->vmState == J9VMTHREAD_STATE_BLOCKED)) {
+			/* Output the list header */
+			if (blockedThreadCount == 0) {
+				_OutputStream.writeCharacters("3LKWAITERQ            Waiting to enter:\n");
+			}
+
+			_OutputStream.writeCharacters("3LKWAITER                \"");
+			_OutputStream.writeCharacters(thread->name);
+			_OutputStream.writeCharacters("\" (J9VMThread:");
+			_OutputStream.writePointer(thread->vmThread);
+			_OutputStream.writeCharacters(")\n");
+
+			blockedThreadCount++;
+		}
+	}
+
+	for (thread = _Snapshot->threads; NULL != thread; thread = thread->next) {
+		if ((thread->blockingMonitor == monitor->monitor)
+			&& ((thread->vmState == J9VMTHREAD_STATE_WAITING) || (thread->vmState == J9VMTHREAD_STATE_WAITING_TIMED))
+		) {
+			/* Output the list header */
+			if (waitingThreadCount == 0) {
+				_OutputStream.writeCharacters("3LKNOTIFYQ            Waiting to be notified:\n");
+			}
+
+			_OutputStream.writeCharacters("3LKWAITNOTIFY            \"");
+			_OutputStream.writeCharacters(thread->name);
+			_OutputStream.writeCharacters("\" (J9VMThread:");
+			_OutputStream.writePointer(thread->vmThread);
+			_OutputStream.writeCharacters(")\n");
+
+			waitingThreadCount++;
+		}
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::indexSnapshotThreads() method implementation                               */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::indexSnapshotThreads(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	SnapshotThread** index = NULL;
+	UDATA count = 0;
+
+	if ((NULL != _Snapshot->threadIndex) || (0 == _Snapshot->threadCount)) {
+		return;
+	}
+
+	/* Without the index findSnapshotThread() falls back to searching the list */
+	index = (SnapshotThread**)j9mem_allocate_memory(_Snapshot->threadCount * sizeof(SnapshotThread*), OMRMEM_CATEGORY_VM);
+	if (NULL == index) {
+		return;
+	}
+
+	for (SnapshotThread* thread = _Snapshot->threads; NULL != thread; thread = thread->next) {
+		index[count++] = thread;
+	}
+	qsort(index, count, sizeof(SnapshotThread*), compareSnapshotThreads);
+
+	_Snapshot->threadIndex = index;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::compareSnapshotThreads() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+int
+JavaCoreDumpWriter::compareSnapshotThreads(const void* left, const void* right)
+{
+	UDATA leftThread = (UDATA)(*(SnapshotThread* const*)left)->vmThread;
+	UDATA rightThread = (UDATA)(*(SnapshotThread* const*)right)->vmThread;
+
+	if (leftThread < rightThread) {
+		return -1;
+	}
+	return (leftThread > rightThread) ? 1 : 0;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::findSnapshotThread() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+JavaCoreDumpWriter::SnapshotThread*
+JavaCoreDumpWriter::findSnapshotThread(J9VMThread* vmThread)
+{
+	if (NULL != _Snapshot->threadIndex) {
+		SnapshotThread key;
+		SnapshotThread* keyPointer = &key;
+
+		key.vmThread = vmThread;
+		SnapshotThread** found = (SnapshotThread**)bsearch(&keyPointer, _Snapshot->threadIndex, _Snapshot->threadCount, sizeof(SnapshotThread*), compareSnapshotThreads);
+
+		return (NULL != found) ? *found : NULL;
+	}
+
+	for (SnapshotThread* thread = _Snapshot->threads; NULL != thread; thread = thread->next) {
+		if (thread->vmThread == vmThread) {
+			return thread;
+		}
+	}
+
+	return NULL;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeSnapshotDeadLocks() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeSnapshotDeadLocks(void)
+{
+	PORT_ACCESS_FROM_JAVAVM(_VirtualMachine);
+
+	J9HashTable* deadlocks = hashTableNew (
+		OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 0,
+		sizeof(DeadLockGraphNode), 0, 0,
+		OMRMEM_CATEGORY_VM,
+		lockHashFunction,
+		lockHashEqualFunction,
+		NULL, NULL
+	);
+
+	/* If the memory can't be allocated, skip the section */
+	if (deadlocks == NULL) {
+		return;
+	}
+
+	indexSnapshotThreads();
+
+	/* Look for deadlock cycles as findThreadCycle() does, following the captured lock owners */
+	for (SnapshotThread* walkThread = _Snapshot->threads; NULL != walkThread; walkThread = walkThread->next) {
+		SnapshotThread* thread = walkThread;
+		DeadLockGraphNode  node;
+		DeadLockGraphNode* prev = &node;
+
+		while (NULL != thread) {
+			UDATA status = thread->vmState;
+			J9VMThread* owner = thread->lockOwner;
+
+			if ((owner == NULL) || (owner == thread->vmThread)) {
+				break;
+			} else if ((status == J9VMTHREAD_STATE_BLOCKED) || (status == J9VMTHREAD_STATE_WAITING) || (status == J9VMTHREAD_STATE_WAITING_TIMED)) {
+				node.lock = (J9ThreadAbstractMonitor*)thread->blockingMonitor;
+			} else if ((status == J9VMTHREAD_STATE_PARKED) || (status == J9VMTHREAD_STATE_PARKED_TIMED)) {
+				node.lock = NULL;
+			} else {
+				break;
+			}
+			node.lockObject = thread->lockObject.object;
+			node.cycle = 0;
+
+			/* Record current thread and update last node */
+			node.thread = thread->vmThread;
+			prev->next = (DeadLockGraphNode*)hashTableAdd(deadlocks, &node);
+			prev = prev->next;
+			if (NULL == prev) {
+				break;
+			}
+
+			/* Peek ahead to see if we're in a possible cycle */
+			node.thread = owner;
+			prev->next = (DeadLockGraphNode*)hashTableFind(deadlocks, &node);
+			if (NULL != prev->next) {
+				break;
+			}
+
+			/* Move round graph */
+			thread = findSnapshotThread(owner);
+		}
+	}
+
+	J9HashTableState hashState;
+	UDATA cycle = 0;
+
+	DeadLockGraphNode* node = (DeadLockGraphNode*)hashTableStartDo(deadlocks, &hashState);
+	while (node != NULL) {
+
+		cycle++;
+
+		while (node) {
+			if (node->cycle > 0) {
+
+				/* Found a deadlock! */
+				if (node->cycle == cycle) {
+					/* Output a header for each deadlock */
+					_OutputStream.writeCharacters(
+						"NULL           \n"
+						"1LKDEADLOCK    Deadlock detected !!!\n"
+						"NULL           ---------------------\n"
+						"NULL           \n"
+					);
+
+					DeadLockGraphNode *head = node;
+					int count = 0;
+
+					do {
+						/* Loop round complete cycle */
+						writeSnapshotDeadLockNode(findSnapshotThread(node->thread), ++count);
+						node = node->next;
+					} while (node != head);
+
+					_OutputStream.writeCharacters("2LKDEADLOCKTHR  Thread \"");
+					_OutputStream.writeCharacters(findSnapshotThread(node->thread)->name);
+					_OutputStream.writeCharacters("\" (");
+					_OutputStream.writePointer(node->thread);
+					_OutputStream.writeCharacters(")\n");
+				}
+
+				/* Skip already visited nodes */
+				break;
+
+			} else {
+				node->cycle = cycle;
+			}
+			node = node->next;
+		}
+
+		node = (DeadLockGraphNode*)hashTableNextDo(&hashState);
+	}
+
+	hashTableFree(deadlocks);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeSnapshotDeadLockNode() method implementation                          */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeSnapshotDeadLockNode(SnapshotThread* thread, int count)
+{
+	/* Only captured threads are added to the graph */
+	UDATA status = thread->vmState;
+	omrthread_monitor_t lock = NULL;
+
+	if ((status == J9VMTHREAD_STATE_BLOCKED) || (status == J9VMTHREAD_STATE_WAITING) || (status == J9VMTHREAD_STATE_WAITING_TIMED)) {
+		lock = thread->blockingMonitor;
+	}
+
+	_OutputStream.writeCharacters("2LKDEADLOCKTHR  Thread \"");
+	_OutputStream.writeCharacters(thread->name);
+	_OutputStream.writeCharacters("\" (");
+	_OutputStream.writePointer(thread->vmThread);
+	_OutputStream.writeCharacters(")\n");
+
+	if (count == 1) {
+		_OutputStream.writeCharacters("3LKDEADLOCKWTR    is waiting for:\n");
+	} else {
+		_OutputStream.writeCharacters("3LKDEADLOCKWTR    which is waiting for:\n");
+	}
+
+	if ((lock != NULL) && thread->blockingMonitorIsObject) {
+		// Java monitor object
+		_OutputStream.writeCharacters("4LKDEADLOCKMON      ");
+		writeMonitor(lock);
+		_OutputStream.writeCharacters("\n");
+		if (NULL != thread->lockObject.object) {
+			_OutputStream.writeCharacters("4LKDEADLOCKOBJ      ");
+			writeObject(thread->lockObject.object, thread->lockObject.romClass);
+			_OutputStream.writeCharacters("\n");
+		}
+	} else if (lock != NULL) {
+		// System monitor
+		_OutputStream.writeCharacters("4LKDEADLOCKREG      ");
+		writeSystemMonitor(lock, thread->blockingMonitorName);
+		_OutputStream.writeCharacters("\n");
+	} else if (thread->lockObject.object != NULL) {
+		// j.u.c lock
+		_OutputStream.writeCharacters("4LKDEADLOCKOBJ      ");
+		writeObject(thread->lockObject.object, thread->lockObject.romClass);
+		_OutputStream.writeCharacters("\n");
+	}
+
+	_OutputStream.writeCharacters("3LKDEADLOCKOWN    which is owned by:\n");
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::captureThreadSnapshot() method implementation                              */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::captureThreadSnapshot(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	J9VMThread* vmThread = _Context->onThread;
+	J9VMThread* currentThread = NULL;
+	bool currentThreadCaptured = false;
+	bool restartedWalk = false;
+	UDATA count = 0;
+
+	_ThreadsWalkStarted = true;
+
+	_Snapshot->liveThreads = _VirtualMachine->totalThreadCount;
+	_Snapshot->daemonThreads = _VirtualMachine->daemonThreadCount;
+	_Snapshot->exclusiveRequests = _VirtualMachine->exclusiveVMAccessRequestCount;
+	_Snapshot->inspectionHalts = _VirtualMachine->inspectionHaltCount;
+
+	if ((vmThread && vmThread->gpInfo) || (_Context->eventFlags & syncEventsMask)) {
+		currentThread = vmThread;
+	}
+
+	/* The same walk as writeThreadsJavaOnly(), a restart drops the threads captured so far */
+	J9VMThread* walkThread = J9_LINKED_LIST_START_DO(_VirtualMachine->mainThread);
+	while ((walkThread != NULL) && (count < _AllocatedVMThreadCount) && !_Snapshot->outOfMemory) {
+		captureThread(walkThread, walkThread == currentThread);
+		if (walkThread == currentThread) {
+			currentThreadCaptured = true;
+		}
+		count += 1;
+
+		walkThread = J9_LINKED_LIST_NEXT_DO(_VirtualMachine->mainThread, walkThread);
+		if (walkThread != NULL && walkThread->publicFlags == J9_PUBLIC_FLAGS_HALT_THREAD_INSPECTION) {
+			/* restart the walk */
+			if (!restartedWalk) {
+				walkThread = J9_LINKED_LIST_START_DO(_VirtualMachine->mainThread);
+				_Snapshot->threads = NULL;
+				_Snapshot->threadTail = &_Snapshot->threads;
+				_Snapshot->threadCount = 0;
+				currentThreadCaptured = false;
+				count = 0;
+				restartedWalk = true;
+			} else {
+				_Snapshot->threadWalkAborted = true;
+				break;
+			}
+		}
+	}
+
+	/* The current thread is always reported, even when the walk stopped before reaching it */
+	if ((NULL != currentThread) && !currentThreadCaptured) {
+		captureThread(currentThread, true);
+	}
+
+	/* The frames have been copied into the snapshot */
+	if (NULL != _Snapshot->frameScratch) {
+		j9mem_free_memory(_Snapshot->frameScratch);
+		_Snapshot->frameScratch = NULL;
+		_Snapshot->frameScratchSize = 0;
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::captureThread() method implementation                                      */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::captureThread(J9VMThread* vmThread, bool isCurrent)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	j9object_t lockObject = NULL;
+	J9VMThread *lockOwner = NULL;
+	omrthread_monitor_t monitor = NULL;
+	void *args[] = {vmThread, &lockObject, &monitor, &lockOwner, NULL};
+	UDATA stateClean = 0;
+	UDATA stateFault = stateClean;
+	UDATA sink = 0;
+	struct walkClosure closure;
+
+	SnapshotThread* thread = (SnapshotThread*)allocateSnapshotMemory(sizeof(SnapshotThread));
+	if (NULL == thread) {
+		return;
+	}
+
+	closure.jcw = this;
+	closure.state = thread;
+
+	thread->vmThread = vmThread;
+	thread->osThread = (J9AbstractThread*)vmThread->osThread;
+	thread->threadObject = vmThread->threadObject;
+	thread->isCurrent = isCurrent;
+	thread->name = captureThreadName(vmThread);
+	thread->publicFlags = vmThread->publicFlags;
+
+	/* Obtain java state through getVMThreadObjectState() for outputting to javacore */
+	if (J9PORT_SIG_EXCEPTION_OCCURRED == j9sig_protect(protectedGetVMThreadObjectState, args, handlerGetVMThreadObjectState, &stateFault, J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN, &stateClean)) {
+		thread->javaState = J9VMTHREAD_STATE_UNREADABLE;
+	} else {
+		thread->javaState = stateClean;
+	}
+
+	/* The raw state also gives the monitor the LOCKS section matches blocked and waiting threads against */
+	if (J9PORT_SIG_EXCEPTION_OCCURRED == j9sig_protect(protectedGetVMThreadRawState, args, handlerGetVMThreadRawState, &stateFault, J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN, &stateClean)) {
+		thread->vmState = J9VMTHREAD_STATE_UNREADABLE;
+	} else {
+		thread->vmState = stateClean;
+		thread->blockingMonitor = monitor;
+	}
+
+	if (NULL != thread->blockingMonitor) {
+		J9ThreadAbstractMonitor* lock = (J9ThreadAbstractMonitor*)thread->blockingMonitor;
+
+		thread->blockingMonitorIsObject = ((lock->flags & J9THREAD_MONITOR_OBJECT) == J9THREAD_MONITOR_OBJECT);
+		if (!thread->blockingMonitorIsObject) {
+			thread->blockingMonitorName = copySnapshotString(omrthread_monitor_get_name(thread->blockingMonitor));
+		}
+	}
+	if (NULL != lockObject) {
+		thread->lockObject.object = lockObject;
+		thread->lockObject.romClass = getObjectROMClass(lockObject);
+	}
+	thread->lockOwner = lockOwner;
+
+	if (vmThread->threadObject) {
+		thread->javaPriority = _VirtualMachine->internalVMFunctions->getJavaThreadPriority(_VirtualMachine, vmThread);
+
+		thread->javaLangThreadFailed = (J9PORT_SIG_EXCEPTION_OCCURRED == j9sig_protect(protectedCaptureJavaLangThreadInfo,
+				&closure, handlerCaptureSnapshot, this,
+				J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN,
+				&sink));
+	}
+
+	if (thread->osThread) {
+		omrthread_t osThread = (omrthread_t)thread->osThread;
+
+		thread->nativeThreadID = thread->osThread->tid;
+		thread->nativePriority = thread->osThread->priority;
+		thread->hasStackRange = (omrthread_get_stack_range(osThread, &thread->stackStart, &thread->stackEnd) == J9THREAD_SUCCESS);
+		thread->cpuTime = omrthread_get_cpu_time(osThread);
+		thread->userTime = omrthread_get_user_time(osThread);
+		thread->category = omrthread_get_category(osThread);
+	}
+
+	/* sig_protect as we have to access the heap and monitors */
+	thread->blockersFailed = (J9PORT_SIG_EXCEPTION_OCCURRED == j9sig_protect(protectedCaptureThreadBlockers,
+			&closure, handlerCaptureSnapshot, this,
+			J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN,
+			&sink));
+
+	if (vmThread->threadObject) {
+		J9StackWalkState stackWalkState;
+		struct walkClosure stackClosure;
+		struct walkClosure monitorClosure;
+		J9ObjectMonitorInfo monitorInfos[_MaximumMonitorInfosPerThread];
+		IDATA monitorCount = 0;
+		void *monitorArgs[] = {vmThread, monitorInfos, &monitorCount};
+
+		thread->bytesAllocated = _VirtualMachine->memoryManagerFunctions->j9gc_get_bytes_allocated_by_thread(vmThread);
+
+		monitorClosure.jcw = this;
+		monitorClosure.state = monitorArgs;
+
+		memset(&monitorInfos, 0, _MaximumMonitorInfosPerThread*sizeof(J9ObjectMonitorInfo));
+
+		if (J9PORT_SIG_EXCEPTION_OCCURRED == j9sig_protect(protectedGetOwnedObjectMonitors, &monitorClosure, handlerCaptureSnapshot, this, J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN, &sink)) {
+			thread->enteredLocksFailed = true;
+			monitorCount = 0;
+		}
+
+		if (0 < monitorCount) {
+			thread->enteredLocks = (SnapshotEnteredLock*)allocateSnapshotMemory(monitorCount * sizeof(SnapshotEnteredLock));
+			if (NULL != thread->enteredLocks) {
+				for (IDATA i = 0; i < monitorCount; i++) {
+					thread->enteredLocks[i].object.object = monitorInfos[i].object;
+					thread->enteredLocks[i].object.romClass = getObjectROMClass(monitorInfos[i].object);
+					thread->enteredLocks[i].count = monitorInfos[i].count;
+					thread->enteredLocks[i].depth = (UDATA)monitorInfos[i].depth;
+				}
+				thread->enteredLockCount = monitorCount;
+			}
+		}
+
+		stackWalkState.walkThread = vmThread;
+
+		stackWalkState.flags =
+			J9_STACKWALK_ITERATE_FRAMES |
+			J9_STACKWALK_INCLUDE_NATIVES |
+			J9_STACKWALK_VISIBLE_ONLY |
+			J9_STACKWALK_RECORD_BYTECODE_PC_OFFSET;
+
+		stackWalkState.skipCount = 0;
+		stackWalkState.userData1 = (void*)this;
+		stackWalkState.userData2 = thread;
+		stackWalkState.frameWalkFunction = captureFrameCallBack;
+		stackWalkState.errorMode = J9_STACKWALK_ERROR_MODE_IGNORE;
+
+		stackClosure.jcw = this;
+		stackClosure.state = &stackWalkState;
+
+		/* Frames are gathered in the scratch buffer and copied once the thread's depth is known */
+		_Snapshot->frameScratchCount = 0;
+		thread->stackWalkFailed = (J9PORT_SIG_EXCEPTION_OCCURRED == j9sig_protect(protectedWalkJavaStack, &stackClosure, handlerCaptureSnapshot, this, J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN, &sink));
+
+		if (!thread->stackWalkFailed && (0 == _Snapshot->frameScratchCount)) {
+			/* No stack frames => look for exception */
+			j9object_t* throwable = NULL;
+
+			/* Have we stashed an uncaught exception? */
+			if (vmThread == _Context->onThread && _Context->eventData) {
+				throwable = (j9object_t*)_Context->eventData->exceptionRef;
+			}
+
+			/* Otherwise default to current exception slot */
+			if (throwable == NULL) {
+				throwable = &(vmThread->currentException);
+			}
+
+			if (throwable && *throwable) {
+				void *parameters[] = {vmThread, throwable};
+
+				stackClosure.state = parameters;
+				thread->framesFromThrowable = true;
+				thread->stackWalkFailed = (J9PORT_SIG_EXCEPTION_OCCURRED == j9sig_protect(protectedCaptureStackTrace,
+						&stackClosure, handlerCaptureSnapshot, this,
+						J9PORT_SIG_FLAG_SIGALLSYNC|J9PORT_SIG_FLAG_MAY_RETURN, &sink));
+			}
+		}
+
+		if (0 < _Snapshot->frameScratchCount) {
+			thread->frames = (SnapshotFrame*)allocateSnapshotMemory(_Snapshot->frameScratchCount * sizeof(SnapshotFrame));
+			if (NULL != thread->frames) {
+				memcpy(thread->frames, _Snapshot->frameScratch, _Snapshot->frameScratchCount * sizeof(SnapshotFrame));
+				thread->frameCount = _Snapshot->frameScratchCount;
+			}
+		}
+	}
+
+	/* Only completely captured threads are reported */
+	*_Snapshot->threadTail = thread;
+	_Snapshot->threadTail = &thread->next;
+	_Snapshot->threadCount += 1;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::captureJavaLangThreadInfo() method implementation                          */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::captureJavaLangThreadInfo(SnapshotThread* thread)
+{
+	J9VMThread* vmThread = thread->vmThread;
+
+	thread->javaLangThreadID = J9VMJAVALANGTHREAD_TID(vmThread, vmThread->threadObject);
+	thread->isDaemon = J9VMJAVALANGTHREAD_ISDAEMON(vmThread, vmThread->threadObject) ? true : false;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::captureThreadBlockers() method implementation                              */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::captureThreadBlockers(SnapshotThread* thread)
+{
+	J9VMThread* vmThread = thread->vmThread;
+	j9object_t lockObject = thread->lockObject.object;
+	UDATA vmstate = thread->vmState;
+
+	/* Only the states writeThreadBlockers() reports need the owner details */
+	if ((vmstate != J9VMTHREAD_STATE_BLOCKED)
+		&& (vmstate != J9VMTHREAD_STATE_WAITING) && (vmstate != J9VMTHREAD_STATE_WAITING_TIMED)
+		&& (vmstate != J9VMTHREAD_STATE_PARKED) && (vmstate != J9VMTHREAD_STATE_PARKED_TIMED)
+	) {
+		return;
+	}
+
+	if (NULL != thread->lockOwner) {
+		thread->lockOwnerName = captureThreadName(thread->lockOwner);
+		thread->lockOwnerThreadObject = thread->lockOwner->threadObject;
+	} else if (((vmstate == J9VMTHREAD_STATE_PARKED) || (vmstate == J9VMTHREAD_STATE_PARKED_TIMED)) && (NULL != lockObject)) {
+		J9Class *aosClazz = J9VMJAVAUTILCONCURRENTLOCKSABSTRACTOWNABLESYNCHRONIZER_OR_NULL(vmThread->javaVM);
+		/* skip this step if aosClazz doesn't exist */
+		if (aosClazz) {
+			J9Class *clazz = J9OBJECT_CLAZZ(vmThread, lockObject);
+			/* PR 80305 : Do not write back to the castClassCache as this code may be running while the GC is unloading the class */
+			if (instanceOfOrCheckCastNoCacheUpdate(clazz, aosClazz)) {
+				j9object_t lockOwnerObject = J9VMJAVAUTILCONCURRENTLOCKSABSTRACTOWNABLESYNCHRONIZER_EXCLUSIVEOWNERTHREAD(vmThread, lockObject);
+
+				if (NULL != lockOwnerObject) {
+					// The owning thread has terminated, the name is only available from the java/lang/Thread object.
+					j9object_t nameObject = J9VMJAVALANGTHREAD_NAME(vmThread, lockOwnerObject);
+					char *threadName = getVMThreadNameFromString(vmThread, nameObject);
+
+					thread->lockOwnerObject = lockOwnerObject;
+					if (threadName != NULL) {
+						// Port access so we can free threadName.
+						PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
+						thread->lockOwnerObjectName = copySnapshotString(threadName);
+						j9mem_free_memory(threadName);
+					}
+				}
+			}
+		}
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::captureFrame() method implementation                                       */
+/*                                                                                                */
+/**************************************************************************************************/
+UDATA
+JavaCoreDumpWriter::captureFrame(J9StackWalkState* state)
+{
+	SnapshotThread* thread = (SnapshotThread*)state->userData2;
+	SnapshotFrame frame;
+
+	if (_Snapshot->frameScratchCount >= _MaximumJavaStackDepth) {
+		thread->framesTruncated = true;
+		return J9_STACKWALK_STOP_ITERATING;
+	}
+
+	memset(&frame, 0, sizeof(SnapshotFrame));
+	frame.method = state->method;
+	frame.bytecodePCOffset = state->bytecodePCOffset;
+	frame.framesWalked = state->framesWalked;
+
+#ifdef J9VM_INTERP_NATIVE_SUPPORT
+	J9JITConfig*         jitConfig = _VirtualMachine->jitConfig;
+	J9JITExceptionTable* metaData  = state->jitInfo;
+
+	if ((NULL != frame.method) && jitConfig && metaData) {
+		if (jitConfig->jitGetInlinerMapFromPC(_VirtualMachine, metaData, (UDATA)state->pc)) {
+			frame.compiled = true;
+		}
+	}
+#endif
+
+	if (!addSnapshotFrame(&frame) || (NULL == frame.method)) {
+		return J9_STACKWALK_STOP_ITERATING;
+	}
+
+	return J9_STACKWALK_KEEP_ITERATING;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::captureExceptionFrame() method implementation                              */
+/*                                                                                                */
+/**************************************************************************************************/
+UDATA
+JavaCoreDumpWriter::captureExceptionFrame(J9ROMClass* romClass, J9ROMMethod* romMethod, J9UTF8* sourceFile, UDATA lineNumber)
+{
+	SnapshotFrame frame;
+
+	memset(&frame, 0, sizeof(SnapshotFrame));
+	frame.romClass = romClass;
+	frame.romMethod = romMethod;
+	frame.sourceFile = sourceFile;
+	frame.lineNumber = lineNumber;
+
+	return addSnapshotFrame(&frame) ? TRUE : FALSE;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::addSnapshotFrame() method implementation                                   */
+/*                                                                                                */
+/**************************************************************************************************/
+bool
+JavaCoreDumpWriter::addSnapshotFrame(SnapshotFrame* frame)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (_Snapshot->frameScratchCount == _Snapshot->frameScratchSize) {
+		UDATA size = (0 == _Snapshot->frameScratchSize) ? 64 : (_Snapshot->frameScratchSize * 2);
+		SnapshotFrame* frames = (SnapshotFrame*)j9mem_reallocate_memory(_Snapshot->frameScratch, size * sizeof(SnapshotFrame), OMRMEM_CATEGORY_VM);
+
+		if (NULL == frames) {
+			_Snapshot->outOfMemory = true;
+			return false;
+		}
+		_Snapshot->frameScratch = frames;
+		_Snapshot->frameScratchSize = size;
+	}
+
+	_Snapshot->frameScratch[_Snapshot->frameScratchCount++] = *frame;
+	return true;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeSnapshotThreadSection() method implementation                         */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeSnapshotThreadSection(void)
+{
+	SnapshotThread* thread = NULL;
+	bool firstThread = true;
+
+	/* Write the section header */
+	_OutputStream.writeCharacters(
+		"0SECTION       THREADS subcomponent dump routine\n"
+		"NULL           =================================\n"
+	);
+
+	writeThreadPoolInfo(_Snapshot->liveThreads, _Snapshot->daemonThreads, _Snapshot->exclusiveRequests, _Snapshot->inspectionHalts);
+
+	/** Write the current thread out (if appropriate) **/
+	for (thread = _Snapshot->threads; NULL != thread; thread = thread->next) {
+		if (thread->isCurrent) {
+			_OutputStream.writeCharacters(
+				"NULL            \n"
+				"1XMCURTHDINFO  Current thread\n"
+			);
+			writeSnapshotThread(thread);
+			break;
+		}
+	}
+
+	for (thread = _Snapshot->threads; NULL != thread; thread = thread->next) {
+		/* If we have a current thread it will already have been written. */
+		if (!thread->isCurrent) {
+			if (firstThread) {
+				_OutputStream.writeCharacters(
+					"NULL           \n"
+					"1XMTHDINFO     Thread Details\n"
+					"NULL           \n"
+				);
+				firstThread = false;
+			}
+			writeSnapshotThread(thread);
+		}
+	}
+
+	if (_Snapshot->threadsFailed || _Snapshot->outOfMemory) {
+		_OutputStream.writeCharacters(
+			"NULL\n"
+			"1INTERNAL     Unable to walk threads. Some or all threads may have been omitted.\n"
+		);
+	}
+
+	_OutputStream.writeCharacters("NULL           ------------------------------------------------------------------------\n");
+
+	writeThreadSectionTrailer();
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeSnapshotThread() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeSnapshotThread(SnapshotThread* thread)
+{
+	/* Write the first thread descriptor word */
+	_OutputStream.writeCharacters("3XMTHREADINFO      \"");
+	_OutputStream.writeCharacters(thread->name);
+	_OutputStream.writeCharacters("\" J9VMThread:");
+	_OutputStream.writePointer(thread->vmThread);
+	_OutputStream.writeCharacters(", omrthread_t:");
+	_OutputStream.writePointer(thread->osThread);
+	_OutputStream.writeCharacters(", java/lang/Thread:");
+	_OutputStream.writePointer(thread->threadObject);
+
+	/* Replace vmstate with java state in the "3XMTHREADINFO" entry */
+	_OutputStream.writeCharacters(", state:");
+	writeThreadState(thread->javaState);
+
+	_OutputStream.writeCharacters(", prio=");
+	_OutputStream.writeInteger(thread->javaPriority, "%zu");
+
+	_OutputStream.writeCharacters("\n");
+
+	if (thread->threadObject) {
+		if (thread->javaLangThreadFailed) {
+			_OutputStream.writeCharacters("1INTERNAL                    Unable to obtain java/lang/Thread information\n");
+		} else {
+			writeJavaLangThreadInfo(thread->javaLangThreadID, thread->isDaemon);
+		}
+	}
+
+	/* Write the second thread descriptor word */
+	_OutputStream.writeCharacters("3XMTHREADINFO1            (native thread ID:");
+	if (NULL == thread->osThread) {
+		_OutputStream.writeInteger(0);
+	} else if (thread->nativeThreadID) {
+		_OutputStream.writeInteger(thread->nativeThreadID);
+	} else {
+		_OutputStream.writePointer(((U_8*)thread->osThread) + sizeof(J9AbstractThread));
+	}
+
+	_OutputStream.writeCharacters(", native priority:");
+	_OutputStream.writeInteger(thread->nativePriority);
+	_OutputStream.writeCharacters(", native policy:UNKNOWN");
+
+	/* Add vmstate and publicFlags to the end of the "3XMTHREADINFO1" entry */
+	_OutputStream.writeCharacters(", vmstate:");
+	writeThreadState(thread->vmState);
+
+	_OutputStream.writeCharacters(", vm thread flags:");
+	_OutputStream.writeInteger(thread->publicFlags, "0x%08x");
+	_OutputStream.writeCharacters(")\n");
+
+	if (thread->hasStackRange) {
+		void *stackStart = thread->stackStart;
+		void *stackEnd = thread->stackEnd;
+
+		_OutputStream.writeCharacters("3XMTHREADINFO2            (native stack address range");
+		_OutputStream.writeCharacters(" from:");
+		_OutputStream.writePointer(stackStart);
+		_OutputStream.writeCharacters(", to:");
+		_OutputStream.writePointer(stackEnd);
+		_OutputStream.writeCharacters(", size:");
+		_OutputStream.writeInteger(stackEnd>stackStart?
+				(UDATA)stackEnd-(UDATA)stackStart:(UDATA)stackStart-(UDATA)stackEnd);
+		_OutputStream.writeCharacters(")\n");
+	}
+
+	if (thread->osThread) {
+		writeThreadCPUUsage(thread->cpuTime, thread->userTime, thread->category);
+	}
+
+	writeSnapshotThreadBlockers(thread);
+
+	if (thread->threadObject) {
+		_OutputStream.writeCharacters("3XMHEAPALLOC             Heap bytes allocated since last GC cycle=");
+		_OutputStream.writeInteger(thread->bytesAllocated, "%zu");
+		_OutputStream.writeCharacters(" (");
+		_OutputStream.writeInteger(thread->bytesAllocated);
+		_OutputStream.writeCharacters(")\n");
+	}
+
+	/* Write the java stack */
+	writeSnapshotJavaStack(thread);
+
+	/* Native stacks are only collected from the paused threads (request=preempt) */
+#if defined(J9ZOS390) || defined(J9ZTPF)
+	_OutputStream.writeCharacters("3XMTHREADINFO3           No native callstack available on this platform\n");
+#else /* defined(J9ZOS390) || defined(J9ZTPF) */
+	_OutputStream.writeCharacters("3XMTHREADINFO3           No native callstack available for this thread\n");
+#endif /* defined(J9ZOS390) || defined(J9ZTPF) */
+	_OutputStream.writeCharacters("NULL\n");
+
+	_OutputStream.writeCharacters("NULL\n");
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeSnapshotThreadBlockers() method implementation                        */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeSnapshotThreadBlockers(SnapshotThread* thread)
+{
+	UDATA vmstate = thread->vmState;
+	j9object_t lockObject = thread->lockObject.object;
+
+	if (thread->blockersFailed) {
+		_OutputStream.writeCharacters("1INTERNAL                    Unable to obtain blocking thread information\n");
+		return;
+	}
+
+	if (vmstate == J9VMTHREAD_STATE_BLOCKED) {
+		if (lockObject != NULL) {
+			_OutputStream.writeCharacters("3XMTHREADBLOCK     Blocked on: " );
+		} else {
+			return; // Probably a system monitor, nothing interesting to write.
+		}
+	} else if ((vmstate == J9VMTHREAD_STATE_WAITING) || (vmstate == J9VMTHREAD_STATE_WAITING_TIMED)) {
+		if (lockObject != NULL) {
+			_OutputStream.writeCharacters("3XMTHREADBLOCK     Waiting on: " );
+		} else {
+			return; // Probably a system monitor, nothing interesting to write.
+		}
+	} else if ((vmstate == J9VMTHREAD_STATE_PARKED) || (vmstate == J9VMTHREAD_STATE_PARKED_TIMED)) {
+		_OutputStream.writeCharacters("3XMTHREADBLOCK     Parked on: " );
+	} else {
+		// If not blocked, waiting or parked, don't write anything out.
+		return;
+	}
+
+	if (lockObject) {
+		writeObject(lockObject, thread->lockObject.romClass);
+	} else {
+		_OutputStream.writeCharacters("<unknown>");
+	}
+	_OutputStream.writeCharacters(" Owned by: ");
+	if (thread->lockOwner != NULL) {
+		_OutputStream.writeCharacters("\"");
+		_OutputStream.writeCharacters(thread->lockOwnerName);
+		_OutputStream.writeCharacters("\" (J9VMThread:");
+		_OutputStream.writePointer(thread->lockOwner);
+		_OutputStream.writeCharacters(", java/lang/Thread:");
+		_OutputStream.writePointer(thread->lockOwnerThreadObject);
+		_OutputStream.writeCharacters(")");
+	} else if (thread->lockOwnerObject != NULL) {
+		if (thread->lockOwnerObjectName != NULL) {
+			_OutputStream.writeCharacters("\"");
+			_OutputStream.writeCharacters(thread->lockOwnerObjectName);
+			_OutputStream.writeCharacters("\"");
+		} else {
+			_OutputStream.writeCharacters("<unknown>");
+		}
+		_OutputStream.writeCharacters(" (J9VMThread:");
+		_OutputStream.writeCharacters("<null>");
+		_OutputStream.writeCharacters(", java/lang/Thread:");
+		_OutputStream.writePointer(thread->lockOwnerObject);
+		_OutputStream.writeCharacters(")");
+	} else {
+		if ((vmstate == J9VMTHREAD_STATE_PARKED) || (vmstate == J9VMTHREAD_STATE_PARKED_TIMED)) {
+			// No owning thread recorded.
+			_OutputStream.writeCharacters("<unknown>");
+		} else {
+			// Should only occur for WAITING threads.
+			_OutputStream.writeCharacters("<unowned>");
+		}
+	}
+	_OutputStream.writeCharacters("\n");
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeSnapshotJavaStack() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeSnapshotJavaStack(SnapshotThread* thread)
+{
+	if (NULL == thread->threadObject) {
+		_OutputStream.writeCharacters("3XMTHREADINFO3           No Java callstack associated with this thread\n");
+		return;
+	}
+
+	if (thread->enteredLocksFailed) {
+		_OutputStream.writeCharacters("1INTERNAL                    Unable to obtain lock context information\n");
+	}
+
+	if (0 < thread->frameCount) {
+		_OutputStream.writeCharacters("3XMTHREADINFO3           Java callstack:\n");
+	}
+
+	if (thread->framesFromThrowable) {
+		/* Frames recovered from the pending exception are already resolved to a location */
+		J9StackWalkState state;
+
+		state.userData2 = NULL;
+		for (UDATA i = 0; i < thread->frameCount; i++) {
+			SnapshotFrame* frame = &thread->frames[i];
+			writeExceptionFrame(&state, frame->romClass, frame->romMethod, frame->sourceFile, frame->lineNumber);
+		}
+
+		if (thread->stackWalkFailed) {
+			_OutputStream.writeCharacters("1INTERNAL                    Unable to write in-flight data on call stack\n");
+		} else if (0 == thread->frameCount) {
+			_OutputStream.writeCharacters("3XMTHREADINFO3           No Java callstack associated with throwable\n");
+		}
+		return;
+	}
+
+	SnapshotEnteredLock* lock = thread->enteredLocks;
+	UDATA lockCount = thread->enteredLockCount;
+
+	for (UDATA i = 0; i < thread->frameCount; i++) {
+		SnapshotFrame* frame = &thread->frames[i];
+
+		if (NULL == frame->method) {
+			_OutputStream.writeCharacters("4XESTACKTRACE                at (Missing Method)\n");
+			break;
+		}
+
+		if (writeFrameLocation(frame->method, frame->bytecodePCOffset, frame->compiled)) {
+			/* Use a while loop as there may be more than one lock taken in a stack frame. */
+			while ((0 < lockCount) && (lock->depth == frame->framesWalked)) {
+				_OutputStream.writeCharacters("5XESTACKTRACE                   (entered lock: ");
+				writeObject(lock->object.object, lock->object.romClass);
+				_OutputStream.writeCharacters(", entry count: ");
+				_OutputStream.writeInteger(lock->count, "%zu");
+				_OutputStream.writeCharacters(")\n");
+				lock++;
+				lockCount--;
+			}
+		}
+	}
+
+	if (thread->framesTruncated) {
+		_OutputStream.writeCharacters("4XESTACKERR                  Java callstack truncated at ");
+		_OutputStream.writeInteger(_MaximumJavaStackDepth, "%zu");
+		_OutputStream.writeCharacters(" methods\n");
+	}
+
+	if (thread->stackWalkFailed) {
+		_OutputStream.writeCharacters("1INTERNAL                    Unable to walk in-flight data on call stack\n");
+	} else if (0 == thread->frameCount) {
+		_OutputStream.writeCharacters("3XMTHREADINFO3           No Java callstack associated with this thread\n");
+	}
+}
+
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeClassSection() method implementation                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeClassSection(void)
+{
+	/* Write the section and first sub-section header */
+	_OutputStream.writeCharacters(
+		"0SECTION       CLASSES subcomponent dump routine\n"
+		"NULL           =================================\n"
+		"1CLTEXTCLLOS   \tClassloader summaries\n"
+		"1CLTEXTCLLSS   \t\t12345678: 1=primordial,2=extension,3=shareable,4=middleware,5=system,6=trusted,7=application,8=delegating\n"
+	);
+
+	pool_do(_VirtualMachine->classLoaderBlocks,writeLoaderCallBack, this);
+
+	/* Write the sub-section header */
+	_OutputStream.writeCharacters(
+		"1CLTEXTCLLIB   \tClassLoader loaded libraries\n"
+	);
+
+	pool_do(_VirtualMachine->classLoaderBlocks, writeLibrariesCallBack, this);
+
+	/* Write the sub-section header */
+	_OutputStream.writeCharacters(
+		"1CLTEXTCLLOD   \tClassLoader loaded classes\n"
+	);
+
+	pool_do(_VirtualMachine->classLoaderBlocks, writeClassesCallBack, this);
+
+	/* Write the section trailer */
+	_OutputStream.writeCharacters(
+		"NULL           ------------------------------------------------------------------------\n"
+	);
+}
+
+/**
+ * JavaCoreDumpWriter::writeHookSection() method implementation
+ *
+ * 0SECTION       HOOK subcomponent dump routine
+ * NULL           ==============================
  * 1NOTE          This data is reset after writing each javacore file
  * NULL           ------------------------------------------------------------------------
  * 1HKINTERFACE   MM_OMRHookInterface
@@ -3266,11 +5162,52 @@ JavaCoreDumpWriter::writeSharedClassSection(void)
 			"NULL           ------------------------------------------------------------------------\n"
 		);
 	}
-}
-#endif
+}
+#endif
+
+
+
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeSectionTimings() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeSectionTimings(void)
+{
+	U_64 totalMicros = 0;
+
+	/* Write the section header */
+	_OutputStream.writeCharacters(
+		"0SECTION       DUMPTIME subcomponent dump routine\n"
+		"NULL           ==================================\n"
+		"1DTSECTIME     Section timings (microseconds)\n"
+	);
+
+	for (UDATA i = 0; i < _SectionCount; i++) {
+		_OutputStream.writeCharacters("2DTSECTIME     ");
+		_OutputStream.writeCharacters(_SectionTimes[i].name);
+		_OutputStream.writeInteger64(_SectionTimes[i].micros, " %llu\n");
+		totalMicros += _SectionTimes[i].micros;
+	}
 
+	_OutputStream.writeCharacters("1DTTOTALTIME   Total section time (microseconds): ");
+	_OutputStream.writeInteger64(totalMicros, "%llu");
+	_OutputStream.writeCharacters("\n");
 
+	if (_LowPause) {
+		_OutputStream.writeCharacters("1DTLOWPAUSE    Exclusive VM access released before the javacore file was written\n");
+		if (NULL != _Snapshot) {
+			_OutputStream.writeCharacters("2DTLOWPAUSE    Heap, LOCKS and THREADS state captured in the pause and formatted after release\n");
+		} else {
+			_OutputStream.writeCharacters("2DTLOWPAUSE    Snapshot unavailable, all sections formatted in the pause\n");
+		}
+	}
 
+	/* Write the section trailer */
+	_OutputStream.writeCharacters("NULL           ------------------------------------------------------------------------\n");
+}
 
 /**************************************************************************************************/
 /*                                                                                                */
@@ -4075,8 +6012,12 @@ JavaCoreDumpWriter::writeMonitor(J9ThreadMonitor* monitor)
 void
 JavaCoreDumpWriter::writeSystemMonitor(J9ThreadMonitor* monitor)
 {
-	const char* name = omrthread_monitor_get_name(monitor);
+	writeSystemMonitor(monitor, omrthread_monitor_get_name(monitor));
+}
 
+void
+JavaCoreDumpWriter::writeSystemMonitor(J9ThreadMonitor* monitor, const char* name)
+{
 	_OutputStream.writeCharacters((name ? name : "[system]"));
 	_OutputStream.writeCharacters(" lock (");
 	_OutputStream.writePointer(monitor);
@@ -4091,13 +6032,12 @@ JavaCoreDumpWriter::writeSystemMonitor(J9ThreadMonitor* monitor)
 void
 JavaCoreDumpWriter::writeObject(j9object_t obj)
 {
-	J9ROMClass* romClass;
-	if (J9VM_IS_INITIALIZED_HEAPCLASS_VM(_VirtualMachine, obj)) {
-		romClass = J9VM_J9CLASS_FROM_HEAPCLASS_VM(_VirtualMachine, obj)->romClass;
-	} else {
-		romClass = J9OBJECT_CLAZZ_VM(_VirtualMachine, obj)->romClass;
-	}
+	writeObject(obj, getObjectROMClass(obj));
+}
 
+void
+JavaCoreDumpWriter::writeObject(j9object_t obj, J9ROMClass* romClass)
+{
 	J9UTF8* className = J9ROMCLASS_CLASSNAME(romClass);
 
 	_OutputStream.writeCharacters(className);
@@ -4105,6 +6045,21 @@ JavaCoreDumpWriter::writeObject(j9object_t obj)
 	_OutputStream.writePointer(obj);
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::getObjectROMClass() method implementation                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+J9ROMClass*
+JavaCoreDumpWriter::getObjectROMClass(j9object_t obj)
+{
+	/* Class objects are reported as the class they represent */
+	if (J9VM_IS_INITIALIZED_HEAPCLASS_VM(_VirtualMachine, obj)) {
+		return J9VM_J9CLASS_FROM_HEAPCLASS_VM(_VirtualMachine, obj)->romClass;
+	}
+	return J9OBJECT_CLAZZ_VM(_VirtualMachine, obj)->romClass;
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* JavaCoreDumpWriter::writeThreadState() method implementation                                        */
@@ -4234,66 +6189,7 @@ JavaCoreDumpWriter::writeThread(J9VMThread* vmThread, J9PlatformThread *nativeTh
 				_OutputStream.writeCharacters(")\n");
 			}
 
-			I_64 cpuTime = omrthread_get_cpu_time((omrthread_t)osThread);
-			I_64 userTime = omrthread_get_user_time((omrthread_t)osThread);
-			if ((-1 != cpuTime) || (-1 != userTime)) {
-				_OutputStream.writeCharacters("3XMCPUTIME               CPU usage ");
-				if (-1 != cpuTime) {
-					writeThreadTime("total", cpuTime);
-					if (-1 != userTime) {
-						_OutputStream.writeCharacters(", ");
-					}
-				}
-				if (-1 != userTime) {
-					writeThreadTime("user", userTime);
-				}
-				if ((-1 != cpuTime) && (-1 != userTime)) {
-					I_64 systemTime = cpuTime - userTime;
-					_OutputStream.writeCharacters(", ");
-					writeThreadTime("system", systemTime);
-				}
-
-				/* Write the category of the thread */
-				_OutputStream.writeCharacters(", current category=");
-
-				UDATA category = omrthread_get_category((omrthread_t)osThread);
-				switch (category) {
-				case J9THREAD_CATEGORY_RESOURCE_MONITOR_THREAD:
-					_OutputStream.writeCharacters("\"Resource-Monitor\"");
-					break;
-				case J9THREAD_CATEGORY_SYSTEM_THREAD:
-					_OutputStream.writeCharacters("\"System-JVM\"");
-					break;
-				case J9THREAD_CATEGORY_SYSTEM_GC_THREAD:
-					_OutputStream.writeCharacters("\"GC\"");
-					break;
-				case J9THREAD_CATEGORY_SYSTEM_JIT_THREAD:
-					_OutputStream.writeCharacters("\"JIT\"");
-					break;
-				case J9THREAD_CATEGORY_APPLICATION_THREAD:
-					_OutputStream.writeCharacters("\"Application\"");
-					break;
-				case J9THREAD_USER_DEFINED_THREAD_CATEGORY_1:
-					_OutputStream.writeCharacters("\"Application-User1\"");
-					break;
-				case J9THREAD_USER_DEFINED_THREAD_CATEGORY_2:
-					_OutputStream.writeCharacters("\"Application-User2\"");
-					break;
-				case J9THREAD_USER_DEFINED_THREAD_CATEGORY_3:
-					_OutputStream.writeCharacters("\"Application-User3\"");
-					break;
-				case J9THREAD_USER_DEFINED_THREAD_CATEGORY_4:
-					_OutputStream.writeCharacters("\"Application-User4\"");
-					break;
-				case J9THREAD_USER_DEFINED_THREAD_CATEGORY_5:
-					_OutputStream.writeCharacters("\"Application-User5\"");
-					break;
-				default:
-					_OutputStream.writeCharacters("Unknown");
-					break;
-				}
-				_OutputStream.writeCharacters("\n");
-			}
+			writeThreadCPUUsage(omrthread_get_cpu_time((omrthread_t)osThread), omrthread_get_user_time((omrthread_t)osThread), omrthread_get_category((omrthread_t)osThread));
 		} else {
 			_OutputStream.writeCharacters("3XMTHREADINFO1            (native thread ID:");
 			_OutputStream.writeInteger(0);
@@ -4640,6 +6536,47 @@ JavaCoreDumpWriter::writeFrame(J9StackWalkState* state)
 		return J9_STACKWALK_STOP_ITERATING;
 	}
 
+	bool compiledMethod = false;
+
+#ifdef J9VM_INTERP_NATIVE_SUPPORT
+	J9JITConfig*         jitConfig = _VirtualMachine->jitConfig;
+	J9JITExceptionTable* metaData  = state->jitInfo;
+
+	if (jitConfig && metaData) {
+		if (jitConfig->jitGetInlinerMapFromPC(_VirtualMachine, metaData, (UDATA)state->pc)) {
+			compiledMethod = true;
+		}
+	}
+#endif
+
+	if (!writeFrameLocation(method, state->bytecodePCOffset, compiledMethod)) {
+		return J9_STACKWALK_KEEP_ITERATING;
+	}
+
+	/* Use a while loop as there may be more than one lock taken in a stack frame. */
+	while((*monitorCount) && ((UDATA)monitorInfo->depth == state->framesWalked)) {
+		_OutputStream.writeCharacters("5XESTACKTRACE                   (entered lock: ");
+		writeObject(monitorInfo->object);
+		_OutputStream.writeCharacters(", entry count: ");
+		_OutputStream.writeInteger(monitorInfo->count, "%zu");
+		_OutputStream.writeCharacters(")\n");
+		monitorInfo++;
+		/* Store the updated progress back in userData for the next callback */
+		state->userData3 = monitorInfo;
+		(*monitorCount)--;
+	}
+
+	return J9_STACKWALK_KEEP_ITERATING;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeFrameLocation() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+bool
+JavaCoreDumpWriter::writeFrameLocation(J9Method* method, UDATA offsetPC, bool compiledMethod)
+{
 	J9Class*     methodClass = J9_CLASS_FROM_METHOD(method);
 	J9UTF8*      className   = J9ROMCLASS_CLASSNAME(methodClass->romClass);
 	J9ROMMethod* romMethod   = J9_ROM_METHOD_FROM_RAM_METHOD(method);
@@ -4651,25 +6588,10 @@ JavaCoreDumpWriter::writeFrame(J9StackWalkState* state)
 	_OutputStream.writeCharacters(methodName);
 
 	if (romMethod->modifiers & J9AccNative) {
+		/* Native frames never report entered locks */
 		_OutputStream.writeCharacters("(Native Method)\n");
-		return J9_STACKWALK_KEEP_ITERATING;
-	}
-
-	UDATA offsetPC = state->bytecodePCOffset;
-	bool compiledMethod = false;
-
-#ifdef J9VM_INTERP_NATIVE_SUPPORT
-	J9JITConfig*         jitConfig = _VirtualMachine->jitConfig;
-	J9JITExceptionTable* metaData  = state->jitInfo;
-	void*                stackMap  = NULL;
-
-	if (jitConfig && metaData) {
-		stackMap = jitConfig->jitGetInlinerMapFromPC(_VirtualMachine, metaData, (UDATA)state->pc);
-		if (stackMap) {
-			compiledMethod = true;
-		}
+		return false;
 	}
-#endif
 
 #ifdef J9VM_OPT_DEBUG_INFO_SERVER
 	/* Write source file and line number info, if available and we can take locks. */
@@ -4691,21 +6613,7 @@ JavaCoreDumpWriter::writeFrame(J9StackWalkState* state)
 			}
 
 			_OutputStream.writeCharacters(")\n");
-
-			/* Use a while loop as there may be more than one lock taken in a stack frame. */
-			while((*monitorCount) && ((UDATA)monitorInfo->depth == state->framesWalked)) {
-				_OutputStream.writeCharacters("5XESTACKTRACE                   (entered lock: ");
-				writeObject(monitorInfo->object);
-				_OutputStream.writeCharacters(", entry count: ");
-				_OutputStream.writeInteger(monitorInfo->count, "%zu");
-				_OutputStream.writeCharacters(")\n");
-				monitorInfo++;
-				/* Store the updated progress back in userData for the next callback */
-				state->userData3 = monitorInfo;
-				(*monitorCount)--;
-			}
-
-			return J9_STACKWALK_KEEP_ITERATING;
+			return true;
 		}
 	}
 #endif
@@ -4720,21 +6628,7 @@ JavaCoreDumpWriter::writeFrame(J9StackWalkState* state)
 	}
 
 	_OutputStream.writeCharacters(")\n");
-
-	/* Use a while loop as there may be more than one lock taken in a stack frame. */
-	while((*monitorCount) && ((UDATA)monitorInfo->depth == state->framesWalked)) {
-		_OutputStream.writeCharacters("5XESTACKTRACE                   (entered lock: ");
-		writeObject(monitorInfo->object);
-		_OutputStream.writeCharacters(", entry count: ");
-		_OutputStream.writeInteger(monitorInfo->count, "%zu");
-		_OutputStream.writeCharacters(")\n");
-		monitorInfo++;
-		/* Store the updated progress back in userData for the next callback */
-		state->userData3 = monitorInfo;
-		(*monitorCount)--;
-	}
-
-	return J9_STACKWALK_KEEP_ITERATING;
+	return true;
 }
 
 /**************************************************************************************************/
@@ -4814,6 +6708,73 @@ JavaCoreDumpWriter::writeThreadTime(const char * timerName, I_64 nanoTime)
 	_OutputStream.writeCharacters(" secs");
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeThreadCPUUsage() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeThreadCPUUsage(I_64 cpuTime, I_64 userTime, UDATA category)
+{
+	if ((-1 != cpuTime) || (-1 != userTime)) {
+		_OutputStream.writeCharacters("3XMCPUTIME               CPU usage ");
+		if (-1 != cpuTime) {
+			writeThreadTime("total", cpuTime);
+			if (-1 != userTime) {
+				_OutputStream.writeCharacters(", ");
+			}
+		}
+		if (-1 != userTime) {
+			writeThreadTime("user", userTime);
+		}
+		if ((-1 != cpuTime) && (-1 != userTime)) {
+			I_64 systemTime = cpuTime - userTime;
+			_OutputStream.writeCharacters(", ");
+			writeThreadTime("system", systemTime);
+		}
+
+		/* Write the category of the thread */
+		_OutputStream.writeCharacters(", current category=");
+
+		switch (category) {
+		case J9THREAD_CATEGORY_RESOURCE_MONITOR_THREAD:
+			_OutputStream.writeCharacters("\"Resource-Monitor\"");
+			break;
+		case J9THREAD_CATEGORY_SYSTEM_THREAD:
+			_OutputStream.writeCharacters("\"System-JVM\"");
+			break;
+		case J9THREAD_CATEGORY_SYSTEM_GC_THREAD:
+			_OutputStream.writeCharacters("\"GC\"");
+			break;
+		case J9THREAD_CATEGORY_SYSTEM_JIT_THREAD:
+			_OutputStream.writeCharacters("\"JIT\"");
+			break;
+		case J9THREAD_CATEGORY_APPLICATION_THREAD:
+			_OutputStream.writeCharacters("\"Application\"");
+			break;
+		case J9THREAD_USER_DEFINED_THREAD_CATEGORY_1:
+			_OutputStream.writeCharacters("\"Application-User1\"");
+			break;
+		case J9THREAD_USER_DEFINED_THREAD_CATEGORY_2:
+			_OutputStream.writeCharacters("\"Application-User2\"");
+			break;
+		case J9THREAD_USER_DEFINED_THREAD_CATEGORY_3:
+			_OutputStream.writeCharacters("\"Application-User3\"");
+			break;
+		case J9THREAD_USER_DEFINED_THREAD_CATEGORY_4:
+			_OutputStream.writeCharacters("\"Application-User4\"");
+			break;
+		case J9THREAD_USER_DEFINED_THREAD_CATEGORY_5:
+			_OutputStream.writeCharacters("\"Application-User5\"");
+			break;
+		default:
+			_OutputStream.writeCharacters("Unknown");
+			break;
+		}
+		_OutputStream.writeCharacters("\n");
+	}
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* JavaCoreDumpWriter::writeLoader() method implementation                                        */
@@ -5200,12 +7161,16 @@ JavaCoreDumpWriter::getOwnedObjectMonitors(J9VMThread* vmThread, J9ObjectMonitor
 void
 JavaCoreDumpWriter::writeJavaLangThreadInfo (J9VMThread* vmThread)
 {
-	I_64 threadID = J9VMJAVALANGTHREAD_TID(vmThread, vmThread->threadObject);
+	writeJavaLangThreadInfo(J9VMJAVALANGTHREAD_TID(vmThread, vmThread->threadObject), J9VMJAVALANGTHREAD_ISDAEMON(vmThread, vmThread->threadObject) ? true : false);
+}
 
+void
+JavaCoreDumpWriter::writeJavaLangThreadInfo (I_64 threadID, bool isDaemon)
+{
 	_OutputStream.writeCharacters("3XMJAVALTHREAD            (java/lang/Thread getId:");
 	_OutputStream.writeInteger64(threadID);
 	_OutputStream.writeCharacters(", isDaemon:");
-	_OutputStream.writeCharacters(J9VMJAVALANGTHREAD_ISDAEMON(vmThread, vmThread->threadObject)?"true":"false");
+	_OutputStream.writeCharacters(isDaemon ? "true" : "false");
 	_OutputStream.writeCharacters(")\n");
 
 }
@@ -5340,6 +7305,18 @@ writeExceptionFrameCallBack(J9VMThread* vmThread, void* userData, J9ROMClass* ro
 	return jcdw->writeExceptionFrame(userData, romClass, romMethod, sourceFile, lineNumber);
 }
 
+UDATA
+captureFrameCallBack(J9VMThread* vmThread, J9StackWalkState* state)
+{
+	return ((JavaCoreDumpWriter*)(state->userData1))->captureFrame(state);
+}
+
+UDATA
+captureExceptionFrameCallBack(J9VMThread* vmThread, void* userData, J9ROMClass* romClass, J9ROMMethod* romMethod, J9UTF8* sourceFile, UDATA lineNumber, J9ClassLoader* classLoader)
+{
+	return ((JavaCoreDumpWriter*)userData)->captureExceptionFrame(romClass, romMethod, sourceFile, lineNumber);
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* GC iterator call back functions                                                                   */
@@ -5358,105 +7335,33 @@ heapIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateHeapDescriptor* heapD
 static jvmtiIterationControl
 spaceIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateSpaceDescriptor* spaceDescriptor, void* userData)
 {
-	UDATA sizeTotal = 0;
-	UDATA sizeTarget = 0;
-	UDATA allocTotal = 0;
-	UDATA freeTotal = 0;
 #if defined (J9VM_GC_VLHGC)
-	UDATA regionEnd;
 	regioniterationblock regionTotals;
 #endif /* J9VM_GC_VLHGC */
 	JavaCoreDumpWriter* jcw = (JavaCoreDumpWriter*)userData;
 
-
-	jcw->_OutputStream.writeCharacters("NULL           ");
-#if defined(J9VM_ENV_DATA64)
-	jcw->_OutputStream.writeCharacters(
-		"id                 start              end                size               space");
-#else
-	jcw->_OutputStream.writeCharacters(
-		"id         start      end        size       space");
-#endif
+	jcw->writeHeapSpaceColumns();
 
 	/* Balanced (VLHGC) has a lot more regions than the normal GC modes so we collapse down to spaces */
 	if (J9_GC_POLICY_BALANCED == ((OMR_VM *)virtualMachine->omrVM)->gcPolicy) {
-		jcw->_OutputStream.writeCharacters("\n");
 #if defined(J9VM_GC_VLHGC)
 		/* For VLH add up the total size of all the regions and print a summary. */
 		regionTotals._newIteration = true;
 		virtualMachine->memoryManagerFunctions->j9mm_iterate_regions(virtualMachine, virtualMachine->portLibrary, spaceDescriptor, j9mm_iterator_flag_regions_read_only, regionIteratorCallback, &regionTotals);
+		jcw->writeHeapSpace(spaceDescriptor->id, regionTotals._regionStart, regionTotals._regionSize, spaceDescriptor->name);
 #endif /* J9VM_GC_VLHGC */
 	} else {
 		/* For non-VLH print out each region individually on it's own line. */
-		jcw->_OutputStream.writeCharacters("/region\n");
 		jcw->_SpaceDescriptorName = spaceDescriptor->name;
 		/* Write out the details of the containing space first. */
-		jcw->_OutputStream.writeCharacters("1STHEAPSPACE   ");
-		jcw->_OutputStream.writePointer((void *)spaceDescriptor->id);
-		jcw->_OutputStream.writeCharacters(" ");
-		jcw->_OutputStream.writeVPrintf("%*c--%*c",  sizeof(void *), ' ',  sizeof(void *), ' ');
-		jcw->_OutputStream.writeCharacters(" ");
-		jcw->_OutputStream.writeVPrintf("%*c--%*c",  sizeof(void *), ' ',  sizeof(void *), ' ');
-		jcw->_OutputStream.writeCharacters(" ");
-		jcw->_OutputStream.writeVPrintf("%*c--%*c",  sizeof(void *), ' ',  sizeof(void *), ' ');
-		jcw->_OutputStream.writeCharacters(" ");
-		jcw->_OutputStream.writeCharacters(spaceDescriptor->name);
-		jcw->_OutputStream.writeCharacters(" \n");
+		jcw->writeHeapSpace(spaceDescriptor->id, spaceDescriptor->name);
 		virtualMachine->memoryManagerFunctions->j9mm_iterate_regions(virtualMachine, virtualMachine->portLibrary, spaceDescriptor, j9mm_iterator_flag_regions_read_only, regionIteratorCallback, jcw);
 	}
 
-	if (J9_GC_POLICY_BALANCED == ((OMR_VM *)virtualMachine->omrVM)->gcPolicy) {
-#if defined(J9VM_GC_VLHGC)
-		jcw->_OutputStream.writeCharacters("1STHEAPSPACE   ");
-		jcw->_OutputStream.writePointer((void *)spaceDescriptor->id);
-		jcw->_OutputStream.writeCharacters(" ");
-		jcw->_OutputStream.writePointer((void *)regionTotals._regionStart);
-		jcw->_OutputStream.writeCharacters(" ");
-		regionEnd = (UDATA)regionTotals._regionStart + (UDATA)regionTotals._regionSize;
-		jcw->_OutputStream.writePointer((const void*)regionEnd);
-		jcw->_OutputStream.writeCharacters(" ");
-		jcw->_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, regionTotals._regionSize);
-		jcw->_OutputStream.writeCharacters(" ");
-		jcw->_OutputStream.writeCharacters(spaceDescriptor->name);
-		jcw->_OutputStream.writeCharacters(" \n");
-#endif /* J9VM_GC_VLHGC */
-	}
-
-	sizeTotal = virtualMachine->memoryManagerFunctions->j9gc_heap_total_memory(virtualMachine);
-	sizeTarget = virtualMachine->memoryManagerFunctions->j9gc_get_softmx(virtualMachine);
-	freeTotal = virtualMachine->memoryManagerFunctions->j9gc_heap_free_memory(virtualMachine);
-	allocTotal = sizeTotal - freeTotal;
-
-	int decimalLength = sizeof(void*) == 4 ? 10 : 20;
-
-	jcw->_OutputStream.writeCharacters("NULL\n");
-	jcw->_OutputStream.writeCharacters("1STHEAPTOTAL   ");
-	jcw->_OutputStream.writeCharacters("Total memory:        ");
-	jcw->_OutputStream.writeVPrintf(FORMAT_SIZE_DECIMAL, decimalLength, sizeTotal);
-	jcw->_OutputStream.writeCharacters(" (");
-	jcw->_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, sizeTotal);
-	jcw->_OutputStream.writeCharacters(")\n");
-	if (sizeTarget != 0) {
-		jcw->_OutputStream.writeCharacters("1STHEAPTARGET  ");
-		jcw->_OutputStream.writeCharacters("Target memory:       ");
-		jcw->_OutputStream.writeVPrintf(FORMAT_SIZE_DECIMAL, decimalLength, sizeTarget);
-		jcw->_OutputStream.writeCharacters(" (");
-		jcw->_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, sizeTarget);
-		jcw->_OutputStream.writeCharacters(")\n");
-	}
-	jcw->_OutputStream.writeCharacters("1STHEAPINUSE   ");
-	jcw->_OutputStream.writeCharacters("Total memory in use: ");
-	jcw->_OutputStream.writeVPrintf(FORMAT_SIZE_DECIMAL, decimalLength, allocTotal);
-	jcw->_OutputStream.writeCharacters(" (");
-	jcw->_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, allocTotal);
-	jcw->_OutputStream.writeCharacters(")\n");
-	jcw->_OutputStream.writeCharacters("1STHEAPFREE    ");
-	jcw->_OutputStream.writeCharacters("Total memory free:   ");
-	jcw->_OutputStream.writeVPrintf(FORMAT_SIZE_DECIMAL, decimalLength, freeTotal);
-	jcw->_OutputStream.writeCharacters(" (");
-	jcw->_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, freeTotal);
-	jcw->_OutputStream.writeCharacters(")\n");
-	jcw->_OutputStream.writeCharacters("NULL\n");
+	jcw->writeHeapTotals(
+		virtualMachine->memoryManagerFunctions->j9gc_heap_total_memory(virtualMachine),
+		virtualMachine->memoryManagerFunctions->j9gc_get_softmx(virtualMachine),
+		virtualMachine->memoryManagerFunctions->j9gc_heap_free_memory(virtualMachine));
 
 	return JVMTI_ITERATION_CONTINUE;
 }
@@ -5484,22 +7389,68 @@ regionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* r
 		 * For normal GC modes we can print a line per region as
 		 * we iterate over the regions.
 		 */
-		UDATA regionEnd;
 		JavaCoreDumpWriter* jcw = (JavaCoreDumpWriter*)userData;
-		jcw->_OutputStream.writeCharacters("1STHEAPREGION  ");
-		jcw->_OutputStream.writePointer((void *)regionDescriptor->id);
-		jcw->_OutputStream.writeCharacters(" ");
-		jcw->_OutputStream.writePointer((void *)regionDescriptor->regionStart);
-		jcw->_OutputStream.writeCharacters(" ");
-		regionEnd = (UDATA)regionDescriptor->regionStart + (UDATA)regionDescriptor->regionSize;
-		jcw->_OutputStream.writePointer((const void*)regionEnd);
-		jcw->_OutputStream.writeCharacters(" ");
-		jcw->_OutputStream.writeVPrintf(FORMAT_SIZE_HEX, sizeof(void *) * 2, regionDescriptor->regionSize);
-		jcw->_OutputStream.writeCharacters(" ");
-		jcw->_OutputStream.writeCharacters(jcw->_SpaceDescriptorName);
-		jcw->_OutputStream.writeCharacters("/");
-		jcw->_OutputStream.writeCharacters(regionDescriptor->name);
-		jcw->_OutputStream.writeCharacters(" \n");
+		jcw->writeHeapRegion(regionDescriptor->id, regionDescriptor->regionStart, regionDescriptor->regionSize, jcw->_SpaceDescriptorName, regionDescriptor->name);
+	}
+
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+captureHeapIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateHeapDescriptor* heapDescriptor, void* userData)
+{
+	virtualMachine->memoryManagerFunctions->j9mm_iterate_spaces(virtualMachine, virtualMachine->portLibrary, heapDescriptor, 0, captureSpaceIteratorCallback, userData);
+
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+captureSpaceIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateSpaceDescriptor* spaceDescriptor, void* userData)
+{
+	JavaCoreDumpWriter* jcw = (JavaCoreDumpWriter*)userData;
+	JavaCoreDumpWriter::SnapshotHeapSpace* space = (JavaCoreDumpWriter::SnapshotHeapSpace*)jcw->allocateSnapshotMemory(sizeof(JavaCoreDumpWriter::SnapshotHeapSpace));
+
+	if (NULL == space) {
+		return JVMTI_ITERATION_ABORT;
+	}
+
+	space->id = spaceDescriptor->id;
+	space->name = jcw->copySnapshotString(spaceDescriptor->name);
+	space->regionTail = &space->regions;
+	*jcw->_Snapshot->heapSpaceTail = space;
+	jcw->_Snapshot->heapSpaceTail = &space->next;
+	jcw->_Snapshot->lastHeapSpace = space;
+
+	virtualMachine->memoryManagerFunctions->j9mm_iterate_regions(virtualMachine, virtualMachine->portLibrary, spaceDescriptor, j9mm_iterator_flag_regions_read_only, captureRegionIteratorCallback, jcw);
+
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+captureRegionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescriptor, void* userData)
+{
+	JavaCoreDumpWriter* jcw = (JavaCoreDumpWriter*)userData;
+	JavaCoreDumpWriter::SnapshotHeapSpace* space = jcw->_Snapshot->lastHeapSpace;
+
+	if (J9_GC_POLICY_BALANCED == ((OMR_VM *)virtualMachine->omrVM)->gcPolicy) {
+		/* As for the javacore itself, only the totals of balanced regions are kept */
+		if (0 == space->regionSize) {
+			space->regionStart = regionDescriptor->regionStart;
+		}
+		space->regionSize += (UDATA)regionDescriptor->regionSize;
+	} else {
+		JavaCoreDumpWriter::SnapshotHeapRegion* region = (JavaCoreDumpWriter::SnapshotHeapRegion*)jcw->allocateSnapshotMemory(sizeof(JavaCoreDumpWriter::SnapshotHeapRegion));
+
+		if (NULL == region) {
+			return JVMTI_ITERATION_ABORT;
+		}
+
+		region->id = regionDescriptor->id;
+		region->start = regionDescriptor->regionStart;
+		region->size = regionDescriptor->regionSize;
+		region->name = jcw->copySnapshotString(regionDescriptor->name);
+		*space->regionTail = region;
+		space->regionTail = &region->next;
 	}
 
 	return JVMTI_ITERATION_CONTINUE;
@@ -5604,6 +7555,23 @@ protectedIterateStackTrace(struct J9PortLibrary *portLibrary, void *args)
 	return 0;
 }
 
+UDATA
+protectedCaptureStackTrace(struct J9PortLibrary *portLibrary, void *args)
+{
+	struct walkClosure *closure = (struct walkClosure *)args;
+	void **parameters = (void**) closure->state;
+	/* Key:
+	 * parameters[0] = vmThread;
+	 * parameters[1] = throwable;
+	 */
+	J9VMThread* vmThread = (J9VMThread*) parameters[0];
+	closure->jcw->_VirtualMachine->internalVMFunctions->iterateStackTrace(vmThread, (j9object_t*) parameters[1],
+										captureExceptionFrameCallBack, closure->jcw,
+										FALSE);
+
+	return 0;
+}
+
 UDATA
 protectedWriteGCHistoryLines(struct J9PortLibrary *portLibrary, void *args)
 {
@@ -5626,6 +7594,22 @@ protectedWriteThreadBlockers(struct J9PortLibrary *portLibrary, void *args)
 	return 0;
 }
 
+UDATA
+protectedCaptureThreadBlockers(struct J9PortLibrary *portLibrary, void *args)
+{
+	struct walkClosure *closure = (struct walkClosure *)args;
+	closure->jcw->captureThreadBlockers((JavaCoreDumpWriter::SnapshotThread*)closure->state);
+	return 0;
+}
+
+UDATA
+protectedCaptureJavaLangThreadInfo(struct J9PortLibrary *portLibrary, void *args)
+{
+	struct walkClosure *closure = (struct walkClosure *)args;
+	closure->jcw->captureJavaLangThreadInfo((JavaCoreDumpWriter::SnapshotThread*)closure->state);
+	return 0;
+}
+
 /**
  * Wrapper function for getOwnedObjectMonitors to unpack arguments
  * when called via _PortLibrary->sig_protect().
@@ -5826,6 +7810,22 @@ handlerIterateStackTrace(struct J9PortLibrary *portLibrary, U_32 gpType, void* g
 	return J9PORT_SIG_EXCEPTION_RETURN;
 }
 
+/**
+ * Handler function for the low pause snapshot captures when called via _PortLibrary->sig_protect().
+ * Nothing is written while capturing, the caller records the failure and the message is written
+ * when the snapshot is formatted.
+ * @param portLibrary[in] pointer to the port library
+ * @param gpType[in] failure type
+ * @param gpInfo[in] failure info
+ * @param userData[in] pointer to "this", the JavaCoreDumpWriter that we are running in.
+ * @return J9PORT_SIG_EXCEPTION_RETURN
+ */
+UDATA
+handlerCaptureSnapshot(struct J9PortLibrary *portLibrary, U_32 gpType, void* gpInfo, void* userData)
+{
+	return J9PORT_SIG_EXCEPTION_RETURN;
+}
+
 /**
  * Handler function for writeThreadsWithNativeStacks and writeThreadsJavaOnly
  * when called via _PortLibrary->sig_protect().
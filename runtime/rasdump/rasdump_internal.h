@@ -109,6 +109,7 @@ UDATA parseAllocationRange(char *range, UDATA *min, UDATA *max);
 omr_error_t rasDumpEnableHooks(J9JavaVM *vm, UDATA eventFlags);
 void rasDumpFlushHooks(J9JavaVM *vm, IDATA stage);
 void setAllocationThreshold(J9VMThread *vmThread, UDATA min, UDATA max);
+UDATA releaseExclusiveAfterDump(struct J9JavaVM *vm, struct J9RASdumpContext *context, UDATA state);
 
 /* Constants used with the RASDumpSystemInfo structures (linked list off J9RAS.systemInfo) */
 #define J9RAS_SYSTEMINFO_SCHED_COMPAT_YIELD 1
@@ -688,6 +688,48 @@ prepareForDump(struct J9JavaVM *vm, struct J9RASdumpAgent *agent, struct J9RASdu
 #endif /* J9VM_RAS_DUMP_AGENTS */
 
 
+#if (defined(J9VM_RAS_DUMP_AGENTS))
+/*
+ * Function: releaseExclusiveAfterDump - give up the exclusive VM access taken by prepareForDump
+ *
+ * Called by unwindAfterDump, and early by dump writers that have finished with the paused
+ * VM (javadump request=lowpause) so the remaining work is done while Java threads run.
+ *
+ * Returns: the state with the exclusive access and dependent heap bits cleared
+ */
+UDATA
+releaseExclusiveAfterDump(struct J9JavaVM *vm, struct J9RASdumpContext *context, UDATA state)
+{
+	J9VMThread *vmThread = context->onThread;
+	UDATA newState = state;
+
+	if (state & J9RAS_DUMP_GOT_EXCLUSIVE_VM_ACCESS) {
+
+		if (vmThread) {
+			vm->internalVMFunctions->releaseExclusiveVMAccess(vmThread);
+#if defined(J9VM_INTERP_ATOMIC_FREE_JNI)
+			if (state & J9RAS_DUMP_GOT_JNI_VM_ACCESS) {
+				vm->internalVMFunctions->internalExitVMToJNI(vmThread);
+				newState &= ~J9RAS_DUMP_GOT_JNI_VM_ACCESS;
+			} else
+#endif /* J9VM_INTERP_ATOMIC_FREE_JNI */
+			if (state & J9RAS_DUMP_GOT_VM_ACCESS) {
+				vm->internalVMFunctions->internalReleaseVMAccess(vmThread);
+				newState &= ~J9RAS_DUMP_GOT_VM_ACCESS;
+			}
+		} else {
+			vm->internalVMFunctions->releaseExclusiveVMAccessFromExternalThread(vm);
+		}
+
+		/* Releasing exclusive access potentially invalidates the state of the heap... */
+		newState &= ~( J9RAS_DUMP_GOT_EXCLUSIVE_VM_ACCESS | J9RAS_DUMP_HEAP_COMPACTED | J9RAS_DUMP_HEAP_PREPARED );
+	}
+
+	return newState;
+}
+#endif /* J9VM_RAS_DUMP_AGENTS */
+
+
 #if (defined(J9VM_RAS_DUMP_AGENTS)) 
 UDATA
 unwindAfterDump(struct J9JavaVM *vm, struct J9RASdumpContext *context, UDATA state)
@@ -716,25 +758,7 @@ unwindAfterDump(struct J9JavaVM *vm, struct J9RASdumpContext *context, UDATA sta
 	}
 
 	if (state & J9RAS_DUMP_GOT_EXCLUSIVE_VM_ACCESS) {
-
-		if (vmThread) {
-			vm->internalVMFunctions->releaseExclusiveVMAccess(vmThread);
-#if defined(J9VM_INTERP_ATOMIC_FREE_JNI)
-			if (state & J9RAS_DUMP_GOT_JNI_VM_ACCESS) {
-				vm->internalVMFunctions->internalExitVMToJNI(vmThread);
-				newState &= ~J9RAS_DUMP_GOT_JNI_VM_ACCESS;
-			} else
-#endif /* J9VM_INTERP_ATOMIC_FREE_JNI */
-			if (state & J9RAS_DUMP_GOT_VM_ACCESS) {
-				vm->internalVMFunctions->internalReleaseVMAccess(vmThread);
-				newState &= ~J9RAS_DUMP_GOT_VM_ACCESS;
-			}
-		} else {
-			vm->internalVMFunctions->releaseExclusiveVMAccessFromExternalThread(vm);
-		}
-
-		/* Releasing exclusive access potentially invalidates the state of the heap... */
-		newState &= ~( J9RAS_DUMP_GOT_EXCLUSIVE_VM_ACCESS | J9RAS_DUMP_HEAP_COMPACTED | J9RAS_DUMP_HEAP_PREPARED );
+		newState = releaseExclusiveAfterDump(vm, context, newState);
 	}
 
 	if (state & J9RAS_DUMP_ATTACHED_THREAD) {
@@ -64,6 +64,19 @@ extern J9_CFUNC I_32
 verifyArgScan (J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
 
 
+/* ---------------- crc32test.c ---------------- */
+
+/**
+* @brief
+* @param *portLib
+* @param *passCount
+* @param *failCount
+* @return I_32
+*/
+I_32
+verifyCRC32(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
+
+
 /* ---------------- simplepooltest.c ---------------- */
 
 /**
@@ -123,6 +136,20 @@ verifySRPHashtable(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
 I_32
 verifyPrimeNumberHelper(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
 
+/* ---------------- zipcachetest.c ---------------- */
+
+#if defined(J9VM_OPT_ZIP_SUPPORT)
+/**
+* @brief
+* @param *portLib
+* @param *passCount
+* @param *failCount
+* @return I_32
+*/
+I_32
+verifyZipCache(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
+#endif /* defined(J9VM_OPT_ZIP_SUPPORT) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -74,6 +74,16 @@ UDATA signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
 		numSuitesNotRun++;
 	}
 
+	if (verifyCRC32(PORTLIB, &passCount, &failCount)) {
+		numSuitesNotRun++;
+	}
+
+#if defined(J9VM_OPT_ZIP_SUPPORT)
+	if (verifyZipCache(PORTLIB, &passCount, &failCount)) {
+		numSuitesNotRun++;
+	}
+#endif /* defined(J9VM_OPT_ZIP_SUPPORT) */
+
 	j9tty_printf( PORTLIB, "Algorithm Test Finished\n");
 	j9tty_printf( PORTLIB, "total tests: %d\n", passCount + failCount);
 	j9tty_printf( PORTLIB, "total passes: %d\n", passCount);
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+#include "util_api.h"
+
+#define CRC32_TEST_BUFFER_SIZE 4096
+#define CRC32_BENCH_ITERATIONS 4096
+
+/**
+ * Byte at a time reference implementation of the zip CRC32, computed without tables.
+ */
+static U_32
+referenceCRC32(U_32 crc, U_8 *bytes, U_32 len)
+{
+	crc = ~crc;
+	while (0 != len--) {
+		U_32 i = 0;
+		crc ^= *bytes++;
+		for (i = 0; i < 8; i++) {
+			crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+		}
+	}
+	return ~crc;
+}
+
+/**
+ * Compare j9crc32() against the reference for every length up to 64 bytes at each
+ * alignment, and for a large buffer computed in one call and in pieces.
+ */
+static void
+testCRC32Values(J9PortLibrary *portLib, U_8 *buffer, UDATA *passCount, UDATA *failCount)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	U_32 offset = 0;
+	U_32 length = 0;
+	U_32 crc = 0;
+	U_32 expected = 0;
+
+	for (offset = 0; offset < 8; offset++) {
+		for (length = 0; length <= 64; length++) {
+			expected = referenceCRC32(0, buffer + offset, length);
+			crc = j9crc32(0, buffer + offset, length);
+			if (expected != crc) {
+				j9tty_printf(PORTLIB, "\tj9crc32 failure: offset=%u length=%u expected=0x%08x got=0x%08x\n", offset, length, expected, crc);
+				(*failCount)++;
+			} else {
+				(*passCount)++;
+			}
+		}
+	}
+
+	expected = referenceCRC32(0, buffer, CRC32_TEST_BUFFER_SIZE);
+	crc = j9crc32(0, buffer, CRC32_TEST_BUFFER_SIZE);
+	if (expected != crc) {
+		j9tty_printf(PORTLIB, "\tj9crc32 failure: full buffer expected=0x%08x got=0x%08x\n", expected, crc);
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+
+	/* the CRC must be the same when computed incrementally with odd sized pieces */
+	crc = j9crc32(0, buffer, 13);
+	crc = j9crc32(crc, buffer + 13, 1000);
+	crc = j9crc32(crc, buffer + 1013, CRC32_TEST_BUFFER_SIZE - 1013);
+	if (expected != crc) {
+		j9tty_printf(PORTLIB, "\tj9crc32 failure: incremental expected=0x%08x got=0x%08x\n", expected, crc);
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+
+	/* the well known check value for "123456789" */
+	crc = j9crc32(0, (U_8 *)"123456789", 9);
+	if (0xCBF43926 != crc) {
+		j9tty_printf(PORTLIB, "\tj9crc32 failure: check value expected=0xcbf43926 got=0x%08x\n", crc);
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+}
+
+/**
+ * Verify j9crc32() and report its throughput.
+ *
+ * @param 	portlib 	Pointer to the port library.
+ * @param	passCount	Pointer to the passed tests counter.
+ * @param 	failCount  	Pointer to the failed tests counter.
+ * @return 	0 on success, -1 if the test could not be run
+ */
+I_32
+verifyCRC32(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	U_8 *buffer = NULL;
+	UDATA i = 0;
+	UDATA start = 0;
+	UDATA end = 0;
+	U_32 crc = 0;
+	U_32 seed = 0x12345678;
+
+	j9tty_printf(PORTLIB, "Testing j9crc32...\n");
+
+	buffer = j9mem_allocate_memory(CRC32_TEST_BUFFER_SIZE + 8, OMRMEM_CATEGORY_VM);
+	if (NULL == buffer) {
+		j9tty_printf(PORTLIB, "\tUnable to allocate test buffer\n");
+		return -1;
+	}
+	for (i = 0; i < CRC32_TEST_BUFFER_SIZE + 8; i++) {
+		seed = (seed * 1103515245) + 12345;
+		buffer[i] = (U_8)(seed >> 16);
+	}
+
+	testCRC32Values(portLib, buffer, passCount, failCount);
+
+	start = j9time_usec_clock();
+	for (i = 0; i < CRC32_BENCH_ITERATIONS; i++) {
+		crc = j9crc32(crc, buffer, CRC32_TEST_BUFFER_SIZE);
+	}
+	end = j9time_usec_clock();
+	j9tty_printf(PORTLIB, "j9crc32 of %zu bytes took %zu (usec), crc=0x%08x\n", (UDATA)CRC32_TEST_BUFFER_SIZE * CRC32_BENCH_ITERATIONS, (end - start), crc);
+
+	j9mem_free_memory(buffer);
+	j9tty_printf(PORTLIB, "Finished testing j9crc32.\n");
+	return 0;
+}
@@ -0,0 +1,258 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+#include "algotest.h"
+#include "util_api.h"
+
+#if defined(J9VM_OPT_ZIP_SUPPORT)
+
+#define ZIPCACHE_TEST_FILE "zipcachetest.jar"
+#define ZIPCACHE_TEST_PACKAGES 200
+#define ZIPCACHE_TEST_CLASSES_PER_PACKAGE 100
+#define ZIPCACHE_TEST_ITERATIONS 20
+
+/* Jars are not mapped on Windows, where a mapped file cannot be replaced or deleted */
+#if defined(WIN32)
+#define MAPPED_JAR_SUPPORTED() FALSE
+#else /* defined(WIN32) */
+#define MAPPED_JAR_SUPPORTED() J9_ARE_ALL_BITS_SET(j9mmap_capabilities(), J9PORT_MMAP_CAPABILITY_READ)
+#endif /* defined(WIN32) */
+
+static void
+putU16(U_8 *buffer, U_16 value)
+{
+	buffer[0] = (U_8)value;
+	buffer[1] = (U_8)(value >> 8);
+}
+
+static void
+putU32(U_8 *buffer, U_32 value)
+{
+	buffer[0] = (U_8)value;
+	buffer[1] = (U_8)(value >> 8);
+	buffer[2] = (U_8)(value >> 16);
+	buffer[3] = (U_8)(value >> 24);
+}
+
+static UDATA
+entryName(J9PortLibrary *portLib, char *buffer, UDATA bufferSize, UDATA package, UDATA clazz)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	return j9str_printf(PORTLIB, buffer, bufferSize, "org/example/pkg%04zu/GeneratedClass%04zu.class", package, clazz);
+}
+
+/**
+ * Write a jar of stored entries spread over many packages, the shape of a large
+ * application jar as far as the central directory is concerned. Each entry holds
+ * its own name as data.
+ *
+ * @return TRUE if the file was written
+ */
+static BOOLEAN
+writeTestJar(J9PortLibrary *portLib, const char *fileName)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	U_32 entryCount = ZIPCACHE_TEST_PACKAGES * ZIPCACHE_TEST_CLASSES_PER_PACKAGE;
+	U_32 *localOffsets = NULL;
+	U_8 header[46];
+	char name[64];
+	U_32 offset = 0;
+	U_32 centralStart = 0;
+	UDATA package = 0;
+	UDATA clazz = 0;
+	U_32 index = 0;
+	BOOLEAN ok = TRUE;
+	IDATA fd = j9file_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+
+	if (-1 == fd) {
+		return FALSE;
+	}
+	localOffsets = j9mem_allocate_memory(entryCount * sizeof(U_32), OMRMEM_CATEGORY_VM);
+	if (NULL == localOffsets) {
+		j9file_close(fd);
+		return FALSE;
+	}
+
+	/* local headers, each followed by the entry name as data */
+	for (package = 0; package < ZIPCACHE_TEST_PACKAGES; package++) {
+		for (clazz = 0; clazz < ZIPCACHE_TEST_CLASSES_PER_PACKAGE; clazz++) {
+			U_16 nameLength = (U_16)entryName(portLib, name, sizeof(name), package, clazz);
+			memset(header, 0, sizeof(header));
+			putU32(header, 0x04034b50);
+			putU16(header + 4, 10);
+			putU32(header + 14, j9crc32(0, (U_8 *)name, nameLength));
+			putU32(header + 18, nameLength);
+			putU32(header + 22, nameLength);
+			putU16(header + 26, nameLength);
+			ok = ok && (30 == j9file_write(fd, header, 30))
+				&& (nameLength == j9file_write(fd, name, nameLength))
+				&& (nameLength == j9file_write(fd, name, nameLength));
+			localOffsets[index++] = offset;
+			offset += 30 + (2 * nameLength);
+		}
+	}
+
+	/* central directory */
+	centralStart = offset;
+	index = 0;
+	for (package = 0; package < ZIPCACHE_TEST_PACKAGES; package++) {
+		for (clazz = 0; clazz < ZIPCACHE_TEST_CLASSES_PER_PACKAGE; clazz++) {
+			U_16 nameLength = (U_16)entryName(portLib, name, sizeof(name), package, clazz);
+			memset(header, 0, sizeof(header));
+			putU32(header, 0x02014b50);
+			putU16(header + 4, 10);
+			putU16(header + 6, 10);
+			putU32(header + 16, j9crc32(0, (U_8 *)name, nameLength));
+			putU32(header + 20, nameLength);
+			putU32(header + 24, nameLength);
+			putU16(header + 28, nameLength);
+			putU32(header + 42, localOffsets[index++]);
+			ok = ok && (46 == j9file_write(fd, header, 46)) && (nameLength == j9file_write(fd, name, nameLength));
+			offset += 46 + nameLength;
+		}
+	}
+
+	/* end of central directory */
+	memset(header, 0, sizeof(header));
+	putU32(header, 0x06054b50);
+	putU16(header + 8, (U_16)entryCount);
+	putU16(header + 10, (U_16)entryCount);
+	putU32(header + 12, offset - centralStart);
+	putU32(header + 16, centralStart);
+	ok = ok && (22 == j9file_write(fd, header, 22));
+
+	j9mem_free_memory(localOffsets);
+	j9file_close(fd);
+	return ok;
+}
+
+/**
+ * Open the test jar with a fresh cache pool, so the zip cache is built from the central
+ * directory each time, and look up the first and last entries of some packages. The data
+ * of each entry found is checked both when copied out and when read in place from the
+ * mapped jar.
+ */
+static I_32
+openTestJar(J9PortLibrary *portLib, const char *fileName, BOOLEAN verify, UDATA *passCount, UDATA *failCount)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	J9ZipCachePool *cachePool = zipCachePool_new(portLib, NULL);
+	J9ZipFile zipFile;
+	I_32 rc = 0;
+
+	if (NULL == cachePool) {
+		return ZIP_ERR_OUT_OF_MEMORY;
+	}
+	rc = zip_openZipFile(portLib, (char *)fileName, &zipFile, cachePool, J9ZIP_OPEN_NO_FLAGS);
+	if (0 == rc) {
+		if (verify) {
+			UDATA package = 0;
+			for (package = 0; package < ZIPCACHE_TEST_PACKAGES; package += 17) {
+				UDATA clazz = 0;
+				for (clazz = 0; clazz < ZIPCACHE_TEST_CLASSES_PER_PACKAGE; clazz += ZIPCACHE_TEST_CLASSES_PER_PACKAGE - 1) {
+					J9ZipEntry entry;
+					char name[64];
+					U_8 data[64];
+					U_8 *mappedData = NULL;
+					UDATA nameLength = entryName(portLib, name, sizeof(name), package, clazz);
+
+					zip_initZipEntry(portLib, &entry);
+					if (0 == zip_getZipEntry(portLib, &zipFile, &entry, name, nameLength, J9ZIP_GETENTRY_READ_DATA_POINTER)) {
+						(*passCount)++;
+						if ((0 == zip_getZipEntryData(portLib, &zipFile, &entry, data, sizeof(data)))
+							&& (nameLength == entry.uncompressedSize)
+							&& (0 == memcmp(data, name, nameLength))
+						) {
+							(*passCount)++;
+						} else {
+							j9tty_printf(PORTLIB, "	zip cache failure: wrong data read for %s\n", name);
+							(*failCount)++;
+						}
+						if ((0 == zip_getZipEntryDataPointer(portLib, &zipFile, &entry, &mappedData))
+							&& (0 == memcmp(mappedData, name, nameLength))
+						) {
+							(*passCount)++;
+						} else if (MAPPED_JAR_SUPPORTED()) {
+							j9tty_printf(PORTLIB, "	zip cache failure: wrong mapped data for %s\n", name);
+							(*failCount)++;
+						}
+					} else {
+						j9tty_printf(PORTLIB, "\tzip cache failure: %s not found\n", name);
+						(*failCount)++;
+					}
+					zip_freeZipEntry(portLib, &entry);
+				}
+			}
+		}
+		zip_releaseZipFile(portLib, &zipFile);
+	}
+	zipCachePool_kill(cachePool);
+	return rc;
+}
+
+/**
+ * Verify that the zip cache built for a jar with many entries finds them, and report
+ * how long opening the jar takes (building the cache from the central directory).
+ *
+ * @param 	portlib 	Pointer to the port library.
+ * @param	passCount	Pointer to the passed tests counter.
+ * @param 	failCount  	Pointer to the failed tests counter.
+ * @return 	0 on success, -1 if the test could not be run
+ */
+I_32
+verifyZipCache(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	UDATA i = 0;
+	UDATA start = 0;
+	UDATA end = 0;
+	I_32 rc = 0;
+
+	j9tty_printf(PORTLIB, "Testing zip cache...\n");
+
+	if (!writeTestJar(portLib, ZIPCACHE_TEST_FILE)) {
+		j9tty_printf(PORTLIB, "\tUnable to write %s\n", ZIPCACHE_TEST_FILE);
+		j9file_unlink(ZIPCACHE_TEST_FILE);
+		return -1;
+	}
+
+	rc = openTestJar(portLib, ZIPCACHE_TEST_FILE, TRUE, passCount, failCount);
+	if (0 != rc) {
+		j9tty_printf(PORTLIB, "\tzip_openZipFile failed, rc=%d\n", rc);
+		(*failCount)++;
+	} else {
+		start = j9time_usec_clock();
+		for (i = 0; i < ZIPCACHE_TEST_ITERATIONS; i++) {
+			openTestJar(portLib, ZIPCACHE_TEST_FILE, FALSE, passCount, failCount);
+		}
+		end = j9time_usec_clock();
+		j9tty_printf(PORTLIB, "Opening a jar with %zu entries took %zu (usec) on average\n",
+				(UDATA)ZIPCACHE_TEST_PACKAGES * ZIPCACHE_TEST_CLASSES_PER_PACKAGE, (end - start) / ZIPCACHE_TEST_ITERATIONS);
+	}
+
+	j9file_unlink(ZIPCACHE_TEST_FILE);
+	j9tty_printf(PORTLIB, "Finished testing zip cache.\n");
+	return 0;
+}
+
+#endif /* defined(J9VM_OPT_ZIP_SUPPORT) */
@@ -430,3 +430,42 @@ Java_j9vm_test_jni_CriticalRegionTest_acquireDiscardAndGC(JNIEnv * env, jclass c
 	(*env)->ReleasePrimitiveArrayCritical(env, array, elems1, 0);
 	return result;
 }
+
+jboolean JNICALL
+Java_j9vm_test_jni_CriticalRegionTest_countsCopies(JNIEnv * env, jclass clazz, jintArray array)
+{
+	J9JavaVM* vm = ((J9VMThread*)env)->javaVM;
+	UDATA byteCount = (UDATA)(*env)->GetArrayLength(env, array) * sizeof(jint);
+	UDATA copies, copiedBytes, mappings, mappedBytes;
+	UDATA copiesAfter, copiedBytesAfter, mappingsAfter, mappedBytesAfter;
+	void* elems;
+	jboolean isCopy;
+
+	/* the counters are VM wide, so other threads can only make them grow further */
+	vm->memoryManagerFunctions->j9gc_get_jni_array_stats(vm, &copies, &copiedBytes, &mappings, &mappedBytes);
+	elems = (*env)->GetIntArrayElements(env, array, &isCopy);
+	if(NULL == elems) {
+		reportError(env, clazz);
+		return JNI_FALSE;
+	}
+	(*env)->ReleaseIntArrayElements(env, array, elems, JNI_ABORT);
+	vm->memoryManagerFunctions->j9gc_get_jni_array_stats(vm, &copiesAfter, &copiedBytesAfter, &mappingsAfter, &mappedBytesAfter);
+	if((JNI_TRUE == isCopy) && ((copiesAfter == copies) || ((copiedBytesAfter - copiedBytes) < byteCount))) {
+		return JNI_FALSE;
+	}
+
+	copies = copiesAfter;
+	copiedBytes = copiedBytesAfter;
+	elems = (*env)->GetPrimitiveArrayCritical(env, array, &isCopy);
+	if(NULL == elems) {
+		reportError(env, clazz);
+		return JNI_FALSE;
+	}
+	(*env)->ReleasePrimitiveArrayCritical(env, array, elems, JNI_ABORT);
+	vm->memoryManagerFunctions->j9gc_get_jni_array_stats(vm, &copiesAfter, &copiedBytesAfter, &mappingsAfter, &mappedBytesAfter);
+	if((JNI_TRUE == isCopy) && ((copiesAfter == copies) || ((copiedBytesAfter - copiedBytes) < byteCount))) {
+		return JNI_FALSE;
+	}
+
+	return JNI_TRUE;
+}
@@ -30,6 +30,8 @@ omr_add_exports(j9ben
 	Java_jit_test_vich_JNIObjectArray_getObjectArrayElement
 	Java_jit_test_vich_JNILocalRef_localReference32
 	Java_jit_test_vich_JNILocalRef_localReference8
+	Java_jit_test_vich_JNIGlobalRef_globalReference
+	Java_jit_test_vich_JNIGlobalRef_weakGlobalReference
 	Java_jit_test_vich_JNIArray_getPrimitiveArrayCritical
 	Java_jit_test_vich_JNIArray_getDoubleArrayElements
 	Java_jit_test_vich_JNIArray_getLongArrayElements
@@ -224,6 +226,7 @@ omr_add_exports(j9ben
 	Java_j9vm_test_jni_CriticalRegionTest_acquireAndSleep
 	Java_j9vm_test_jni_CriticalRegionTest_acquireAndCallIn
 	Java_j9vm_test_jni_CriticalRegionTest_acquireDiscardAndGC
+	Java_j9vm_test_jni_CriticalRegionTest_countsCopies
 	Java_j9vm_test_jni_Utf8Test_testAttachCurrentThreadAsDaemon
 	Java_j9vm_test_memory_MemoryAllocator_allocateMemory
 	Java_j9vm_test_memory_MemoryAllocator_allocateMemory32
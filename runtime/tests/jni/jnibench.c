@@ -3701,6 +3701,44 @@ void JNICALL Java_jit_test_vich_JNILocalRef_localReference32(JNIEnv *env, jobjec
 }
 
 
+void JNICALL Java_jit_test_vich_JNIGlobalRef_globalReference(JNIEnv *env, jobject obj, jobject o1, jint loopCount)
+{
+	jint i;
+	jint j;
+	jobject refs[8];
+
+	for (i = 0; i < loopCount; i++)
+	{
+		for (j = 0; j < 8; j++) {
+			refs[j] = (*env)->NewGlobalRef(env, o1);
+		}
+		for (j = 7; j >= 0; j--) {
+			(*env)->DeleteGlobalRef(env, refs[j]);
+		}
+	}
+	return;
+}
+
+
+void JNICALL Java_jit_test_vich_JNIGlobalRef_weakGlobalReference(JNIEnv *env, jobject obj, jobject o1, jint loopCount)
+{
+	jint i;
+	jint j;
+	jweak refs[8];
+
+	for (i = 0; i < loopCount; i++)
+	{
+		for (j = 0; j < 8; j++) {
+			refs[j] = (*env)->NewWeakGlobalRef(env, o1);
+		}
+		for (j = 7; j >= 0; j--) {
+			(*env)->DeleteWeakGlobalRef(env, refs[j]);
+		}
+	}
+	return;
+}
+
+
 void JNICALL Java_jit_test_vich_JNIObjectArray_getObjectArrayElement(JNIEnv *env, jobject obj, jobjectArray array, jobjectArray blankArray, jint arraySize, jint loopCount)
 {
 	jint i, j;
@@ -1719,6 +1719,30 @@ void JNICALL
 Java_jit_test_vich_JNILocalRef_localReference8(JNIEnv *env, jobject obj, jobject o1, jobject o2, jobject o3, jobject o4, jobject o5, jobject o6, jobject o7, jobject o8, jint loopCount);
 
 
+/**
+* @brief
+* @param *env
+* @param obj
+* @param o1
+* @param loopCount
+* @return void
+*/
+void JNICALL 
+Java_jit_test_vich_JNIGlobalRef_globalReference(JNIEnv *env, jobject obj, jobject o1, jint loopCount);
+
+
+/**
+* @brief
+* @param *env
+* @param obj
+* @param o1
+* @param loopCount
+* @return void
+*/
+void JNICALL 
+Java_jit_test_vich_JNIGlobalRef_weakGlobalReference(JNIEnv *env, jobject obj, jobject o1, jint loopCount);
+
+
 /**
 * @brief
 * @param *env
@@ -2145,6 +2169,9 @@ Java_j9vm_test_jni_CriticalRegionTest_acquireAndCallIn(JNIEnv * env, jclass claz
 jboolean JNICALL
 Java_j9vm_test_jni_CriticalRegionTest_acquireDiscardAndGC(JNIEnv * env, jclass clazz, jbyteArray array, jlongArray addresses);
 
+jboolean JNICALL
+Java_j9vm_test_jni_CriticalRegionTest_countsCopies(JNIEnv * env, jclass clazz, jintArray array);
+
 
 #ifdef __cplusplus
 }
@@ -76,6 +76,7 @@ static UDATA areMethodsEquivalentSub(J9ROMMethod * method1, J9ROMClass * romClas
 static UDATA areCallSiteDataMethodsEquivalent(J9ROMClass* romClass1, UDATA callSiteIndex1, J9ROMClass* romClass2, UDATA callSiteIndes2);
 static UDATA areDoubleSlotConstantRefsIdentical(J9ROMConstantPoolItem * romCP1, U_32 index1, J9ROMConstantPoolItem * romCP2, U_32 index2);
 static void fixClassSlot(J9VMThread* currentThread, J9Class** classSlot, J9HashTable *classPairs);
+static void rebuildITableIndex(J9Class *clazz);
 static void fixJNIFieldIDs(J9VMThread * currentThread, J9Class * originalClass, J9Class * replacementClass);
 static void copyStaticFields (J9VMThread * currentThread, J9Class * originalRAMClass, J9Class * replacementRAMClass);
 static void fixLoadingConstraints (J9JavaVM * vm, J9Class * oldClass, J9Class * newClass);
@@ -1037,6 +1038,45 @@ fixClassSlot(J9VMThread* currentThread, J9Class** classSlot, J9HashTable *classP
 	}
 }
 
+/*
+ * Rehash the iTable index of clazz in place after its iTables or their
+ * interface classes have been replaced. The index is discarded if the
+ * iTables no longer fit in it. Obsolete classes are skipped, fixITables()
+ * gives them the index of the current class version.
+ */
+static void
+rebuildITableIndex(J9Class *clazz)
+{
+	J9ITableIndex *iTableIndex = clazz->iTableIndex;
+
+	if ((NULL != iTableIndex) && !J9_IS_CLASS_OBSOLETE(clazz)) {
+		J9ITable **slots = J9ITABLEINDEX_SLOTS(iTableIndex);
+		UDATA mask = iTableIndex->mask;
+		UDATA iTableCount = 0;
+		J9ITable *iTable = (J9ITable *)clazz->iTable;
+
+		while (NULL != iTable) {
+			iTableCount += 1;
+			iTable = iTable->next;
+		}
+		/* A lookup probes until it reaches an empty slot, so one must always be left */
+		if (iTableCount > mask) {
+			clazz->iTableIndex = NULL;
+		} else {
+			memset(slots, 0, (mask + 1) * sizeof(J9ITable *));
+			iTable = (J9ITable *)clazz->iTable;
+			while (NULL != iTable) {
+				UDATA slot = J9ITABLEINDEX_HASH(iTable->interfaceClass) & mask;
+				while (NULL != slots[slot]) {
+					slot = (slot + 1) & mask;
+				}
+				slots[slot] = iTable;
+				iTable = iTable->next;
+			}
+		}
+	}
+}
+
 /*
  * For each replaced interface in classPairs, update the iTables of
  * all implementers to point at the new version of the class.
@@ -1068,10 +1108,19 @@ fixITables(J9VMThread * currentThread, J9HashTable * classPairs)
 	while (clazz != NULL) {
 		if (anyInterfaces) {
 			J9ITable *iTable = (J9ITable *)clazz->iTable;
+			UDATA interfaceReplaced = FALSE;
 			while( iTable != NULL ) {
+				J9Class *interfaceClass = iTable->interfaceClass;
 				fixClassSlot(currentThread, &iTable->interfaceClass, classPairs);
+				if (interfaceClass != iTable->interfaceClass) {
+					interfaceReplaced = TRUE;
+				}
 				iTable = iTable->next;
 			}
+			/* The iTable index is hashed by interface class */
+			if (interfaceReplaced) {
+				rebuildITableIndex(clazz);
+			}
 		}
 
 		if (J9_IS_CLASS_OBSOLETE(clazz)) {
@@ -1136,6 +1185,8 @@ fixITables(J9VMThread * currentThread, J9HashTable * classPairs)
 								iTable = iTable->next;
 							}
 						}
+						/* The iTable index holds the old iTables of the superclass */
+						rebuildITableIndex(clazz);
 					}
 				}
 				superClass = GET_SUPERCLASS(superClass);
@@ -1169,6 +1220,7 @@ fixITables(J9VMThread * currentThread, J9HashTable * classPairs)
 	while (clazz != NULL) {
 		if (J9_IS_CLASS_OBSOLETE(clazz)) {
 			clazz->iTable = J9_CURRENT_CLASS(clazz)->iTable;
+			clazz->iTableIndex = J9_CURRENT_CLASS(clazz)->iTableIndex;
 		}
 		clazz = vmFuncs->allClassesNextDo(&classWalkState);
 	}
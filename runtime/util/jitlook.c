@@ -86,4 +86,19 @@ J9JITExceptionTable* jit_artifact_search(J9AVLTree *tree, UDATA searchValue) {
 }
 
 
+J9JITExceptionTable* jit_artifact_search_with_table_hint(J9AVLTree *tree, J9JITHashTable **tableHint, UDATA searchValue) {
+   J9JITHashTable *table = *tableHint;
+   /* Code cache hash tables are only freed at shutdown, so the table which satisfied the
+    * previous search can be probed directly while the search value remains in its range */
+   if ((NULL == table) || (searchValue < table->start) || (searchValue >= table->end)) {
+      table = (J9JITHashTable*)avl_search(tree, searchValue);
+      if (NULL == table) {
+         return NULL;
+      }
+      *tableHint = table;
+   }
+   return hash_jit_artifact_search(table, searchValue);
+}
+
+
 #endif /* J9VM_INTERP_NATIVE_SUPPORT */ /* End File Level Build Flags */
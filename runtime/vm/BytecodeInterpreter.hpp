@@ -2946,6 +2946,11 @@ done:
 					walkFlags |= J9_STACKWALK_HIDE_EXCEPTION_FRAMES;
 					walkState->restartException = receiver;
 				}
+				/* Only record the innermost frames if -XX:MaxJavaStackTraceDepth is in effect */
+				if (0 != _vm->maxStackTraceDepth) {
+					walkFlags |= J9_STACKWALK_COUNT_SPECIFIED;
+					walkState->maxFrames = _vm->maxStackTraceDepth;
+				}
 				walkState->flags = walkFlags;
 				walkState->skipCount = 1;	// skip the INL frame
 				walkState->walkThread = _currentThread;
@@ -2965,6 +2970,14 @@ done:
 					rc = GOTO_THROW_CURRENT_EXCEPTION;
 					goto done;
 				}
+				if (J9_ARE_ANY_BITS_SET(_vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_COMPACT_STACK_TRACES)) {
+					/* An existing array must not end part way through a repeated frame */
+					UDATA maxEntries = UDATA_MAX;
+					if ((NULL != walkback) && (_currentThread->privateFlags & J9_PRIVATE_FLAGS_FILL_EXISTING_TRACE)) {
+						maxEntries = J9INDEXABLEOBJECT_SIZE(_currentThread, walkback);
+					}
+					framesWalked = compactStackTrace(cachePointer, framesWalked, maxEntries);
+				}
 				/* If there is no stack trace in the exception, or we are not in the out of memory case,
 				 * allocate a new stack trace.  The cached receiver object is invalid after this point.
 				 */
@@ -6833,6 +6846,74 @@ done:
 		return GOTO_RUN_METHOD;
 	}
 
+	/**
+	 * Find the set of the invokeinterface call site cache which holds the entries for a call site.
+	 * @param callSite the resolved constant pool entry of the call site
+	 * @returns the first entry of the set
+	 */
+	VMINLINE J9InterfaceCallSiteCacheEntry *
+	interfaceCallSiteCacheSet(J9RAMInterfaceMethodRef *callSite)
+	{
+		UDATA set = ((UDATA)callSite / sizeof(J9RAMInterfaceMethodRef)) & _vm->interfaceCallSiteCacheMask;
+		return _vm->interfaceCallSiteCache + (set * J9_INTERFACE_CALL_SITE_CACHE_WAYS);
+	}
+
+	/**
+	 * Look up the target of an invokeinterface call site for a receiver class, without
+	 * searching the iTables of the class.
+	 * @param callSite the resolved constant pool entry of the call site
+	 * @param receiverClass the class of the receiver
+	 * @returns the vTable offset of the target, or 0 if the cache does not hold it
+	 */
+	VMINLINE UDATA
+	interfaceCallSiteCacheLookup(J9RAMInterfaceMethodRef *callSite, J9Class *receiverClass)
+	{
+		UDATA vTableOffset = 0;
+		J9InterfaceCallSiteCacheEntry *entry = interfaceCallSiteCacheSet(callSite);
+		for (UDATA way = 0; way < J9_INTERFACE_CALL_SITE_CACHE_WAYS; ++way, ++entry) {
+			UDATA sequence = entry->sequence;
+			VM_AtomicSupport::readBarrier();
+			if ((callSite == entry->callSite) && (receiverClass == entry->receiverClass)) {
+				UDATA cachedOffset = entry->vTableOffset;
+				VM_AtomicSupport::readBarrier();
+				/* Only use the offset if no update was in progress or started during the read */
+				if (J9_ARE_NO_BITS_SET(sequence, 1) && (sequence == entry->sequence)) {
+					vTableOffset = cachedOffset;
+				}
+				break;
+			}
+		}
+		return vTableOffset;
+	}
+
+	/**
+	 * Record the target of an invokeinterface call site for a receiver class. The first
+	 * receiver class recorded for a call site keeps the first way of the set, so a bimorphic
+	 * call site fills both ways and a megamorphic one only replaces the second.
+	 * @param callSite the resolved constant pool entry of the call site
+	 * @param receiverClass the class of the receiver
+	 * @param vTableOffset the vTable offset of the target
+	 */
+	VMINLINE void
+	interfaceCallSiteCacheUpdate(J9RAMInterfaceMethodRef *callSite, J9Class *receiverClass, UDATA vTableOffset)
+	{
+		J9InterfaceCallSiteCacheEntry *entry = interfaceCallSiteCacheSet(callSite);
+		if (callSite == entry->callSite) {
+			entry += 1;
+		}
+		UDATA sequence = entry->sequence;
+		/* If another thread is updating the entry, leave it to that thread */
+		if (J9_ARE_NO_BITS_SET(sequence, 1)
+			&& (sequence == VM_AtomicSupport::lockCompareExchange(&entry->sequence, sequence, sequence + 1))
+		) {
+			entry->callSite = callSite;
+			entry->receiverClass = receiverClass;
+			entry->vTableOffset = vTableOffset;
+			VM_AtomicSupport::writeBarrier();
+			entry->sequence = sequence + 2;
+		}
+	}
+
 	VMINLINE VM_BytecodeAction
 	invokeinterfaceOffset(REGISTER_ARGS_LIST, UDATA offset)
 	{
@@ -6867,60 +6948,74 @@ resolve:
 			J9Class *receiverClass = J9OBJECT_CLAZZ(_currentThread, receiver);
 			UDATA methodIndex = methodIndexAndArgCount >> J9_ITABLE_INDEX_SHIFT;
 			J9ROMMethod *romMethod = NULL;
+			J9ITable *iTable = NULL;
+
+			/* Check the call site cache, which only holds standard interface methods */
+			if (NULL != _vm->interfaceCallSiteCache) {
+				UDATA vTableOffset = interfaceCallSiteCacheLookup(ramMethodRef, receiverClass);
+				if (0 != vTableOffset) {
+					_currentThread->interfaceCallSiteCacheHits += 1;
+					_sendMethod = *(J9Method**)((UDATA)receiverClass + vTableOffset);
+					goto foundMethod;
+				}
+				_currentThread->interfaceCallSiteCacheMisses += 1;
+			}
 
 			/* Run search in receiverClass->lastITable */
-			J9ITable *iTable = receiverClass->lastITable;
+			iTable = receiverClass->lastITable;
 			if (interfaceClass == iTable->interfaceClass) {
 				goto foundITableCache;
 			}
 
-			/* Start search from receiverClass->iTable */
-			iTable = (J9ITable*)receiverClass->iTable;
-			while (NULL != iTable) {
-				if (interfaceClass == iTable->interfaceClass) {
-					receiverClass->lastITable = iTable;
+			/* Search the iTables of receiverClass */
+			iTable = VM_VMHelpers::findITable(receiverClass, interfaceClass);
+			if (NULL != iTable) {
+				receiverClass->lastITable = iTable;
 foundITableCache:
-					if (J9_UNEXPECTED(J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_TAG_BITS))) {
-						/* Object or private interface method invoke */
-						if (J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_METHOD_INDEX)) {
-							if (J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_OBJECT)) {
-								/* Object method not in the vTable */
-								_sendMethod = J9VMJAVALANGOBJECT_OR_NULL(_vm)->ramMethods + methodIndex;
-							} else {
-								/* Private interface method */
-								_sendMethod = interfaceClass->ramMethods + methodIndex;
-							}
+				if (J9_UNEXPECTED(J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_TAG_BITS))) {
+					/* Object or private interface method invoke */
+					if (J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_METHOD_INDEX)) {
+						if (J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_OBJECT)) {
+							/* Object method not in the vTable */
+							_sendMethod = J9VMJAVALANGOBJECT_OR_NULL(_vm)->ramMethods + methodIndex;
 						} else {
-							/* Object method in the vTable. If methodIndex is
-							 * J9_ITABLE_INDEX_UNRESOLVED_VALUE, the CP entry is unresolved.
-							 * This test is required here because there is no resolve check
-							 * in the main path, so it is possible to get the resolved value
-							 * for interfaceClass, but the unresolved for methodIndexAndArgcCount.
-							 */
-							if (J9_UNEXPECTED(J9_ITABLE_INDEX_UNRESOLVED_VALUE == methodIndex)) {
-								goto retry;
-							}
-							_sendMethod = *(J9Method**)((UDATA)receiverClass + methodIndex);
+							/* Private interface method */
+							_sendMethod = interfaceClass->ramMethods + methodIndex;
 						}
 					} else {
-						/* Standard interface method */
-						_sendMethod = *(J9Method**)((UDATA)receiverClass + ((UDATA*)(iTable + 1))[methodIndex]);
+						/* Object method in the vTable. If methodIndex is
+						 * J9_ITABLE_INDEX_UNRESOLVED_VALUE, the CP entry is unresolved.
+						 * This test is required here because there is no resolve check
+						 * in the main path, so it is possible to get the resolved value
+						 * for interfaceClass, but the unresolved for methodIndexAndArgcCount.
+						 */
+						if (J9_UNEXPECTED(J9_ITABLE_INDEX_UNRESOLVED_VALUE == methodIndex)) {
+							goto retry;
+						}
+						_sendMethod = *(J9Method**)((UDATA)receiverClass + methodIndex);
 					}
-					romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(_sendMethod);
-					if (J9_ARE_NO_BITS_SET(romMethod->modifiers, J9AccPublic | J9AccPrivate)) {
-						/* We need a frame to describe the method arguments (in particular, for the case where we got here directly from the JIT) */
-						buildMethodFrame(REGISTER_ARGS, _sendMethod, jitStackFrameFlags(REGISTER_ARGS, 0));
-						updateVMStruct(REGISTER_ARGS);
-						setIllegalAccessErrorNonPublicInvokeInterface(_currentThread, _sendMethod);
-						VMStructHasBeenUpdated(REGISTER_ARGS);
-						rc = GOTO_THROW_CURRENT_EXCEPTION;
-						goto done;
+				} else {
+					/* Standard interface method */
+					UDATA vTableOffset = ((UDATA*)(iTable + 1))[methodIndex];
+					_sendMethod = *(J9Method**)((UDATA)receiverClass + vTableOffset);
+					if (NULL != _vm->interfaceCallSiteCache) {
+						interfaceCallSiteCacheUpdate(ramMethodRef, receiverClass, vTableOffset);
 					}
-					profileInvokeReceiver(REGISTER_ARGS, receiverClass, _literals, _sendMethod);
-					_pc += offset;
+				}
+foundMethod:
+				romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(_sendMethod);
+				if (J9_ARE_NO_BITS_SET(romMethod->modifiers, J9AccPublic | J9AccPrivate)) {
+					/* We need a frame to describe the method arguments (in particular, for the case where we got here directly from the JIT) */
+					buildMethodFrame(REGISTER_ARGS, _sendMethod, jitStackFrameFlags(REGISTER_ARGS, 0));
+					updateVMStruct(REGISTER_ARGS);
+					setIllegalAccessErrorNonPublicInvokeInterface(_currentThread, _sendMethod);
+					VMStructHasBeenUpdated(REGISTER_ARGS);
+					rc = GOTO_THROW_CURRENT_EXCEPTION;
 					goto done;
 				}
-				iTable = iTable->next;
+				profileInvokeReceiver(REGISTER_ARGS, receiverClass, _literals, _sendMethod);
+				_pc += offset;
+				goto done;
 			}
 			if (!J9RAMINTERFACEMETHODREF_RESOLVED(interfaceClass, methodIndexAndArgCount)) {
 				goto resolve;
@@ -31,10 +31,20 @@
 
 #define J9VM_LAYOUT_STRING_ON_STACK_LIMIT 128
 
+/* Largest number of arguments passed by a direct native callout. This is the number of integer argument registers of the
+ * System V x86-64 ABI; Windows x64 passes only the first 4 in registers and the rest on the stack, which the C call handles.
+ */
+#define J9VM_FFI_DIRECT_CALL_MAX_ARGS 6
+
+#if defined(J9VM_ENV_DATA64) && defined(J9VM_ENV_LITTLE_ENDIAN)
+#define J9VM_FFI_DIRECT_CALL
+#endif /* defined(J9VM_ENV_DATA64) && defined(J9VM_ENV_LITTLE_ENDIAN) */
+
 #ifdef J9VM_OPT_PANAMA
 typedef struct J9NativeCalloutData {
 	ffi_type **arguments;
 	ffi_cif *cif;
+	bool directCall; /* The signature only passes and returns integer class values, so it is called without going through libffi */
 } J9NativeCalloutData;
 #endif /* J9VM_OPT_PANAMA */
 
@@ -100,6 +110,47 @@ public:
 		return typeFFI;
 	}
 
+	/**
+	 * @brief Determine whether a native function can be called directly through a function pointer with
+	 * register width integer arguments, rather than through libffi. Every argument and the return value
+	 * must be an integer or pointer, so that the C call of matching arity passes them exactly as the
+	 * native expects on every 64-bit little endian ABI, in registers or on the stack.
+	 * @param args[in] The ffi_types of the return value, followed by those of the arguments
+	 * @param argCount[in] The number of arguments
+	 * @return true if the function can be called directly, false otherwise
+	 */
+	VMINLINE bool
+	isDirectCallSignature(ffi_type **args, UDATA argCount)
+	{
+		bool directCall = false;
+#if defined(J9VM_FFI_DIRECT_CALL)
+		if (argCount <= J9VM_FFI_DIRECT_CALL_MAX_ARGS) {
+			directCall = (&ffi_type_void == args[0]) || isDirectCallType(args[0]);
+			for (UDATA i = 1; directCall && (i <= argCount); i++) {
+				directCall = isDirectCallType(args[i]);
+			}
+		}
+#endif /* defined(J9VM_FFI_DIRECT_CALL) */
+		return directCall;
+	}
+
+	/**
+	 * @brief Determine whether an argument or return value of the given type is passed in a general purpose register
+	 * @param typeFFI[in] The ffi_type
+	 * @return true for integer and pointer types, false otherwise
+	 */
+	VMINLINE bool
+	isDirectCallType(ffi_type *typeFFI)
+	{
+		return (&ffi_type_uint8 == typeFFI)
+			|| (&ffi_type_sint8 == typeFFI)
+			|| (&ffi_type_uint16 == typeFFI)
+			|| (&ffi_type_sint16 == typeFFI)
+			|| (&ffi_type_sint32 == typeFFI)
+			|| (&ffi_type_sint64 == typeFFI)
+			|| (&ffi_type_pointer == typeFFI);
+	}
+
 	/**
 	 * @brief Create a custom FFI type from a layout string object
 	 * @param typeFFI[in] The custom FFI type to be created
@@ -125,6 +125,12 @@ internalError:
 			J9CLASSLOADER_SET_CLASSLOADEROBJECT(currentThread, classLoaderStruct, classLoaderObject);
 			if (parallelCapable) {
 				classLoaderStruct->flags |= J9CLASSLOADER_PARALLEL_CAPABLE;
+				/* The system loader is already in use, so its table may only be switched under the classTableMutex */
+				if (J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE)) {
+					omrthread_monitor_enter(vm->classTableMutex);
+					hashClassTableSetLockFreeReads(classLoaderStruct);
+					omrthread_monitor_exit(vm->classTableMutex);
+				}
 			}
 			VM_AtomicSupport::writeBarrier();
 			J9VMJAVALANGCLASSLOADER_SET_VMREF(currentThread, classLoaderObject, classLoaderStruct);
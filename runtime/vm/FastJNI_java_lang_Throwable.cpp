@@ -59,6 +59,11 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 				walkFlags |= J9_STACKWALK_HIDE_EXCEPTION_FRAMES;
 				walkState->restartException = receiver;
 			}
+			/* Only record the innermost frames if -XX:MaxJavaStackTraceDepth is in effect */
+			if (0 != vm->maxStackTraceDepth) {
+				walkFlags |= J9_STACKWALK_COUNT_SPECIFIED;
+				walkState->maxFrames = vm->maxStackTraceDepth;
+			}
 			walkState->flags = walkFlags;
 			walkState->skipCount = 1;	// skip the INL frame
 			walkState->walkThread = currentThread;
@@ -73,6 +78,14 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 				setNativeOutOfMemoryError(currentThread, J9NLS_JCL_FAILED_TO_CREATE_STACK_TRACE);
 				goto done;
 			}
+			if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_COMPACT_STACK_TRACES)) {
+				/* An existing array must not end part way through a repeated frame */
+				UDATA maxEntries = UDATA_MAX;
+				if ((NULL != walkback) && (currentThread->privateFlags & J9_PRIVATE_FLAGS_FILL_EXISTING_TRACE)) {
+					maxEntries = J9INDEXABLEOBJECT_SIZE(currentThread, walkback);
+				}
+				framesWalked = compactStackTrace(cachePointer, framesWalked, maxEntries);
+			}
 			/* If there is no stack trace in the exception, or we are not in the out of memory case,
 			 * allocate a new stack trace.  The cached receiver object is invalid after this point.
 			 */
@@ -272,6 +272,24 @@ hashClassTableNew(J9JavaVM *javaVM, U_32 initialSize)
 	return hashTableNew(OMRPORT_FROM_J9PORT(javaVM->portLibrary), J9_GET_CALLSITE(), initialSize, sizeof(KeyHashTableClassEntry), sizeof(char *), flags, J9MEM_CATEGORY_CLASSES, classHashFn, classHashEqualFn, NULL, javaVM);
 }
 
+void
+hashClassTableSetLockFreeReads(J9ClassLoader *classLoader)
+{
+	J9HashTable *table = classLoader->classHashTable;
+
+	if (NULL != table) {
+		table->flags |= J9HASH_TABLE_DO_NOT_GROW;
+	}
+}
+
+BOOLEAN
+hashClassTableHasLockFreeReads(J9ClassLoader *classLoader)
+{
+	J9HashTable *table = classLoader->classHashTable;
+
+	return (NULL != table) && J9_ARE_ALL_BITS_SET(table->flags, J9HASH_TABLE_DO_NOT_GROW);
+}
+
 J9Class *
 hashClassTableAt(J9ClassLoader *classLoader, U_8 *className, UDATA classNameLength)
 {
@@ -328,9 +346,11 @@ static KeyHashTableClassEntry *
 growClassHashTable(J9JavaVM *vm, J9ClassLoader *classLoader, KeyHashTableClassEntry *newEntry)
 {
 	KeyHashTableClassEntry *node = NULL;
-	/* If -XX:+FastClassHashTable is enabled, attempt to allocate a new, larger hash table, otherwise return failure */
-	if (J9_ARE_ALL_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE)) {
-		J9HashTable *oldTable = classLoader->classHashTable;
+	J9HashTable *oldTable = classLoader->classHashTable;
+	/* If the table may be read without locking (-XX:+FastClassHashTable, or a parallel capable loader),
+	 * attempt to allocate a new, larger hash table, otherwise return failure.
+	 */
+	if (J9_ARE_ALL_BITS_SET(oldTable->flags, J9HASH_TABLE_DO_NOT_GROW)) {
 		J9HashTable *newTable = hashTableNew(oldTable->portLibrary, J9_GET_CALLSITE(), oldTable->tableSize + 1, sizeof(KeyHashTableClassEntry), sizeof(char *), J9HASH_TABLE_DO_NOT_GROW | J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION, J9MEM_CATEGORY_CLASSES, classHashFn, classHashEqualFn, NULL, vm);
 		if (NULL != newTable) {
 			J9HashTableState walkState;
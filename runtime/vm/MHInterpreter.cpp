@@ -75,9 +75,11 @@ VM_MHInterpreter::dispatchLoop(j9object_t methodHandle)
 {
 	VM_BytecodeAction nextAction = EXECUTE_BYTECODE;
 	J9Method *method = NULL;
+	UDATA dispatchDepth = 0;
 
 	while(true) {
 		U_32 kind = getMethodHandleKind(methodHandle);
+		dispatchDepth += 1;
 		Assert_VM_mhStackHandleMatch(doesMHandStackMHMatch(methodHandle));
 #if defined(MH_TRACE)
 		printf("#(%p)# dispatchLoop: MH=%p\tkind=%x\t%s\n", _currentThread, methodHandle, kind, names[kind]);
@@ -654,6 +656,7 @@ done:
 #if defined(MH_TRACE)
 	printf("#(%p)# dispatchLoop done - nextAction=%d\n", _currentThread, (I_32)nextAction);
 #endif
+	Trc_VM_mhDispatchLoop_done(_currentThread, (UDATA)nextAction, dispatchDepth, _shuffleReplays);
 	return nextAction;
 }
 
@@ -913,6 +916,16 @@ VM_MHInterpreter::convertArgumentsForAsType(j9object_t methodHandle)
 	UDATA rc = 0;
 	ClassCastExceptionData exceptionData;
 
+	if (J9VMJAVALANGINVOKECONVERTHANDLE_ARGUMENTSUNCHANGED(_currentThread, methodHandle)) {
+		/* Every argument is identical or already assignable, so the stacked arguments
+		 * have the same layout for the next handle. Only the handle slot changes.
+		 */
+		Assert_VM_true(currentArgSlots == nextArgSlots);
+		_shuffleReplays += 1;
+		*(j9object_t*)(_currentThread->sp + currentArgSlots) = nextHandle;
+		return nextHandle;
+	}
+
 	memset(&exceptionData, 0, sizeof(ClassCastExceptionData));
 	currentArgs = _currentThread->sp + currentArgSlots;
 	finalSP = currentArgs - nextArgSlots;
@@ -1694,86 +1707,45 @@ j9object_t
 VM_MHInterpreter::permuteForPermuteHandle(j9object_t methodHandle)
 {
 	j9object_t currentType = J9VMJAVALANGINVOKEMETHODHANDLE_TYPE(_currentThread, methodHandle);
-	j9object_t currentTypeArguments = J9VMJAVALANGINVOKEMETHODTYPE_ARGUMENTS(_currentThread, currentType);
-	U_32 currentTypeArgumentsLength = J9INDEXABLEOBJECT_SIZE(_currentThread, currentTypeArguments);
 	U_32 currentArgSlots = (U_32)J9VMJAVALANGINVOKEMETHODTYPE_ARGSLOTS(_currentThread, currentType);
 	j9object_t nextHandle = J9VMJAVALANGINVOKEPERMUTEHANDLE_NEXT(_currentThread, methodHandle);
 	j9object_t nextType = J9VMJAVALANGINVOKEMETHODHANDLE_TYPE(_currentThread, nextHandle);
 	U_32 nextArgSlots = (U_32)J9VMJAVALANGINVOKEMETHODTYPE_ARGSLOTS(_currentThread, nextType);
-	j9object_t permuteArray = J9VMJAVALANGINVOKEPERMUTEHANDLE_PERMUTE(_currentThread, methodHandle);
-	U_32 permuteArrayLength = J9INDEXABLEOBJECT_SIZE(_currentThread, permuteArray);
-	J9JavaVM *vm = _currentThread->javaVM;
-	J9Class * doubleReflectClass = vm->doubleReflectClass;
-	J9Class * longReflectClass = vm->longReflectClass;
+	/* Source stack slot of each permuted argument, computed when the handle was created */
+	j9object_t slotPermuteArray = J9VMJAVALANGINVOKEPERMUTEHANDLE_SLOTPERMUTE(_currentThread, methodHandle);
+	U_32 slotPermuteArrayLength = J9INDEXABLEOBJECT_SIZE(_currentThread, slotPermuteArray);
 	UDATA *newArgsPtr = _currentThread->sp;
 	/* Points at the FIRST argument on the stack. Zero argument cases are not permutable */
 	UDATA *argsPtr = _currentThread->sp + currentArgSlots - 1;
-	/* Maximum number of stack slots is 255 */
-	U_8 slotIndexArray[255];
 	U_32 i = 0;
-	U_8 slotIndex = 0;
 
 	/* overwrite original handle with next */
 	*(j9object_t*)(_currentThread->sp + currentArgSlots) = nextHandle;
 
 
 	/* If we're dropping everything, do the fast case */
-	if (0 == permuteArrayLength) {
+	if (0 == slotPermuteArrayLength) {
 		_currentThread->sp = _currentThread->sp + currentArgSlots;
 		return *(j9object_t*)_currentThread->sp;
 	}
 
-
-
-	/* Generate an array similar to the permute array, except that
-	 * it's contents contain the source STACK SLOT.  We grab each argument
-	 * off the stack, figure out it's type and from that can tell how many stack
-	 * slots that is. We then look inside the permute array and replace all references
-	 * to the current argument with the stack slot index
-	 */
-	for (i = 0; i < currentTypeArgumentsLength; i++) {
-		J9Class *sourceClass = J9VM_J9CLASS_FROM_HEAPCLASS(_currentThread, J9JAVAARRAYOFOBJECT_LOAD(_currentThread, currentTypeArguments, i));
-		U_32 j = 0;
-
-		if ((sourceClass == doubleReflectClass) || (sourceClass == longReflectClass)) {
-			slotIndex += 1;
-		}
-
-		/* Replace all indexes to the current argument with the calculated stack slot index */
-		for (j = 0; j < permuteArrayLength; j++) {
-			U_32 permuteValue = (U_32)J9JAVAARRAYOFINT_LOAD(_currentThread, permuteArray, j);
-
-			if (permuteValue == i) {
-				slotIndexArray[j] = slotIndex;
-			}
-		}
-		slotIndex++;
-	}
+	_shuffleReplays += 1;
 
 	/* Actually do the copy - values are copied in the correct order below the stack */
-	for (i = 0; i < permuteArrayLength; i++) {
-		/* Get the slot index for this parameter */
-		IDATA sourceSlotIndex = slotIndexArray[i];
+	for (i = 0; i < slotPermuteArrayLength; i++) {
+		/* Each entry is the source slot index shifted left by one, with the low bit set for two slot types */
+		U_32 slotPermuteValue = (U_32)J9JAVAARRAYOFINT_LOAD(_currentThread, slotPermuteArray, i);
+		IDATA sourceSlotIndex = (IDATA)(slotPermuteValue >> 1);
 		UDATA *sourceAddress = &argsPtr[-sourceSlotIndex];
-		UDATA typeSize = 1;
-		U_32 sourceArgument = (U_32)J9JAVAARRAYOFINT_LOAD(_currentThread, permuteArray, i);
-		/* Determine the size of the argument */
-		J9Class *sourceClass = J9VM_J9CLASS_FROM_HEAPCLASS(_currentThread, J9JAVAARRAYOFOBJECT_LOAD(_currentThread, currentTypeArguments, sourceArgument));
 
-		/* Long and doubles always use two stack slots */
-		if ((sourceClass == doubleReflectClass) || (sourceClass == longReflectClass)) {
-			typeSize = 2;
-		}
-
-		/* Move the destination pointer to where the argument will end up */
-		newArgsPtr -= typeSize;
-
-		/* Copy the argument */
-		*newArgsPtr = *sourceAddress;
-
-		/* doubles and longs take up two slots, copy the other half */
-		if (2 == typeSize) {
+		if (J9_ARE_ANY_BITS_SET(slotPermuteValue, 1)) {
+			/* doubles and longs take up two slots */
+			newArgsPtr -= 2;
+			*newArgsPtr = *sourceAddress;
 			*(newArgsPtr+1) = *(sourceAddress+1);
+		} else {
+			newArgsPtr -= 1;
+			*newArgsPtr = *sourceAddress;
 		}
 	}
 
@@ -2497,6 +2469,37 @@ VM_MHInterpreter::nativeMethodHandleCallout(void *function, UDATA *javaArgs, U_8
 
 	*returnType = getJ9NativeTypeCode(returnTypeClass);
 
+#if defined(J9VM_FFI_DIRECT_CALL)
+	if (nativeCalloutData->directCall) {
+		UDATA callArgs[J9VM_FFI_DIRECT_CALL_MAX_ARGS];
+		IDATA offset = 0;
+		for (U_32 i = 0; i < argTypeCount; i++) {
+			ffi_type *argType = args[i+1];
+			if (&ffi_type_sint64 == argType) {
+				offset -= 1;
+			}
+			UDATA slot = javaArgs[offset];
+			if (&ffi_type_sint32 == argType) {
+				slot = (UDATA)(IDATA)(I_32)slot;
+			} else if (&ffi_type_sint16 == argType) {
+				slot = (UDATA)(IDATA)(I_16)slot;
+			} else if (&ffi_type_uint16 == argType) {
+				slot = (UDATA)(U_16)slot;
+			} else if (&ffi_type_sint8 == argType) {
+				slot = (UDATA)(IDATA)(I_8)slot;
+			} else if (&ffi_type_uint8 == argType) {
+				slot = (UDATA)(U_8)slot;
+			}
+			callArgs[i] = slot;
+			offset -= 1;
+		}
+		VM_VMAccess::inlineExitVMToJNI(_currentThread);
+		*(UDATA *)returnStorage = directNativeCallout(function, callArgs, argTypeCount);
+		VM_VMAccess::inlineEnterVMFromJNI(_currentThread);
+		return ffiSuccess;
+	}
+#endif /* defined(J9VM_FFI_DIRECT_CALL) */
+
 	PORT_ACCESS_FROM_JAVAVM(_vm);
 	
 	if (isMinimal) {
@@ -2588,4 +2591,48 @@ ffi_exit:
 	}
 	return ret;
 }
+
+#if defined(J9VM_FFI_DIRECT_CALL)
+VMINLINE UDATA
+VM_MHInterpreter::directNativeCallout(void *function, UDATA *callArgs, U_32 argCount)
+{
+	typedef UDATA (*DirectCall0)(void);
+	typedef UDATA (*DirectCall1)(UDATA);
+	typedef UDATA (*DirectCall2)(UDATA, UDATA);
+	typedef UDATA (*DirectCall3)(UDATA, UDATA, UDATA);
+	typedef UDATA (*DirectCall4)(UDATA, UDATA, UDATA, UDATA);
+	typedef UDATA (*DirectCall5)(UDATA, UDATA, UDATA, UDATA, UDATA);
+	typedef UDATA (*DirectCall6)(UDATA, UDATA, UDATA, UDATA, UDATA, UDATA);
+	UDATA result = 0;
+
+	/* A void function leaves the return register undefined, which is harmless as the value is discarded */
+	switch (argCount) {
+	case 0:
+		result = ((DirectCall0)function)();
+		break;
+	case 1:
+		result = ((DirectCall1)function)(callArgs[0]);
+		break;
+	case 2:
+		result = ((DirectCall2)function)(callArgs[0], callArgs[1]);
+		break;
+	case 3:
+		result = ((DirectCall3)function)(callArgs[0], callArgs[1], callArgs[2]);
+		break;
+	case 4:
+		result = ((DirectCall4)function)(callArgs[0], callArgs[1], callArgs[2], callArgs[3]);
+		break;
+	case 5:
+		result = ((DirectCall5)function)(callArgs[0], callArgs[1], callArgs[2], callArgs[3], callArgs[4]);
+		break;
+	case 6:
+		result = ((DirectCall6)function)(callArgs[0], callArgs[1], callArgs[2], callArgs[3], callArgs[4], callArgs[5]);
+		break;
+	default:
+		Assert_VM_unreachable();
+		break;
+	}
+	return result;
+}
+#endif /* defined(J9VM_FFI_DIRECT_CALL) */
 #endif /* J9VM_OPT_PANAMA */
@@ -58,6 +58,7 @@ private:
 	J9JavaVM *const _vm;
 	MM_ObjectAllocationAPI *const _objectAllocate;
 	MM_ObjectAccessBarrierAPI *const _objectAccessBarrier;
+	UDATA _shuffleReplays; /**< handles whose precomputed argument shuffle was replayed by this dispatch */
 
 protected:
 
@@ -280,15 +281,11 @@ private:
 		if (interfaceClass == iTable->interfaceClass) {
 			goto foundITable;
 		}
-		iTable = (J9ITable*)receiverClass->iTable;
-		while (NULL != iTable) {
-			if (interfaceClass == iTable->interfaceClass) {
-				receiverClass->lastITable = iTable;
+		iTable = VM_VMHelpers::findITable(receiverClass, interfaceClass);
+		if (NULL != iTable) {
+			receiverClass->lastITable = iTable;
 foundITable:
-				sendMethod = *(J9Method**)((UDATA)receiverClass + ((UDATA*)(iTable + 1))[iTableIndex]);
-				break;
-			}
-			iTable = iTable->next;
+			sendMethod = *(J9Method**)((UDATA)receiverClass + ((UDATA*)(iTable + 1))[iTableIndex]);
 		}
 		return sendMethod;
 	}
@@ -478,6 +475,8 @@ foundITable:
 	/**
 	* @brief
 	* Perform argument conversion for AsTypeHandle.
+	* When the handle was marked argumentsUnchanged at construction, the stacked
+	* arguments are reused without examining their types.
 	* @param methodHandle
 	* @return j9object_t The target MethodHandle (the one to execute next)
 	*/
@@ -562,6 +561,8 @@ foundITable:
 	* @brief
 	* Perform argument permuting for PermuteHandle.
 	* This assumes no argument conversions are required by the PermuteHandle.
+	* The slot moves are replayed from the slotPermute array computed when the
+	* handle was created.
 	* @param methodHandle
 	* @return j9object_t The target MethodHandle (the one to execute next)
 	*/
@@ -633,6 +634,19 @@ foundITable:
 
 	VMINLINE FFI_Return
 	nativeMethodHandleCallout(void *function, UDATA *javaArgs, U_8 *returnType, j9object_t methodHandle, void *returnStorage, UDATA *structSize);
+
+#if defined(J9VM_FFI_DIRECT_CALL)
+	/**
+	 * @brief Call a native function whose signature only contains integer class values by casting it to a
+	 * function taking register width arguments, avoiding the libffi argument marshalling.
+	 * @param function[in] The native function
+	 * @param callArgs[in] The arguments, sign or zero extended to register width as the ABIs require of the caller
+	 * @param argCount[in] The number of arguments, at most J9VM_FFI_DIRECT_CALL_MAX_ARGS
+	 * @return The register width return value of the function
+	 */
+	VMINLINE UDATA
+	directNativeCallout(void *function, UDATA *callArgs, U_32 argCount);
+#endif /* defined(J9VM_FFI_DIRECT_CALL) */
 #endif /* J9VM_OPT_PANAMA */
 
 #if defined(ENABLE_DEBUG_FUNCTIONS)
@@ -678,6 +692,7 @@ public:
 			, _vm(_currentThread->javaVM)
 			, _objectAllocate(objectAllocate)
 			, _objectAccessBarrier(objectAccessBarrier)
+			, _shuffleReplays(0)
 	{ };
 };
 
@@ -140,6 +140,7 @@ OutOfLineINL_java_lang_invoke_NativeMethodHandle_initJ9NativeCalloutDataRef(J9VM
 	}
 	nativeCalloutData->arguments = args;
 	nativeCalloutData->cif = cif;
+	nativeCalloutData->directCall = FFIHelpers.isDirectCallSignature(args, typeCount-1);
 
 	J9VMJAVALANGINVOKENATIVEMETHODHANDLE_SET_J9NATIVECALLOUTDATAREF(currentThread, methodHandle, (void *)nativeCalloutData);
 
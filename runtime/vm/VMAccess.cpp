@@ -138,6 +138,7 @@ acquireExclusiveVMAccess(J9VMThread * vmThread)
 	 * the thread already has exclusive access
 	 */
 	if ( ++(vmThread->omrVMThread->exclusiveCount) == 1 ) {
+		VM_AtomicSupport::add(&vm->exclusiveVMAccessRequestCount, 1);
 		omrthread_monitor_enter(vmThread->publicFlagsMutex);
 		VM_VMAccess::setPublicFlags(vmThread, J9_PUBLIC_FLAGS_NOT_AT_SAFE_POINT);
 		omrthread_monitor_enter(vm->exclusiveAccessMutex);
@@ -559,32 +560,32 @@ void releaseExclusiveVMAccess(J9VMThread * vmThread)
 			J9VMThread *currentThread = vmThread;
 			/* Queue is empty, so wake up all previously halted threads and notify the exclusiveAccessMutex */
 
-			/* If using the fast class hash table, now is a good time to free the old tables */
-			if (J9_ARE_ALL_BITS_SET(vmThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE)) {
-				if ((NULL != vm->classLoaderBlocks) && (TRUE == vm->freePreviousClassLoaders)) {
-					pool_state clState;
-					J9ClassLoader *loader;
-
-					omrthread_monitor_enter(vm->classLoaderBlocksMutex);
-					loader = (J9ClassLoader*)pool_startDo(vm->classLoaderBlocks, &clState);
-					while (loader != NULL) {
-						J9HashTable *initial = loader->classHashTable;
-						/* The GC may free the hash table but not the loader */
-						if (NULL != initial) {
-							J9HashTable *previous = initial->previous;
-							while (NULL != previous) {
-								Trc_VM_VMAccess_FreeingPreviousHashtable(currentThread, previous);
-								J9HashTable *temp = previous->previous;
-								hashTableFree(previous);
-								previous = temp;
-							}
-							initial->previous = NULL;
+			/* If any class hash table has been replaced by a larger copy (see -XX:+FastClassHashTable and
+			 * parallel capable class loaders), now is a good time to free the old tables.
+			 */
+			if ((NULL != vm->classLoaderBlocks) && (TRUE == vm->freePreviousClassLoaders)) {
+				pool_state clState;
+				J9ClassLoader *loader;
+
+				omrthread_monitor_enter(vm->classLoaderBlocksMutex);
+				loader = (J9ClassLoader*)pool_startDo(vm->classLoaderBlocks, &clState);
+				while (loader != NULL) {
+					J9HashTable *initial = loader->classHashTable;
+					/* The GC may free the hash table but not the loader */
+					if (NULL != initial) {
+						J9HashTable *previous = initial->previous;
+						while (NULL != previous) {
+							Trc_VM_VMAccess_FreeingPreviousHashtable(currentThread, previous);
+							J9HashTable *temp = previous->previous;
+							hashTableFree(previous);
+							previous = temp;
 						}
-						loader = (J9ClassLoader*)pool_nextDo(&clState);
+						initial->previous = NULL;
 					}
-					vm->freePreviousClassLoaders = FALSE;
-					omrthread_monitor_exit(vm->classLoaderBlocksMutex);
+					loader = (J9ClassLoader*)pool_nextDo(&clState);
 				}
+				vm->freePreviousClassLoaders = FALSE;
+				omrthread_monitor_exit(vm->classLoaderBlocksMutex);
 			}
 
 			/* omrthread_monitor_enter(vm->vmThreadListMutex); current thread already holds vmThreadListMutex */
@@ -733,6 +734,7 @@ acquireExclusiveVMAccessFromExternalThread(J9JavaVM * vm)
 	UDATA vmResponsesExpected = 0;
 	UDATA jniResponsesExpected = 0;
 
+	VM_AtomicSupport::add(&vm->exclusiveVMAccessRequestCount, 1);
 	synchronizeRequestsFromExternalThread(vm, TRUE);
 
 	/* Post the halt request to all threads */
@@ -1230,6 +1232,9 @@ releaseSafePointVMAccess(J9VMThread * vmThread)
 void
 haltThreadForInspection(J9VMThread * currentThread, J9VMThread * vmThread)
 {
+	if (currentThread != vmThread) {
+		VM_AtomicSupport::add(&currentThread->javaVM->inspectionHaltCount, 1);
+	}
 
 _tryAgain:
 
@@ -1286,6 +1291,38 @@ _tryAgain:
 	Assert_VM_mustHaveVMAccess(currentThread);
 }
 
+/**
+ * Run an operation which needs only one other thread to be stopped, such as walking its stack.
+ *
+ * targetThread is halted for inspection, the function is run by the current thread on its behalf
+ * while it is unable to acquire VM access, and targetThread is then resumed. Unlike exclusive VM
+ * access, no other thread is asked to stop. The function runs with VM access held, and must obey
+ * the restrictions on currentThread documented for haltThreadForInspection.
+ *
+ * Note that VM access may be released and reacquired by this call - direct object pointers must not
+ * be held across this call.
+ *
+ * @param[in] currentThread the current J9VMThread, which must have VM access
+ * @param[in] targetThread the thread to stop; may be currentThread
+ * @param[in] function the operation to perform
+ * @param[in] userData passed through to function
+ *
+ * @return the value returned by function
+ */
+UDATA
+handshakeThread(J9VMThread *currentThread, J9VMThread *targetThread, UDATA (*function)(J9VMThread *currentThread, J9VMThread *targetThread, void *userData), void *userData)
+{
+	UDATA result = 0;
+
+	Assert_VM_mustHaveVMAccess(currentThread);
+
+	haltThreadForInspection(currentThread, targetThread);
+	result = function(currentThread, targetThread, userData);
+	resumeThreadForInspection(currentThread, targetThread);
+
+	return result;
+}
+
 /* Note that VM access is released and reacquired by this call - direct object pointers must not be held across this call */
 
 void
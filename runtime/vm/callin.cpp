@@ -239,15 +239,11 @@ mapVirtualMethod(J9VMThread *currentThread, J9Method *method, UDATA vTableOffset
 		if (interfaceClass == iTable->interfaceClass) {
 			goto foundITable;
 		}
-		iTable = (J9ITable*)receiverClass->iTable;
-		while (NULL != iTable) {
-			if (interfaceClass == iTable->interfaceClass) {
-				receiverClass->lastITable = iTable;
+		iTable = VM_VMHelpers::findITable(receiverClass, interfaceClass);
+		if (NULL != iTable) {
+			receiverClass->lastITable = iTable;
 foundITable:
-				vTableOffset = ((UDATA*)(iTable + 1))[iTableIndex];
-				break;
-			}
-			iTable = iTable->next;
+			vTableOffset = ((UDATA*)(iTable + 1))[iTableIndex];
 		}
 	}
 	if (0 != vTableOffset) {
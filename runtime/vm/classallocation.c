@@ -142,6 +142,12 @@ retry:
 
 	if (J9VMJAVALANGCLASSLOADER_ISPARALLELCAPABLE(vmThread, classLoaderObject)) {
 		classLoader->flags |= J9CLASSLOADER_PARALLEL_CAPABLE;
+		/* Parallel capable loaders look up classes from many threads at once, so let them do so
+		 * without the classTableMutex from the start, rather than only once startup is complete.
+		 */
+		if (J9_ARE_NO_BITS_SET(javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE)) {
+			hashClassTableSetLockFreeReads(classLoader);
+		}
 	}
 	J9CLASSLOADER_SET_CLASSLOADEROBJECT(vmThread, classLoader, classLoaderObject);
 
@@ -242,9 +242,10 @@ internalFindClassString(J9VMThread* currentThread, j9object_t moduleName, j9obje
 {
 	J9Class *result = NULL;
 	J9JavaVM* vm = currentThread->javaVM;
-	BOOLEAN fastMode = J9_ARE_ALL_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE);
+	BOOLEAN fastMode = J9_ARE_ALL_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE)
+			|| hashClassTableHasLockFreeReads(classLoader);
 
-	/* If -XX:+FastClassHashTable is enabled, do not lock anything to do the initial table peek */
+	/* If -XX:+FastClassHashTable is enabled, or the table is otherwise never grown in place, do not lock anything to do the initial table peek */
 	if (!fastMode) {
 		omrthread_monitor_enter(vm->classTableMutex);
 	}
@@ -578,7 +579,7 @@ attemptDynamicClassLoad(J9VMThread* vmThread, J9Module *j9module, U_8* className
 
 					/* this function exits the class table mutex */
 					foundClass = dynamicLoadBuffers->internalDefineClassFunction(vmThread, className, classNameLength,
-						dynamicLoadBuffers->sunClassFileBuffer, dynamicLoadBuffers->currentSunClassFileSize,
+						dynamicLoadBuffers->currentSunClassFileData, dynamicLoadBuffers->currentSunClassFileSize,
 						NULL, classLoader, NULL, defineClassOptions, NULL, NULL, &localBuffer); /* this function exits the class table mutex */
 				}
 			} else {
@@ -689,6 +690,15 @@ callLoadClass(J9VMThread* vmThread, U_8* className, UDATA classNameLength, J9Cla
  			Trc_VM_internalFindClass_sentLoadClass(vmThread, classNameLength, className, sendLoadClassResult);
  			Assert_VM_true(J9VM_IS_INITIALIZED_HEAPCLASS(vmThread, sendLoadClassResult));
 			foundClass = J9VM_J9CLASS_FROM_HEAPCLASS(vmThread, sendLoadClassResult);
+			/* When the loader defined the class itself, the table already maps the name to it. For a table
+			 * which may be read without locking, that can be seen without entering the classTableMutex, so
+			 * threads of a parallel capable loader do not serialize here after each load.
+			 */
+			if (hashClassTableHasLockFreeReads(classLoader)
+				&& (foundClass == hashClassTableAt(classLoader, className, classNameLength))
+			) {
+				return foundClass;
+			}
 			omrthread_monitor_enter(vmThread->javaVM->classTableMutex);
 			/* Verify that the actual name matches the expected */
 			foundClassName = J9ROMCLASS_CLASSNAME(foundClass->romClass);
@@ -919,7 +929,8 @@ loadNonArrayClass(J9VMThread* vmThread, J9Module *j9module, U_8* className, UDAT
 {
 	J9Class * foundClass = NULL;
 	BOOLEAN lockLoaderMonitor = FALSE;
-	BOOLEAN fastMode = J9_ARE_ALL_BITS_SET(vmThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE);
+	BOOLEAN fastMode = J9_ARE_ALL_BITS_SET(vmThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE)
+			|| hashClassTableHasLockFreeReads(classLoader);
 	BOOLEAN loaderMonitorLocked = FALSE;
 
 	vmThread->privateFlags &= ~J9_PRIVATE_FLAGS_CLOAD_NO_MEM;
@@ -60,6 +60,7 @@ enum J9ClassFragments {
 	RAM_SUPERCLASSES_FRAGMENT,
 	RAM_INSTANCE_DESCRIPTION_FRAGMENT,
 	RAM_ITABLE_FRAGMENT,
+	RAM_ITABLE_INDEX_FRAGMENT,
 	RAM_STATICS_FRAGMENT,
 	RAM_CONSTANT_POOL_FRAGMENT,
 	RAM_CALL_SITES_FRAGMENT,
@@ -139,6 +140,7 @@ static J9Class* markInterfaces(J9ROMClass *romClass, J9Class *superclass, J9Clas
 static void unmarkInterfaces(J9Class *interfaceHead);
 static void createITable(J9VMThread* vmStruct, J9Class *ramClass, J9Class *interfaceClass, J9ITable ***previousLink, UDATA **currentSlot, UDATA depth);
 static UDATA* initializeRAMClassITable(J9VMThread* vmStruct, J9Class *ramClass, J9Class *superclass, UDATA* currentSlot, J9Class *interfaceHead, IDATA maxInterfaceDepth);
+static void initializeRAMClassITableIndex(J9Class *ramClass, J9ITableIndex *iTableIndex, UDATA slotCount);
 static UDATA addInterfaceMethods(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *interfaceClass, UDATA vTableMethodCount, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, UDATA *defaultConflictCount, J9Pool *equivalentSets, UDATA *equivSetCount, J9OverrideErrorData *errorData);
 static UDATA* computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *superclass, J9ROMClass *taggedClass, UDATA packageID, J9ROMMethod ** methodRemapArray, J9Class *interfaceHead, UDATA *defaultConflictCount, UDATA interfaceCount, UDATA inheritedInterfaceCount, J9OverrideErrorData *errorData);
 static void copyVTable(J9VMThread *vmStruct, J9Class *ramClass, J9Class *superclass, UDATA *vTable, UDATA defaultConflictCount);
@@ -388,6 +390,7 @@ initializeRAMClassITable (J9VMThread* vmStruct, J9Class *ramClass, J9Class *supe
 	booleanArrayClass = vmStruct->javaVM->booleanArrayClass;
 	if (J9ROMCLASS_IS_ARRAY(romClass) && (booleanArrayClass != NULL)) {
 		ramClass->iTable = booleanArrayClass->iTable;
+		ramClass->iTableIndex = booleanArrayClass->iTableIndex;
 		if ((J9CLASS_FLAGS(booleanArrayClass) & J9AccClassCloneable) == J9AccClassCloneable) {
 			ramClass->classDepthAndFlags |= J9AccClassCloneable;
 		}
@@ -420,6 +423,34 @@ initializeRAMClassITable (J9VMThread* vmStruct, J9Class *ramClass, J9Class *supe
 	return currentSlot;
 }
 
+/**
+ * Hash every iTable of the class, including those shared with the superclass,
+ * by interface class so that an interface send need not walk the iTable list.
+ * Collisions are resolved by linear probing. The storage must be zeroed.
+ *
+ * @param[in] ramClass the class whose iTables have been initialized
+ * @param[in] iTableIndex the storage for the index
+ * @param[in] slotCount the number of slots in the index, a power of two larger than the iTable count
+ */
+static void
+initializeRAMClassITableIndex(J9Class *ramClass, J9ITableIndex *iTableIndex, UDATA slotCount)
+{
+	J9ITable **slots = J9ITABLEINDEX_SLOTS(iTableIndex);
+	UDATA mask = slotCount - 1;
+	J9ITable *iTable = (J9ITable *)ramClass->iTable;
+
+	while (NULL != iTable) {
+		UDATA slot = J9ITABLEINDEX_HASH(iTable->interfaceClass) & mask;
+		while (NULL != slots[slot]) {
+			slot = (slot + 1) & mask;
+		}
+		slots[slot] = iTable;
+		iTable = iTable->next;
+	}
+	iTableIndex->mask = mask;
+	ramClass->iTableIndex = iTableIndex;
+}
+
 /* Helper function to compare two name and sigs.
  * It compares the lengths of both name and sig first before doing any memcmp.
  *
@@ -2060,6 +2091,8 @@ internalCreateRAMClassFromROMClassImpl(J9VMThread *vmThread, J9ClassLoader *clas
 	UDATA *instanceDescription = NULL;
 	UDATA instanceDescriptionSlotCount = 0;
 	UDATA iTableSlotCount = 0;
+	UDATA *iTableIndex = NULL;
+	UDATA iTableIndexSlotCount = 0;
 	IDATA maxInterfaceDepth = -1;
 	UDATA inheritedInterfaceCount = 0;
 	UDATA defaultConflictCount = 0;
@@ -2260,6 +2293,21 @@ fail:
 				}
 			}
 			classSize += iTableSlotCount;
+
+			/* Classes which implement many interfaces get an index of their iTables. Interface
+			 * classes are never receivers of an interface send, so they do not need one.
+			 */
+			if ((0 != javaVM->iTableIndexThreshold)
+				&& ((romClass->modifiers & J9AccInterface) != J9AccInterface)
+				&& ((interfaceCount + inheritedInterfaceCount) >= javaVM->iTableIndexThreshold)
+			) {
+				/* Keep the load factor at or below one half */
+				iTableIndexSlotCount = 2;
+				while (iTableIndexSlotCount < (2 * (interfaceCount + inheritedInterfaceCount))) {
+					iTableIndexSlotCount <<= 1;
+				}
+				classSize += (sizeof(J9ITableIndex) / sizeof(UDATA)) + iTableIndexSlotCount;
+			}
 		}
 		
 		/* Convert count to bytes and round to required alignment */
@@ -2361,6 +2409,15 @@ fail:
 			allocationRequests[RAM_ITABLE_FRAGMENT].alignedSize = iTableSlotCount * sizeof(UDATA);
 			allocationRequests[RAM_ITABLE_FRAGMENT].address = NULL;
 
+			/* iTable index fragment */
+			allocationRequests[RAM_ITABLE_INDEX_FRAGMENT].prefixSize = 0;
+			allocationRequests[RAM_ITABLE_INDEX_FRAGMENT].alignment = sizeof(UDATA);
+			allocationRequests[RAM_ITABLE_INDEX_FRAGMENT].alignedSize = 0;
+			if (0 != iTableIndexSlotCount) {
+				allocationRequests[RAM_ITABLE_INDEX_FRAGMENT].alignedSize = sizeof(J9ITableIndex) + (iTableIndexSlotCount * sizeof(J9ITable *));
+			}
+			allocationRequests[RAM_ITABLE_INDEX_FRAGMENT].address = NULL;
+
 			/* static slots fragment */
 			allocationRequests[RAM_STATICS_FRAGMENT].prefixSize = 0;
 			allocationRequests[RAM_STATICS_FRAGMENT].alignment = sizeof(U_64);
@@ -2441,6 +2498,7 @@ fail:
 				if (fastHCR) {
 					/* Share iTable and instanceDescription (and associated fields) with class being redefined. */
 					ramClass->iTable = classBeingRedefined->iTable;
+					ramClass->iTableIndex = classBeingRedefined->iTableIndex;
 					ramClass->instanceDescription = classBeingRedefined->instanceDescription;
 #if defined(J9VM_GC_LEAF_BITS)
 					ramClass->instanceLeafDescription = classBeingRedefined->instanceLeafDescription;
@@ -2452,6 +2510,7 @@ fail:
 				} else {
 					instanceDescription = allocationRequests[RAM_INSTANCE_DESCRIPTION_FRAGMENT].address;
 					iTable = allocationRequests[RAM_ITABLE_FRAGMENT].address;
+					iTableIndex = allocationRequests[RAM_ITABLE_INDEX_FRAGMENT].address;
 				}
 				ramClass->superclasses = (J9Class **) allocationRequests[RAM_SUPERCLASSES_FRAGMENT].address;
 				ramClass->ramStatics = allocationRequests[RAM_STATICS_FRAGMENT].address;
@@ -2708,6 +2767,10 @@ fail:
 			if (!fastHCR) {
 				/* calculate the instanceDescription field */
 				calculateInstanceDescription(vmThread, ramClass, superclass, instanceDescription, &romWalkState, romWalkResult);
+
+				if (J9_ARE_ANY_BITS_SET(javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_VALIDATE_FIELD_LAYOUT_HINTS)) {
+					validateFieldLayoutHints(vmThread, ramClass);
+				}
 			}
 
 			/* fill in the classLoader slot */
@@ -2738,6 +2801,9 @@ fail:
 			if (!fastHCR) {
 				/* Fill in the itable. This will unmark the linked interfaces. */
 				initializeRAMClassITable(vmThread, ramClass, superclass, iTable, interfaceHead, maxInterfaceDepth);
+				if (0 != iTableIndexSlotCount) {
+					initializeRAMClassITableIndex(ramClass, (J9ITableIndex *)iTableIndex, iTableIndexSlotCount);
+				}
 			}
 			/* Ensure that lastITable is never NULL */
 			ramClass->lastITable = (J9ITable *) ramClass->iTable;
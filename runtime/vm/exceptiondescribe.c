@@ -231,6 +231,48 @@ printStackTraceEntry(J9VMThread * vmThread, void * voidUserData, J9ROMClass *rom
 }
 
 
+/*
+ * Collapses runs of identical PCs in the cache of a stack walk, as produced by directly recursive
+ * methods, into the PC followed by J9_STACK_TRACE_REPEAT_TAG and the number of times it repeats.
+ * Runs too short to benefit are left as they are. iterateStackTrace expands the repeated frames.
+ *
+ * At most maxCount entries are kept, for a stack trace stored into an existing array. The trace
+ * is only cut between frames, never inside a PC, tag and count triple.
+ *
+ * @param cache The PCs cached by the stack walk, compacted in place.
+ * @param count The number of PCs in cache.
+ * @param maxCount The maximum number of entries to keep.
+ * @return The number of entries remaining in cache.
+ */
+UDATA
+compactStackTrace(UDATA *cache, UDATA count, UDATA maxCount)
+{
+	UDATA readIndex = 0;
+	UDATA writeIndex = 0;
+
+	while ((readIndex < count) && (writeIndex < maxCount)) {
+		UDATA pc = cache[readIndex];
+		UDATA runLength = 1;
+
+		while (((readIndex + runLength) < count) && (pc == cache[readIndex + runLength])) {
+			runLength += 1;
+		}
+		if ((runLength > 3) && ((maxCount - writeIndex) >= 3)) {
+			cache[writeIndex++] = pc;
+			cache[writeIndex++] = J9_STACK_TRACE_REPEAT_TAG;
+			cache[writeIndex++] = runLength - 1;
+		} else {
+			/* Short runs, and runs which no longer fit as a triple, are stored frame by frame */
+			UDATA i = 0;
+			for (i = 0; (i < runLength) && (writeIndex < maxCount); ++i) {
+				cache[writeIndex++] = pc;
+			}
+		}
+		readIndex += runLength;
+	}
+	return writeIndex;
+}
+
 /* 
  * Walks the backtrace of an exception instance, invoking a user-supplied callback function for
  * each frame on the call stack.
@@ -242,6 +284,8 @@ printStackTraceEntry(J9VMThread * vmThread, void * voidUserData, J9ROMClass *rom
  * @param pruneConstructors Non-zero if constructors should be pruned from the stack trace.
  * @return The number of times the callback function was invoked.
  *
+ * @note Frames collapsed by compactStackTrace are expanded, so callers always see the full trace.
+ *
  * @note Assumes VM access
  **/
 UDATA
@@ -259,6 +303,8 @@ iterateStackTrace(J9VMThread * vmThread, j9object_t* exception, callback_func_t
 		U_32 arraySize = J9INDEXABLEOBJECT_SIZE(vmThread, walkback);
 		U_32 currentElement = 0;
 		UDATA callbackResult = TRUE;
+		UDATA repeatPC = 0;
+		UDATA repeatCount = 0;
 
 #ifndef J9VM_INTERP_NATIVE_SUPPORT
 		pruneConstructors = FALSE;
@@ -272,9 +318,8 @@ iterateStackTrace(J9VMThread * vmThread, j9object_t* exception, callback_func_t
 
 		/* Loop over the stack trace */
 
-		while (currentElement != arraySize) {
-			/* write as for or move currentElement++ to very end */ 
-			UDATA methodPC = J9JAVAARRAYOFUDATA_LOAD(vmThread, J9VMJAVALANGTHROWABLE_WALKBACK(vmThread, (*exception)), currentElement);
+		while ((currentElement != arraySize) || (0 != repeatCount)) {
+			UDATA methodPC = 0;
 			J9ROMMethod * romMethod = NULL;
 			J9ROMClass *romClass = NULL;
 			UDATA lineNumber = 0;
@@ -286,7 +331,26 @@ iterateStackTrace(J9VMThread * vmThread, j9object_t* exception, callback_func_t
 			void * inlinedCallSite = NULL;
 			void * inlineMap = NULL;
 			J9JITConfig * jitConfig = vm->jitConfig;
+#endif
 
+			if (0 != repeatCount) {
+				methodPC = repeatPC;
+				--repeatCount;
+			} else {
+				walkback = J9VMJAVALANGTHROWABLE_WALKBACK(vmThread, (*exception));
+				methodPC = J9JAVAARRAYOFUDATA_LOAD(vmThread, walkback, currentElement);
+				++currentElement;
+				/* A repeated frame is followed by the tag and the number of further copies */
+				if (((currentElement + 1) < arraySize)
+					&& (J9_STACK_TRACE_REPEAT_TAG == J9JAVAARRAYOFUDATA_LOAD(vmThread, walkback, currentElement))
+				) {
+					repeatPC = methodPC;
+					repeatCount = J9JAVAARRAYOFUDATA_LOAD(vmThread, walkback, currentElement + 1);
+					currentElement += 2;
+				}
+			}
+
+#ifdef J9VM_INTERP_NATIVE_SUPPORT
 			if (jitConfig) {
 				metaData = jitConfig->jitGetExceptionTableFromPC(vmThread, methodPC);
 				if (metaData) {
@@ -302,7 +366,6 @@ iterateStackTrace(J9VMThread * vmThread, j9object_t* exception, callback_func_t
 			}
 #endif
 
-			++currentElement; /* can't increment in J9JAVAARRAYOFUDATA_LOAD macro, so must increment here. */
 			++totalEntries;
 			if ((callback != NULL) || pruneConstructors) {
 #ifdef J9VM_INTERP_NATIVE_SUPPORT
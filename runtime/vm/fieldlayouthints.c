@@ -0,0 +1,346 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "util_api.h"
+#include "vm_api.h"
+#include "j9vmnls.h"
+#include "vm_internal.h"
+
+#define FIELD_LAYOUT_HINTS_INITIAL_TABLE_SIZE 64
+#define FIELD_LAYOUT_HINTS_COMMENT_CHAR '#'
+/* Used by -XX:+ValidateFieldLayoutHints when the data cache line size is unknown */
+#define FIELD_LAYOUT_HINTS_DEFAULT_CACHE_LINE_SIZE 64
+
+/**
+ * method that returns the hash for an entry in the field layout hints table
+ * @param entry the entry
+ * @param userData data specified as userData when the hashtable was created, in our case pointer to the port library
+ */
+static UDATA
+fieldLayoutHintHashFn(void *entry, void *userData)
+{
+	J9FieldLayoutHint *hint = (J9FieldLayoutHint *)entry;
+
+	return computeHashForUTF8(hint->className, hint->classNameLength);
+}
+
+/**
+ * method that compares two entries for equality
+ * @param lhsEntry the first entry to compare
+ * @param rhsEntry the second entry to compare
+ * @param userData data specified as userData when the hashtable was created, in our case pointer to the port library
+ *
+ * @returns 1 if the entries match, 0 otherwise
+ */
+static UDATA
+fieldLayoutHintHashEqualFn(void *lhsEntry, void *rhsEntry, void *userData)
+{
+	J9FieldLayoutHint *lhsHint = (J9FieldLayoutHint *)lhsEntry;
+	J9FieldLayoutHint *rhsHint = (J9FieldLayoutHint *)rhsEntry;
+
+	return J9UTF8_DATA_EQUALS(lhsHint->className, lhsHint->classNameLength, rhsHint->className, rhsHint->classNameLength);
+}
+
+/**
+ * method that is called when we are deleting an entry from the hashtable
+ * @param entry the entry to be deleted
+ * @param userData data specified as userData when the hashtable was created, in our case pointer to the port library
+ */
+static UDATA
+fieldLayoutHintDoDelete(void *entry, void *userData)
+{
+	J9FieldLayoutHint *hint = (J9FieldLayoutHint *)entry;
+	PORT_ACCESS_FROM_PORT((J9PortLibrary *)userData);
+
+	j9mem_free_memory(hint->hotFields);
+	return TRUE;
+}
+
+/**
+ * Find the next whitespace separated token on the current line.
+ *
+ * @param cursor the position to start scanning from
+ * @param end the end of the line
+ * @param tokenLength set to the length of the token found
+ *
+ * @returns the start of the token, or NULL if the rest of the line is empty
+ */
+static U_8 *
+nextHintToken(U_8 *cursor, U_8 *end, UDATA *tokenLength)
+{
+	U_8 *token = NULL;
+
+	while ((cursor < end) && ((' ' == *cursor) || ('\t' == *cursor) || ('\r' == *cursor))) {
+		cursor += 1;
+	}
+	if (cursor < end) {
+		token = cursor;
+		while ((cursor < end) && (' ' != *cursor) && ('\t' != *cursor) && ('\r' != *cursor)) {
+			cursor += 1;
+		}
+		*tokenLength = cursor - token;
+	}
+	return token;
+}
+
+/**
+ * Parse one line of the hints file and add it to the hints table.
+ * A line holds a class name followed by the names of its hot instance fields.
+ *
+ * @returns FALSE if memory could not be allocated, TRUE otherwise
+ */
+static BOOLEAN
+parseFieldLayoutHintLine(J9JavaVM *vm, U_8 *line, U_8 *end)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9FieldLayoutHint hint;
+	U_8 *comment = (U_8 *)memchr(line, FIELD_LAYOUT_HINTS_COMMENT_CHAR, end - line);
+	U_8 *cursor = NULL;
+	UDATA tokenLength = 0;
+	UDATA i = 0;
+
+	if (NULL != comment) {
+		end = comment;
+	}
+	memset(&hint, 0, sizeof(hint));
+
+	hint.className = nextHintToken(line, end, &hint.classNameLength);
+	if (NULL == hint.className) {
+		return TRUE;
+	}
+	/* Accept both java.lang.Object and java/lang/Object */
+	for (i = 0; i < hint.classNameLength; i++) {
+		if ('.' == hint.className[i]) {
+			hint.className[i] = '/';
+		}
+	}
+
+	cursor = hint.className + hint.classNameLength;
+	while (NULL != (cursor = nextHintToken(cursor, end, &tokenLength))) {
+		hint.hotFieldCount += 1;
+		cursor += tokenLength;
+	}
+	if (0 == hint.hotFieldCount) {
+		return TRUE;
+	}
+
+	hint.hotFields = (J9FieldLayoutHintField *)j9mem_allocate_memory(hint.hotFieldCount * sizeof(J9FieldLayoutHintField), OMRMEM_CATEGORY_VM);
+	if (NULL == hint.hotFields) {
+		return FALSE;
+	}
+	cursor = hint.className + hint.classNameLength;
+	for (i = 0; i < hint.hotFieldCount; i++) {
+		cursor = nextHintToken(cursor, end, &tokenLength);
+		hint.hotFields[i].name = cursor;
+		hint.hotFields[i].nameLength = tokenLength;
+		cursor += tokenLength;
+	}
+
+	if (NULL == hashTableFind(vm->fieldLayoutHints, &hint)) {
+		if (NULL == hashTableAdd(vm->fieldLayoutHints, &hint)) {
+			j9mem_free_memory(hint.hotFields);
+			return FALSE;
+		}
+	} else {
+		/* The first line for a class wins */
+		j9mem_free_memory(hint.hotFields);
+	}
+	return TRUE;
+}
+
+UDATA
+loadFieldLayoutHints(J9JavaVM *vm, const char *fileName)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	I_64 fileLength = j9file_length(fileName);
+	U_8 *data = NULL;
+	U_8 *cursor = NULL;
+	U_8 *end = NULL;
+	IDATA fd = -1;
+	U_32 hash = 0;
+
+	if ((fileLength < 0) || (fileLength > J9CONST64(0x7FFFFFFF))) {
+		goto fail;
+	}
+	data = (U_8 *)j9mem_allocate_memory((UDATA)fileLength + 1, OMRMEM_CATEGORY_VM);
+	if (NULL == data) {
+		goto fail;
+	}
+	fd = j9file_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		goto fail;
+	}
+	if ((IDATA)fileLength != j9file_read(fd, data, (IDATA)fileLength)) {
+		j9file_close(fd);
+		goto fail;
+	}
+	j9file_close(fd);
+	end = data + fileLength;
+	*end = '\0';
+
+	vm->fieldLayoutHints = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), FIELD_LAYOUT_HINTS_INITIAL_TABLE_SIZE,
+			sizeof(J9FieldLayoutHint), sizeof(U_8 *), 0, OMRMEM_CATEGORY_VM, fieldLayoutHintHashFn, fieldLayoutHintHashEqualFn, NULL, PORTLIB);
+	if (NULL == vm->fieldLayoutHints) {
+		goto fail;
+	}
+	/* The hint names point into the file data, which lives as long as the table */
+	vm->fieldLayoutHintsData = data;
+
+	/* The layout depends on the file contents, so AOT code records this hash. Zero means no hints. */
+	for (cursor = data; cursor < end; cursor++) {
+		hash = (hash << 5) - hash + *cursor;
+	}
+	vm->fieldLayoutHintsHash = (0 == hash) ? 1 : hash;
+
+	cursor = data;
+	while (cursor < end) {
+		U_8 *lineEnd = (U_8 *)memchr(cursor, '\n', end - cursor);
+		if (NULL == lineEnd) {
+			lineEnd = end;
+		}
+		if (!parseFieldLayoutHintLine(vm, cursor, lineEnd)) {
+			goto fail;
+		}
+		cursor = lineEnd + 1;
+	}
+	return JNI_OK;
+
+fail:
+	j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_FIELD_LAYOUT_HINTS_READ_FAILED, fileName);
+	if (NULL == vm->fieldLayoutHintsData) {
+		j9mem_free_memory(data);
+	}
+	cleanupFieldLayoutHints(vm);
+	return JNI_ERR;
+}
+
+void
+cleanupFieldLayoutHints(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL != vm->fieldLayoutHints) {
+		hashTableForEachDo(vm->fieldLayoutHints, fieldLayoutHintDoDelete, PORTLIB);
+		hashTableFree(vm->fieldLayoutHints);
+		vm->fieldLayoutHints = NULL;
+	}
+	j9mem_free_memory(vm->fieldLayoutHintsData);
+	vm->fieldLayoutHintsData = NULL;
+	vm->fieldLayoutHintsHash = 0;
+}
+
+J9FieldLayoutHint *
+findFieldLayoutHint(J9JavaVM *vm, J9ROMClass *romClass)
+{
+	J9FieldLayoutHint *result = NULL;
+
+	if (NULL != vm->fieldLayoutHints) {
+		J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+		J9FieldLayoutHint query;
+
+		query.className = J9UTF8_DATA(className);
+		query.classNameLength = J9UTF8_LENGTH(className);
+		result = (J9FieldLayoutHint *)hashTableFind(vm->fieldLayoutHints, &query);
+	}
+	return result;
+}
+
+BOOLEAN
+isHotFieldInLayoutHint(J9FieldLayoutHint *hint, J9ROMFieldShape *field)
+{
+	J9UTF8 *fieldName = J9ROMFIELDSHAPE_NAME(field);
+	UDATA i = 0;
+
+	for (i = 0; i < hint->hotFieldCount; i++) {
+		if (J9UTF8_DATA_EQUALS(J9UTF8_DATA(fieldName), J9UTF8_LENGTH(fieldName), hint->hotFields[i].name, hint->hotFields[i].nameLength)) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+void
+validateFieldLayoutHints(J9VMThread *vmThread, J9Class *ramClass)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9ROMClass *romClass = ramClass->romClass;
+	J9FieldLayoutHint *hint = findFieldLayoutHint(vm, romClass);
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL != hint) {
+		UDATA const objectHeaderSize = J9JAVAVM_OBJECT_HEADER_SIZE(vm);
+		UDATA const referenceSize = J9JAVAVM_REFERENCE_SIZE(vm);
+		UDATA cacheLineSize = vm->dCacheLineSize;
+		UDATA i = 0;
+
+		if (0 == cacheLineSize) {
+			cacheLineSize = FIELD_LAYOUT_HINTS_DEFAULT_CACHE_LINE_SIZE;
+		}
+
+		for (i = 0; i < hint->hotFieldCount; i++) {
+			J9FieldLayoutHintField *hotField = &hint->hotFields[i];
+			J9ROMFieldOffsetWalkState state;
+			J9ROMFieldOffsetWalkResult *result = NULL;
+			BOOLEAN found = FALSE;
+
+#if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
+			result = fieldOffsetsStartDo(vm, romClass, SUPERCLASS(ramClass), &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE, ramClass->flattenedClassCache);
+#else /* J9VM_OPT_VALHALLA_VALUE_TYPES */
+			result = fieldOffsetsStartDo(vm, romClass, SUPERCLASS(ramClass), &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE);
+#endif /* J9VM_OPT_VALHALLA_VALUE_TYPES */
+			while (NULL != result->field) {
+				J9UTF8 *fieldName = J9ROMFIELDSHAPE_NAME(result->field);
+
+				if (J9UTF8_DATA_EQUALS(J9UTF8_DATA(fieldName), J9UTF8_LENGTH(fieldName), hotField->name, hotField->nameLength)) {
+					U_32 modifiers = result->field->modifiers;
+					UDATA offset = result->offset + objectHeaderSize;
+					UDATA fieldSize = sizeof(U_32);
+
+					if (J9_ARE_ANY_BITS_SET(modifiers, J9FieldFlagObject)) {
+						fieldSize = referenceSize;
+					} else if (J9_ARE_ANY_BITS_SET(modifiers, J9FieldSizeDouble)) {
+						fieldSize = sizeof(U_64);
+					}
+					if ((offset + fieldSize) <= cacheLineSize) {
+						j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_VM_FIELD_LAYOUT_HINTS_IN_FIRST_LINE,
+								hint->classNameLength, hint->className, hotField->nameLength, hotField->name, offset, cacheLineSize);
+					} else {
+						j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_VM_FIELD_LAYOUT_HINTS_BEYOND_FIRST_LINE,
+								hint->classNameLength, hint->className, hotField->nameLength, hotField->name, offset, cacheLineSize);
+					}
+					found = TRUE;
+					break;
+				}
+				result = fieldOffsetsNextDo(&state);
+			}
+			if (!found) {
+				j9nls_printf(PORTLIB, J9NLS_WARNING, J9NLS_VM_FIELD_LAYOUT_HINTS_NO_SUCH_FIELD,
+						hint->classNameLength, hint->className, hotField->nameLength, hotField->name);
+			}
+		}
+	}
+}
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "vmhook_internal.h"
+#include "ut_j9vm.h"
+#include "vm_internal.h"
+
+static void flushInterfaceCallSiteCache(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+
+/**
+ * Discard every entry in the interface call site cache. The entries name receiver
+ * classes and constant pool entries which may be unloaded or redefined, and whose
+ * storage may then be reused.
+ * This is not thread safe: must be called when the caller has exclusive VM access.
+ * userData: java VM
+ */
+static void
+flushInterfaceCallSiteCache(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9JavaVM *vm = (J9JavaVM *)userData;
+
+	if (NULL != vm->interfaceCallSiteCache) {
+		UDATA entryCount = (vm->interfaceCallSiteCacheMask + 1) * J9_INTERFACE_CALL_SITE_CACHE_WAYS;
+
+		Trc_VM_flushInterfaceCallSiteCache(vm->interfaceCallSiteCache, eventNum);
+		memset(vm->interfaceCallSiteCache, 0, entryCount * sizeof(J9InterfaceCallSiteCacheEntry));
+	}
+}
+
+UDATA
+interfaceCallSiteCacheNew(J9JavaVM *vm, UDATA sets)
+{
+	UDATA rc = JNI_OK;
+
+	if (0 != sets) {
+		J9HookInterface **vmHooks = J9_HOOK_INTERFACE(vm->hookInterface);
+		UDATA entryCount = 0;
+		PORT_ACCESS_FROM_JAVAVM(vm);
+
+		/* Round up to a power of two so that the set can be selected with a mask */
+		UDATA roundedSets = 1;
+		while (roundedSets < sets) {
+			roundedSets <<= 1;
+		}
+		entryCount = roundedSets * J9_INTERFACE_CALL_SITE_CACHE_WAYS;
+
+		vm->interfaceCallSiteCache = j9mem_allocate_memory(entryCount * sizeof(J9InterfaceCallSiteCacheEntry), OMRMEM_CATEGORY_VM);
+		if (NULL == vm->interfaceCallSiteCache) {
+			rc = JNI_ENOMEM;
+		} else {
+			memset(vm->interfaceCallSiteCache, 0, entryCount * sizeof(J9InterfaceCallSiteCacheEntry));
+			vm->interfaceCallSiteCacheMask = roundedSets - 1;
+			if ((*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_REDEFINED, flushInterfaceCallSiteCache, OMR_GET_CALLSITE(), vm)
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+			|| (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, flushInterfaceCallSiteCache, OMR_GET_CALLSITE(), vm)
+			|| (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, flushInterfaceCallSiteCache, OMR_GET_CALLSITE(), vm)
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+			) {
+				rc = JNI_ERR;
+			} else {
+				Trc_VM_interfaceCallSiteCacheNew(vm->interfaceCallSiteCache, roundedSets);
+			}
+		}
+	}
+
+	return rc;
+}
+
+void
+interfaceCallSiteCacheFree(J9JavaVM *vm)
+{
+	if (NULL != vm->interfaceCallSiteCache) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+
+		Trc_VM_interfaceCallSiteCacheFree(vm->interfaceCallSiteCacheHits, vm->interfaceCallSiteCacheMisses);
+		j9mem_free_memory(vm->interfaceCallSiteCache);
+		vm->interfaceCallSiteCache = NULL;
+		vm->interfaceCallSiteCacheMask = 0;
+	}
+}
@@ -372,4 +372,6 @@ J9InternalVMFunctions J9InternalFunctions = {
 	setNestmatesError,
 #endif
 	areValueTypesEnabled,
+	handshakeThread,
+	compactStackTrace,
 };
@@ -1475,6 +1475,49 @@ void  initializeJNITable(J9JavaVM *vm)
 	vm->jniFunctionTable = GLOBAL_TABLE(EsJNIFunctions);
 }
 
+UDATA
+initializeJNIGlobalReferenceStripes(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	UDATA stripeCount = J9JNI_GLOBAL_REFERENCE_STRIPE_COUNT;
+	UDATA i = 0;
+
+	vm->jniGlobalReferenceStripes = (J9JNIGlobalReferenceStripe *)j9mem_allocate_memory(stripeCount * sizeof(J9JNIGlobalReferenceStripe), J9MEM_CATEGORY_JNI);
+	if (NULL == vm->jniGlobalReferenceStripes) {
+		return 1;
+	}
+	memset(vm->jniGlobalReferenceStripes, 0, stripeCount * sizeof(J9JNIGlobalReferenceStripe));
+	vm->jniGlobalReferenceStripeCount = stripeCount;
+
+	for (i = 0; i < stripeCount; i++) {
+		J9JNIGlobalReferenceStripe *stripe = &vm->jniGlobalReferenceStripes[i];
+		stripe->globalReferences = pool_new(sizeof(UDATA), 0, 0, POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary));
+		stripe->weakGlobalReferences = pool_new(sizeof(UDATA), 0, 0, POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary));
+		if ((NULL == stripe->globalReferences) || (NULL == stripe->weakGlobalReferences)) {
+			return 1;
+		}
+		if (0 != omrthread_monitor_init_with_name(&stripe->mutex, 0, "JNI global references")) {
+			return 1;
+		}
+	}
+
+	/* The first stripe stays reachable through the original fields for tools which predate striping */
+	vm->jniGlobalReferences = vm->jniGlobalReferenceStripes[0].globalReferences;
+	vm->jniWeakGlobalReferences = vm->jniGlobalReferenceStripes[0].weakGlobalReferences;
+
+	return 0;
+}
+
+/**
+ * Index of the stripe in which the given thread creates its global references.
+ * J9VMThreads are large aligned allocations, so the low bits of the address are discarded.
+ */
+static VMINLINE UDATA
+globalReferenceStripeIndex(J9VMThread *vmThread)
+{
+	return (((UDATA)vmThread) >> 8) % vmThread->javaVM->jniGlobalReferenceStripeCount;
+}
+
 
 /*
  * 1) Private routine.  Used to delete a jni global reference from an actual object pointer.
@@ -1490,24 +1533,38 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
 	Assert_VM_mustHaveVMAccess(vmThread);
 
 	if (globalRef != NULL) {
+		UDATA stripeCount = vm->jniGlobalReferenceStripeCount;
+		UDATA index = globalReferenceStripeIndex(vmThread);
+		UDATA i = 0;
+
+		/* References are usually deleted by the thread which created them, so start with its own stripe */
+		for (i = 0; i < stripeCount; i++) {
+			J9JNIGlobalReferenceStripe *stripe = &vm->jniGlobalReferenceStripes[(index + i) % stripeCount];
+			J9Pool *pool = isWeak ? stripe->weakGlobalReferences : stripe->globalReferences;
+			BOOLEAN found = FALSE;
 
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_enter(vm->jniFrameMutex);
+			omrthread_monitor_enter(stripe->mutex);
 #endif
 
+			if (pool_includesElement(pool, globalRef) == TRUE) {
 #if defined(J9VM_GC_REALTIME)
-		if (J9_EXTENDED_RUNTIME_USER_REALTIME_ACCESS_BARRIER == (vm->extendedRuntimeFlags & J9_EXTENDED_RUNTIME_USER_REALTIME_ACCESS_BARRIER)) {
-			vm->memoryManagerFunctions->j9gc_objaccess_jniDeleteGlobalReference(vmThread, *((j9object_t*)globalRef));
-		}
+				if (J9_EXTENDED_RUNTIME_USER_REALTIME_ACCESS_BARRIER == (vm->extendedRuntimeFlags & J9_EXTENDED_RUNTIME_USER_REALTIME_ACCESS_BARRIER)) {
+					vm->memoryManagerFunctions->j9gc_objaccess_jniDeleteGlobalReference(vmThread, *((j9object_t*)globalRef));
+				}
 #endif /* defined(J9VM_GC_REALTIME) */
-		if (pool_includesElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences, globalRef) == TRUE) {
-			pool_removeElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences, globalRef);
-		}
+				pool_removeElement(pool, globalRef);
+				found = TRUE;
+			}
 
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_exit(vm->jniFrameMutex);
+			omrthread_monitor_exit(stripe->mutex);
 #endif
 
+			if (found) {
+				break;
+			}
+		}
 	}
 }
 
@@ -1523,23 +1580,26 @@ j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 {
 	J9VMThread * vmThread = (J9VMThread *) env;
 	J9JavaVM * vm = vmThread->javaVM;
+	J9JNIGlobalReferenceStripe * stripe = NULL;
 	j9object_t * result;
 
 	Assert_VM_mustHaveVMAccess(vmThread);
 	Assert_VM_notNull(object);
 
+	stripe = &vm->jniGlobalReferenceStripes[globalReferenceStripeIndex(vmThread)];
+
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
+	omrthread_monitor_enter(stripe->mutex);
 #endif
 
-	result = (j9object_t*)pool_newElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences);
+	result = (j9object_t*)pool_newElement(isWeak ? stripe->weakGlobalReferences : stripe->globalReferences);
 	if (result != NULL) {
 		/* Initialize the ref under mutex as a concurrent collector may read from the slot as soon as we release the mutex */
 		*result = object;
 	}
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
+	omrthread_monitor_exit(stripe->mutex);
 #endif
 
 	if (result == NULL) {
@@ -2150,6 +2210,7 @@ getObjectRefType(JNIEnv *env, jobject obj)
 	J9JavaStack* stack = vmThread->stackObject;
 	J9ClassWalkState classWalkState;
 	J9Class * clazz;
+	UDATA i = 0;
 
 	VM_VMAccess::inlineEnterVMFromJNI(vmThread);
 
@@ -2159,33 +2220,27 @@ getObjectRefType(JNIEnv *env, jobject obj)
 		goto done;
 	}
 
-#ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
-#endif
+	/* Check for global and weak global refs */
 
-	/* Check for global ref */
+	for (i = 0; i < vm->jniGlobalReferenceStripeCount; i++) {
+		J9JNIGlobalReferenceStripe *stripe = &vm->jniGlobalReferenceStripes[i];
 
-	if (pool_includesElement(vm->jniGlobalReferences, obj)) {
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_exit(vm->jniFrameMutex);
+		omrthread_monitor_enter(stripe->mutex);
 #endif
-		rc = JNIGlobalRefType;
-		goto done;
-	}
-
-	/* Check for weak global ref */
-
-	if (pool_includesElement(vm->jniWeakGlobalReferences, obj)) {
+		if (pool_includesElement(stripe->globalReferences, obj)) {
+			rc = JNIGlobalRefType;
+		} else if (pool_includesElement(stripe->weakGlobalReferences, obj)) {
+			rc = JNIWeakGlobalRefType;
+		}
 #ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_exit(vm->jniFrameMutex);
+		omrthread_monitor_exit(stripe->mutex);
 #endif
-		rc = JNIWeakGlobalRefType;
-		goto done;
-	}
 
-#ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
-#endif
+		if (JNIInvalidRefType != rc) {
+			goto done;
+		}
+	}
 
 	/* Check for stack-based local refs */
 
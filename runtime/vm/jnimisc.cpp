@@ -631,6 +631,7 @@ getArrayElements(JNIEnv *env, jarray array, jboolean *isCopy)
 			if (NULL != isCopy) {
 				*isCopy = JNI_TRUE;
 			}
+			vm->memoryManagerFunctions->j9gc_jni_array_copied(currentThread, byteCount);
 			JAVA_OFFLOAD_SWITCH_OFF_WITH_REASON_IF_LIMIT_EXCEEDED(currentThread, J9_JNI_OFFLOAD_SWITCH_GET_ARRAY_ELEMENTS, byteCount);
 		}
 		VM_VMAccess::inlineExitVMToJNI(currentThread);
@@ -197,6 +197,10 @@ deallocateVMThread(J9VMThread * vmThread, UDATA decrementZombieCount, UDATA send
 
 	J9_LINKED_LIST_REMOVE(vm->mainThread, vmThread);
 
+	/* The vmThreadListMutex serializes adding the thread's statistics to the totals */
+	vm->interfaceCallSiteCacheHits += vmThread->interfaceCallSiteCacheHits;
+	vm->interfaceCallSiteCacheMisses += vmThread->interfaceCallSiteCacheMisses;
+
 	/* This must be called before the GC cleans up, as the cleanup deletes the gc extensions.  The
 	 * extensions are used by the RT vm's when calling getVMThreadName because it must go through
 	 * the access barrier.
@@ -693,6 +693,7 @@ freeJavaVM(J9JavaVM * vm)
 	freeNativeMethodBindTable(vm);
 	freeHiddenInstanceFieldsList(vm);
 	cleanupLockwordConfig(vm);
+	cleanupFieldLayoutHints(vm);
 
 	destroyJvmInitArgs(vm->portLibrary, vm->vmArgsArray);
 	vm->vmArgsArray = NULL;
@@ -715,8 +716,15 @@ freeJavaVM(J9JavaVM * vm)
 		vm->javaBaseModule = NULL;
 	}
 
-	if (NULL != vm->jniGlobalReferences) {
-		pool_kill(vm->jniGlobalReferences);
+	if (NULL != vm->jniGlobalReferenceStripes) {
+		UDATA i = 0;
+		for (i = 0; i < vm->jniGlobalReferenceStripeCount; i++) {
+			J9JNIGlobalReferenceStripe *stripe = &vm->jniGlobalReferenceStripes[i];
+			if (NULL != stripe->globalReferences) {
+				pool_kill(stripe->globalReferences);
+				stripe->globalReferences = NULL;
+			}
+		}
 		vm->jniGlobalReferences = NULL;
 	}
 
@@ -759,8 +767,20 @@ freeJavaVM(J9JavaVM * vm)
 	/* Detach the VM from OMR */
 	detachVMFromOMR(vm);
 
-	if (NULL != vm->jniWeakGlobalReferences) {
-		pool_kill(vm->jniWeakGlobalReferences);
+	if (NULL != vm->jniGlobalReferenceStripes) {
+		UDATA i = 0;
+		for (i = 0; i < vm->jniGlobalReferenceStripeCount; i++) {
+			J9JNIGlobalReferenceStripe *stripe = &vm->jniGlobalReferenceStripes[i];
+			if (NULL != stripe->weakGlobalReferences) {
+				pool_kill(stripe->weakGlobalReferences);
+			}
+			if (NULL != stripe->mutex) {
+				omrthread_monitor_destroy(stripe->mutex);
+			}
+		}
+		j9mem_free_memory(vm->jniGlobalReferenceStripes);
+		vm->jniGlobalReferenceStripes = NULL;
+		vm->jniGlobalReferenceStripeCount = 0;
 		vm->jniWeakGlobalReferences = NULL;
 	}
 
@@ -828,6 +848,8 @@ freeJavaVM(J9JavaVM * vm)
 	fieldIndexTableFree(vm);
 #endif
 
+	interfaceCallSiteCacheFree(vm);
+
 	/* Close the trace DLL. This has to be after all hashtable and pool free events, otherwise we'll crash on pool tracepoints */
 	if (0 != traceDescriptor) {
 		j9sl_close_shared_library(traceDescriptor);
@@ -2065,7 +2087,7 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 			initializeVMLocalStorage(vm);
 #endif
 
-			if (NULL == (vm->jniGlobalReferences = pool_new(sizeof(UDATA), 0, 0, POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary)))) {
+			if (0 != initializeJNIGlobalReferenceStripes(vm)) {
 				goto _error;
 			}
 
@@ -2075,9 +2097,6 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 			initializeJNITable(vm);
 			/* vm->jniFunctionTable = GLOBAL_TABLE(EsJNIFunctions); */
 
-			if (NULL == (vm->jniWeakGlobalReferences = pool_new(sizeof(UDATA), 0, 0, POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary))))
-				goto _error;
-
 			if (NULL == (vm->classLoadingStackPool = pool_new(sizeof(J9ClassLoadingStackElement),  0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_CLASSES, POOL_FOR_PORT(vm->portLibrary))))
 				goto _error;
 
@@ -2162,6 +2181,36 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 				}
 			}
 
+			/* 0 (the default) records every frame in Throwable stack traces */
+			vm->maxStackTraceDepth = 0;
+			if ((argIndex = FIND_AND_CONSUME_ARG(STARTSWITH_MATCH, VMOPT_XXMAXJAVASTACKTRACEDEPTH_EQUALS, NULL)) >= 0) {
+				UDATA depth = 0;
+				char *optname = VMOPT_XXMAXJAVASTACKTRACEDEPTH_EQUALS;
+				GET_INTEGER_VALUE(argIndex, optname, depth);
+				vm->maxStackTraceDepth = depth;
+			}
+
+			{
+				/* Sets of the interpreter's invokeinterface call site cache, 0 disables it */
+				UDATA sets = J9_INTERFACE_CALL_SITE_CACHE_DEFAULT_SETS;
+				if ((argIndex = FIND_AND_CONSUME_ARG(STARTSWITH_MATCH, VMOPT_XXINTERFACECALLSITECACHESIZE_EQUALS, NULL)) >= 0) {
+					char *optname = VMOPT_XXINTERFACECALLSITECACHESIZE_EQUALS;
+					GET_INTEGER_VALUE(argIndex, optname, sets);
+				}
+				if (JNI_OK != interfaceCallSiteCacheNew(vm, sets)) {
+					goto _error;
+				}
+			}
+
+			/* Classes with at least this many iTables get a hashed iTable index, 0 disables it */
+			vm->iTableIndexThreshold = J9_ITABLE_INDEX_DEFAULT_THRESHOLD;
+			if ((argIndex = FIND_AND_CONSUME_ARG(STARTSWITH_MATCH, VMOPT_XXITABLEINDEXTHRESHOLD_EQUALS, NULL)) >= 0) {
+				UDATA threshold = 0;
+				char *optname = VMOPT_XXITABLEINDEXTHRESHOLD_EQUALS;
+				GET_INTEGER_VALUE(argIndex, optname, threshold);
+				vm->iTableIndexThreshold = threshold;
+			}
+
 #if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
 			/* TODO pick a reasonable default */
 			vm->valueFlatteningThreshold = UDATA_MAX;
@@ -2213,6 +2262,15 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 				printLockwordWhat(vm);
 			}
 
+			argIndex = FIND_AND_CONSUME_ARG(STARTSWITH_MATCH, VMOPT_XXFIELDLAYOUTHINTS_EQUALS, NULL);
+			if (argIndex >= 0) {
+				optionValue = NULL;
+				GET_OPTION_VALUE(argIndex, '=', &optionValue);
+				if ((NULL == optionValue) || (JNI_OK != loadFieldLayoutHints(vm, optionValue))) {
+					goto _error;
+				}
+			}
+
 			break;
 
 		case BYTECODE_TABLE_SET:
@@ -2997,6 +3055,16 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		}
 	}
 
+	{
+		IDATA noCompactStackTraceInThrowable = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOCOMPACTSTACKTRACEINTHROWABLE, NULL);
+		IDATA compactStackTraceInThrowable = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXCOMPACTSTACKTRACEINTHROWABLE, NULL);
+		if (compactStackTraceInThrowable > noCompactStackTraceInThrowable) {
+			vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_COMPACT_STACK_TRACES;
+		} else if (compactStackTraceInThrowable < noCompactStackTraceInThrowable) {
+			vm->extendedRuntimeFlags2 &= ~(UDATA)J9_EXTENDED_RUNTIME2_COMPACT_STACK_TRACES;
+		}
+	}
+
 	{
 		IDATA alwaysCopyJNICritical = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXALWAYSCOPYJNICRITICAL, NULL);
 		IDATA noAlwaysCopyJNICritical = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOALWAYSCOPYJNICRITICAL, NULL);
@@ -3143,6 +3211,16 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		}
 	}
 
+	{
+		IDATA validateFieldLayoutHints = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXVALIDATEFIELDLAYOUTHINTS, NULL);
+		IDATA noValidateFieldLayoutHints = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOVALIDATEFIELDLAYOUTHINTS, NULL);
+		if (validateFieldLayoutHints > noValidateFieldLayoutHints) {
+			vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_VALIDATE_FIELD_LAYOUT_HINTS;
+		} else if (validateFieldLayoutHints < noValidateFieldLayoutHints) {
+			vm->extendedRuntimeFlags2 &= ~(UDATA)J9_EXTENDED_RUNTIME2_VALIDATE_FIELD_LAYOUT_HINTS;
+		}
+	}
+
 	{
 		IDATA noContendedFields = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOCONTENDEDFIELDS, NULL);
 		IDATA contendedFields = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXCONTENDEDFIELDS, NULL);
@@ -3700,11 +3778,11 @@ zeroInitStages(J9JavaVM* vm, IDATA stage, void* reserved)
 
 	switch(stage) {
 		case PORT_LIBRARY_GUARANTEED :
-			/* -Xzero option is removed from Java 9 */
-			if (J2SE_VERSION(vm) >= J2SE_V11) {
-				vm->zeroOptions = 0;
-			} else {
-				vm->zeroOptions = J9VM_ZERO_SHAREBOOTZIPCACHE;
+			/* Zip directory caches for bootstrap jars are stored in the shared class cache by default.
+			 * -Xzero option is removed from Java 9, so on later releases only -XX:-ShareBootZipCache can change this.
+			 */
+			vm->zeroOptions = J9VM_ZERO_SHAREBOOTZIPCACHE;
+			if (J2SE_VERSION(vm) < J2SE_V11) {
 				argIndex1 = FIND_ARG_IN_VMARGS_FORWARD(STARTSWITH_MATCH, VMOPT_XZERO, NULL);
 				while(argIndex1 >= 0) {
 					char *optionString;
@@ -3803,6 +3881,16 @@ zeroInitStages(J9JavaVM* vm, IDATA stage, void* reserved)
 					j9tty_printf(PORTLIB, "%s\n", foundOption ? "" : VMOPT_ZERO_NONE);
 				}
 			}
+			{
+				/* last instance of +/- ShareBootZipCache found on the command line wins and overrules -Xzero */
+				IDATA enableIndex = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXSHAREBOOTZIPCACHE, NULL);
+				IDATA disableIndex = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOSHAREBOOTZIPCACHE, NULL);
+				if (enableIndex > disableIndex) {
+					vm->zeroOptions |= J9VM_ZERO_SHAREBOOTZIPCACHE;
+				} else if (disableIndex > enableIndex) {
+					vm->zeroOptions &= ~J9VM_ZERO_SHAREBOOTZIPCACHE;
+				}
+			}
 			break;
 		case ALL_DEFAULT_LIBRARIES_LOADED :
 			break;
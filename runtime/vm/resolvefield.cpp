@@ -72,6 +72,9 @@ static J9ROMFieldShape *allocAndInitFakeJ9ROMFieldShape(J9JavaVM *vm, const char
 VMINLINE static J9HiddenInstanceField *initJ9HiddenField(J9HiddenInstanceField *field, J9UTF8 *classNameUTF8, J9ROMFieldShape *shape, UDATA *offsetReturn, J9HiddenInstanceField *next);
 
 static void fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field);
+static bool isHotInstanceField(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field);
+static void countHotInstanceFields(J9ROMFieldOffsetWalkState *state);
+VMINLINE static U_32 nextInstanceFieldIndex(bool hot, U_32 *seen, U_32 *hotSeen, U_32 hotCount);
 
 
 /*
@@ -735,6 +738,14 @@ fieldOffsetsStartDo(J9JavaVM *vm, J9ROMClass *romClass, J9Class *superClazz, J9R
 
 		fieldInfo.countInstanceFields();
 
+		/* Hot fields named by -XX:FieldLayoutHints= are placed first among the fields of the same size */
+		if ((NULL != vm->fieldLayoutHints) && !fieldInfo.isContendedClassLayout()) {
+			state->layoutHint = findFieldLayoutHint(vm, romClass);
+			if (NULL != state->layoutHint) {
+				countHotInstanceFields(state);
+			}
+		}
+
 		if (NULL != extraHiddenFields) {
 			state->hiddenInstanceFieldCount = fieldInfo.countAndCopyHiddenFields(extraHiddenFields, state->hiddenInstanceFields);
 			Assert_VM_true(state->hiddenInstanceFieldCount < sizeof(state->hiddenInstanceFields)/sizeof(state->hiddenInstanceFields[0]));
@@ -907,6 +918,71 @@ fieldOffsetsNextDo(J9ROMFieldOffsetWalkState *state)
 
 
 
+/*
+ * Only fields stored in the plain double, object and single areas are reordered.
+ */
+static bool
+isHotInstanceField(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
+{
+	bool hot = false;
+	if (NULL != state->layoutHint) {
+		hot = (TRUE == isHotFieldInLayoutHint(state->layoutHint, field));
+#ifdef J9VM_OPT_VALHALLA_VALUE_TYPES
+		/* flattenable fields keep their usual placement */
+		if ('Q' == *J9UTF8_DATA(J9ROMFIELDSHAPE_SIGNATURE(field))) {
+			hot = false;
+		}
+#endif /* J9VM_OPT_VALHALLA_VALUE_TYPES */
+	}
+	return hot;
+}
+
+/*
+ * Count the hot instance fields of each size, which are placed ahead of the
+ * other fields of that size.
+ */
+static void
+countHotInstanceFields(J9ROMFieldOffsetWalkState *state)
+{
+	J9ROMFieldWalkState fieldWalkState;
+	J9ROMFieldShape *field = romFieldsStartDo(state->romClass, &fieldWalkState);
+
+	while (NULL != field) {
+		U_32 modifiers = field->modifiers;
+
+		if (J9_ARE_NO_BITS_SET(modifiers, J9AccStatic) && isHotInstanceField(state, field)) {
+			if (J9_ARE_ANY_BITS_SET(modifiers, J9FieldFlagObject)) {
+				state->hotObjectCount += 1;
+			} else if (J9_ARE_ANY_BITS_SET(modifiers, J9FieldSizeDouble)) {
+				state->hotDoubleCount += 1;
+			} else {
+				state->hotSingleCount += 1;
+			}
+		}
+		field = romFieldsNextDo(&fieldWalkState);
+	}
+}
+
+/*
+ * Return the position of the next instance field within its area. Hot fields
+ * take the first hotCount positions in declaration order, and the remaining
+ * fields follow in declaration order. Without hints this is simply the
+ * number of fields of the same size seen so far.
+ */
+VMINLINE static U_32
+nextInstanceFieldIndex(bool hot, U_32 *seen, U_32 *hotSeen, U_32 hotCount)
+{
+	U_32 index = 0;
+	if (hot) {
+		index = *hotSeen;
+		*hotSeen += 1;
+	} else {
+		index = hotCount + (*seen - *hotSeen);
+	}
+	*seen += 1;
+	return index;
+}
+
 /*
  * Find the next appropriate field, starting with the field passed in, storing
  * the result in state->result.
@@ -955,6 +1031,10 @@ fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
 							Assert_VM_true(state->backfillOffsetToUse >= 0);
 							state->result.offset = state->backfillOffsetToUse;
 							state->walkFlags &= ~(UDATA)J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD;
+							if (isHotInstanceField(state, field)) {
+								/* A hot field in the backfill slot does not occupy the objects area */
+								state->hotObjectCount -= 1;
+							}
 						} else {
 #ifdef J9VM_OPT_VALHALLA_VALUE_TYPES
 							J9UTF8 *fieldSig = J9ROMFIELDSHAPE_SIGNATURE(field);
@@ -963,8 +1043,7 @@ fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
 								J9Class *fieldClass = NULL;
 								fieldClass = findJ9ClassInFlattenedClassCache(state->flattenedClassCache, fieldSigBytes + 1, J9UTF8_LENGTH(fieldSig) - 2);
 								if (J9_ARE_NO_BITS_SET(fieldClass->classFlags, J9ClassIsFlattened)) {
-									state->result.offset = state->firstObjectOffset + state->objectsSeen * referenceSize;
-									state->objectsSeen++;
+									state->result.offset = state->firstObjectOffset + nextInstanceFieldIndex(false, &state->objectsSeen, &state->hotObjectsSeen, state->hotObjectCount) * referenceSize;
 								} else {
 									U_32 firstFieldOffset = (U_32) fieldClass->backfillOffset;
 									state->result.flattenedClass = fieldClass;
@@ -982,23 +1061,27 @@ fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
 							} else
 #endif /* J9VM_OPT_VALHALLA_VALUE_TYPES */
 							{
-								state->result.offset = state->firstObjectOffset + state->objectsSeen * referenceSize;
-								state->objectsSeen++;
+								U_32 index = nextInstanceFieldIndex(isHotInstanceField(state, field), &state->objectsSeen, &state->hotObjectsSeen, state->hotObjectCount);
+								state->result.offset = state->firstObjectOffset + index * referenceSize;
 							}
 						}
 						break;
 					} else if ( 0 == (state->walkFlags & J9VM_FIELD_OFFSET_WALK_ONLY_OBJECT_SLOTS) ) {
 						if( modifiers & J9FieldSizeDouble ) {
-							state->result.offset = state->firstDoubleOffset + state->doublesSeen * sizeof( U_64 );
-							state->doublesSeen++;
+							U_32 index = nextInstanceFieldIndex(isHotInstanceField(state, field), &state->doublesSeen, &state->hotDoublesSeen, state->hotDoubleCount);
+							state->result.offset = state->firstDoubleOffset + index * sizeof( U_64 );
 						} else {
 							if (state->walkFlags & J9VM_FIELD_OFFSET_WALK_BACKFILL_SINGLE_FIELD) {
 								Assert_VM_true(state->backfillOffsetToUse >= 0);
 								state->result.offset = state->backfillOffsetToUse;
 								state->walkFlags &= ~(UDATA)J9VM_FIELD_OFFSET_WALK_BACKFILL_SINGLE_FIELD;
+								if (isHotInstanceField(state, field)) {
+									/* A hot field in the backfill slot does not occupy the singles area */
+									state->hotSingleCount -= 1;
+								}
 							} else {
-								state->result.offset = state->firstSingleOffset + state->singlesSeen * sizeof( U_32 );
-								state->singlesSeen++;
+								U_32 index = nextInstanceFieldIndex(isHotInstanceField(state, field), &state->singlesSeen, &state->hotSinglesSeen, state->hotSingleCount);
+								state->result.offset = state->firstSingleOffset + index * sizeof( U_32 );
 							}
 						}
 						break;
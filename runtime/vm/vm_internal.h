@@ -238,7 +238,79 @@ parseLockwordConfig(J9JavaVM* jvm, char* options, BOOLEAN* what);
 void
 printLockwordWhat(J9JavaVM* jvm);
 
+/* ---------------- fieldlayouthints.c ---------------- */
+/**
+ * Read the -XX:FieldLayoutHints= file. Each line names a class followed by
+ * its hot instance fields, which are placed first within their size class.
+ *
+ * @param vm pointer to J9JavaVM
+ * @param fileName the hints file
+ *
+ * @returns JNI_OK on success, JNI_ERR if the file could not be read
+ */
+UDATA
+loadFieldLayoutHints(J9JavaVM *vm, const char *fileName);
+
+/**
+ * Free the field layout hints read by loadFieldLayoutHints().
+ *
+ * @param vm pointer to J9JavaVM
+ */
+void
+cleanupFieldLayoutHints(J9JavaVM *vm);
+
+/**
+ * Find the layout hint for a class.
+ *
+ * @param vm pointer to J9JavaVM
+ * @param romClass the class being laid out
+ *
+ * @returns the hint, or NULL if there are no hints for the class
+ */
+J9FieldLayoutHint *
+findFieldLayoutHint(J9JavaVM *vm, J9ROMClass *romClass);
+
+/**
+ * @param hint the layout hint for the class declaring field
+ * @param field an instance field
+ *
+ * @returns TRUE if the hint lists the field as hot
+ */
+BOOLEAN
+isHotFieldInLayoutHint(J9FieldLayoutHint *hint, J9ROMFieldShape *field);
+
+/**
+ * Report where the hot fields of a newly created class were placed, for
+ * -XX:+ValidateFieldLayoutHints. Hinted fields which do not exist are reported too.
+ *
+ * @param vmThread the current thread
+ * @param ramClass the class, with its superclasses initialized
+ */
+void
+validateFieldLayoutHints(J9VMThread *vmThread, J9Class *ramClass);
+
+
+
+/* ---------------- interfacecallsitecache.c ---------------- */
+/**
+ * Allocate the interpreter's invokeinterface call site cache, and register the hooks
+ * which flush it when classes are unloaded or redefined.
+ *
+ * @param vm pointer to J9JavaVM
+ * @param sets number of sets in the cache, rounded up to a power of two; 0 disables the cache
+ *
+ * @returns JNI_OK on success, JNI_ENOMEM or JNI_ERR on failure
+ */
+UDATA
+interfaceCallSiteCacheNew(J9JavaVM *vm, UDATA sets);
 
+/**
+ * Free the cache allocated by interfaceCallSiteCacheNew(), tracing its hit statistics.
+ *
+ * @param vm pointer to J9JavaVM
+ */
+void
+interfaceCallSiteCacheFree(J9JavaVM *vm);
 
 /* ------------------- stringhelpers.c ----------------- */
 /**
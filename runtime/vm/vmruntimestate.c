@@ -45,7 +45,6 @@ vmRuntimeStateListenerProc(J9PortLibrary* portLib, void *userData)
 	J9JavaVM *vm = (J9JavaVM *)userData;
 	J9VMRuntimeStateListener *listener = &vm->vmRuntimeStateListener;
 	J9VMThread *vmThread = listener->runtimeStateListenerVMThread;
-	IDATA rc = 0;
 	U_32 currentState = getVMRuntimeState(vm);
 
 	omrthread_monitor_enter(listener->runtimeStateListenerMutex);
@@ -54,9 +53,12 @@ vmRuntimeStateListenerProc(J9PortLibrary* portLib, void *userData)
 	omrthread_monitor_notify(listener->runtimeStateListenerMutex);
 
 	while (J9VM_RUNTIME_STATE_LISTENER_STOP != listener->runtimeStateListenerState) {
-		do {
-			rc = omrthread_monitor_wait(listener->runtimeStateListenerMutex);
-		} while ((0 != rc) || ((J9VM_RUNTIME_STATE_LISTENER_STOP != listener->runtimeStateListenerState) && (currentState == getVMRuntimeState(vm))));
+		/* A hook may itself wait on the monitor and consume the notification of the next state change,
+		 * so only wait while no change is pending.
+		 */
+		while ((J9VM_RUNTIME_STATE_LISTENER_STOP != listener->runtimeStateListenerState) && (currentState == getVMRuntimeState(vm))) {
+			omrthread_monitor_wait(listener->runtimeStateListenerMutex);
+		}
 
 		if (J9VM_RUNTIME_STATE_LISTENER_STOP != listener->runtimeStateListenerState) {
 			currentState = getVMRuntimeState(vm);
@@ -54,6 +54,9 @@ extern "C" {
 	
 #define ZIP_WORK_BUFFER_SIZE 64000
 
+/* Central directories up to this size are read with a single read into a dedicated buffer */
+#define ZIP_BULK_CENTRAL_DIR_SIZE (16 * 1024 * 1024)
+
 
 /* ---------------- zcpool.c ---------------- */
 
@@ -113,6 +116,9 @@ void zipCachePool_doKillHandler(J9ZipCachePoolEntry *entry, J9ZipCachePool *zcp)
    matter if we don't fit in one page, but the KISS principle applies.. */
 #define ACTUAL_CHUNK_SIZE	(4096 - 4*sizeof(UDATA) )
 
+/* Longest directory prefix remembered by zipCache_addElement() */
+#define ZIP_CACHE_LAST_DIR_NAME_SIZE 256
+
 /**
 * @typedef
 * @struct
@@ -123,6 +129,12 @@ typedef struct J9ZipCacheInternal {
 	J9ZipCacheEntry *entry;
 	IDATA zipFileFd;
 	U_8 zipFileType;
+	J9ZipDirEntry *lastDirEntry;
+	IDATA lastDirNameLength;
+	char lastDirName[ZIP_CACHE_LAST_DIR_NAME_SIZE];
+	J9MmapHandle *mappedFile;
+	IDATA mappedFileSize;
+	BOOLEAN mapAttempted;
 } J9ZipCacheInternal;
 
 /**
@@ -45,7 +45,7 @@
  * The zip cache version number must be changed if the zip
  * cache format changes.
  */
-#define ZIP_CACHE_VERSION 1
+#define ZIP_CACHE_VERSION 2
 
 #define UDATA_TOP_BIT    (((UDATA)1)<<(sizeof(UDATA)*8-1))
 #define ISCLASS_BIT    UDATA_TOP_BIT
@@ -122,6 +122,11 @@ J9ZipCache *zipCache_new(J9PortLibrary * portLib, char *zipName, IDATA zipNameLe
 	zci->entry = zce;
 	zci->zipFileFd = -1;
 	zci->zipFileType = ZIP_Unknown;
+	zci->lastDirEntry = NULL;
+	zci->lastDirNameLength = 0;
+	zci->mappedFile = NULL;
+	zci->mappedFileSize = 0;
+	zci->mapAttempted = FALSE;
 
 	zci->info.portLib = portLib;
 	ZIP_SRP_SET(zce->currentChunk, chunk);
@@ -166,10 +171,13 @@ void zipCache_setStartCentralDir(J9ZipCache * zipCache, IDATA startCentralDir)
 #if defined(J9VM_OPT_SHARED_CLASSES)
 /** 
  * Returns a unique id for the zip cache. Used to identify the zip
- * cache data in shared memory. Consists of the zip file name (but
- * not the path), the zip file timestamp, the zip file size, and a
- * zip cache version number. The zip cache version number must be
- * changed if the zip cache format changes.
+ * cache data in shared memory. Consists of the full path of the zip
+ * file, the zip file size, the zip file timestamp, and a zip cache
+ * version number. The path is included so that distinct jars which
+ * happen to share a name, size and timestamp (e.g. rebuilt copies in
+ * different directories) never resolve to the same directory data.
+ * The zip cache version number must be changed if the zip cache
+ * format changes.
  * 
  * The unique id is allocated by j9mem_allocate_memory() and must be
  * freed using j9mem_free_memory().
@@ -187,21 +195,10 @@ const char *zipCache_uniqueId(J9ZipCache * zipCache) {
 	UDATA sizeRequired;
 	char *buf;
 	const char *fileName = ZIP_SRP_GET(zce->zipFileName, const char *);
-	UDATA nameLength;
-	IDATA i = 0;
 	if (!fileName) {
 		return NULL;
 	}
-	nameLength = strlen(fileName);
 
-
-	for (i = nameLength - 1; i >= 0; i--) {
-		if (fileName[i] == '\\' || fileName[i] == '/') {
-			fileName = &fileName[i+1];
-			break;
-		}
-	}
-	
 	sizeRequired = j9str_printf(PORTLIB, NULL, 0, "%s_%d_%lld_%d", fileName, zce->zipFileSize, zce->zipTimeStamp, ZIP_CACHE_VERSION);
 	buf = j9mem_allocate_memory(sizeRequired, J9MEM_CATEGORY_VM_JCL);
 	if (!buf) {
@@ -405,6 +402,7 @@ void zipCache_useCopiedCache(J9ZipCache * zipCache, void *cacheData) {
 	zce = (J9ZipCacheEntry *)(chunk + 1);
 /*	zipCache_walkCache(portLib, zce, &zce->root); */
 	orgzci->entry = zce;
+	orgzci->lastDirEntry = NULL;
 }
 #endif
 
@@ -574,6 +572,19 @@ zipCache_addElement(J9ZipCache * zipCache, char *elementName, IDATA elementNameL
 
 	curName = elementName;
 	nameLength = elementNameLength;
+
+	/* The central directory normally lists the entries of a directory together, so
+	 * start from the directory the previous file was added to when the prefix matches.
+	 */
+	if ((NULL != zci->lastDirEntry)
+		&& (zci->lastDirNameLength < elementNameLength)
+		&& (0 == memcmp(elementName, zci->lastDirName, zci->lastDirNameLength))
+	) {
+		dirEntry = zci->lastDirEntry;
+		curName += zci->lastDirNameLength;
+		nameLength -= zci->lastDirNameLength;
+	}
+
 	for (;;) {
 		J9ZipDirEntry *d;
 
@@ -605,6 +616,13 @@ zipCache_addElement(J9ZipCache * zipCache, char *elementName, IDATA elementNameL
 		if (curName[curSize] != '/') {
 			/* The prefix we're looking at doesn't end with a '/', which means */
 			/* it is really the suffix of the elementName, and it's a filename. */
+			IDATA dirNameLength = curName - elementName;
+
+			if ((dirEntry != zci->lastDirEntry) && (dirNameLength > 0) && (dirNameLength <= ZIP_CACHE_LAST_DIR_NAME_SIZE)) {
+				memcpy(zci->lastDirName, elementName, dirNameLength);
+				zci->lastDirNameLength = dirNameLength;
+				zci->lastDirEntry = dirEntry;
+			}
 
 			fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
 			if(fileEntry) {
@@ -758,7 +776,7 @@ void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
 
 
 /** 
- * Deletes a zip cache and frees its resources. Also closes the zip file descriptor.
+ * Deletes a zip cache and frees its resources. Also unmaps and closes the zip file.
  *
  * @param[in] zipCache the zip cache to be freed
  *
@@ -776,6 +794,9 @@ void zipCache_kill(J9ZipCache * zipCache)
 	PORT_ACCESS_FROM_PORT(portLib);
 
 	zipCache_freeChunks(portLib, zce);
+	if (NULL != zci->mappedFile) {
+		j9mmap_unmap_file(zci->mappedFile);
+	}
 	if (-1 != zci->zipFileFd) {
 		j9file_close(zci->zipFileFd);
 	}
@@ -62,7 +62,8 @@ J9ZipFunctionTable zipFunctions = {
 	zip_initZipEntry,
 	zip_openZipFile,
 	zip_releaseZipFile,
-	zip_resetZipFile
+	zip_resetZipFile,
+	zip_getZipEntryDataPointer
 };
 
 #define ZIP_NEXT_U8(value, index) (value = *(index++))
@@ -91,6 +92,7 @@ static I_32 getZipEntryUsingDirectory(J9PortLibrary *portLib, J9ZipFile *zipFile
 		const char *fileName, IDATA fileNameLength, BOOLEAN readDataPointer);
 static BOOLEAN isSeekFailure(I_64 seekResult, I_64 expectedValue);
 static BOOLEAN isOutside4Gig(I_64 value);
+static U_8 *getMappedEntryData(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *entry);
 
 #if defined(J9VM_THR_PREEMPTIVE)
 #include "omrthread.h"
@@ -744,6 +746,7 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 	U_8 *buffer = NULL;
 	U_8 *filename = NULL;
 	IDATA filenameSize = 256;  /* Should be sufficient for most filenames */
+	U_8 *elementName;
 	U_8 *current;
 	U_32 sig;
 	U_32 localHeaderOffset;
@@ -766,6 +769,17 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 		goto finished;
 	}
 
+	/* Large central directories (jars with many entries) are read in one go, so that
+	 * every entry can be parsed directly from the buffer without further reads.
+	 */
+	if ((unreadSize > bufferSize) && (unreadSize <= ZIP_BULK_CENTRAL_DIR_SIZE)) {
+		buffer = j9mem_allocate_memory(unreadSize, J9MEM_CATEGORY_VM_JCL);
+		if (NULL != buffer) {
+			bufferSize = unreadSize;
+			freeBuffer = TRUE;
+		}
+	}
+
 	/* Allocate some space to hold central directory goo as we eat through it */
 	cachePool = zipFile->cachePool;
 	if (cachePool != NULL) {
@@ -775,22 +789,27 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 		}
 		if (cachePool->workBuffer != NULL) {
 			filename = (U_8*)cachePool->workBuffer;
-			buffer = (U_8*)cachePool->workBuffer + filenameSize;
-			bufferSize -= filenameSize;
+			if (buffer == NULL) {
+				buffer = (U_8*)cachePool->workBuffer + filenameSize;
+				bufferSize -= filenameSize;
+			}
 		}
 	}
 
 	/* No point in allocating more than we'll actually need.. */
 	if (bufferSize > unreadSize)  bufferSize = unreadSize;
 
-	if (buffer == NULL) {
-		freeBuffer = freeFilename = TRUE;
+	if (filename == NULL) {
+		freeFilename = TRUE;
 		filename = j9mem_allocate_memory(filenameSize, J9MEM_CATEGORY_VM_JCL);
 		if (!filename)  {
 			result = ZIP_ERR_OUT_OF_MEMORY;
 			goto finished;
 		}
+	}
 
+	if (buffer == NULL) {
+		freeBuffer = TRUE;
 		buffer = j9mem_allocate_memory(bufferSize, J9MEM_CATEGORY_VM_JCL);
 	}
 	if(!buffer && (bufferSize > 4096))	 {
@@ -855,6 +874,13 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 			current += sizeof(U_32);  /* skip external attributes field */
 			ZIP_NEXT_U32(localHeaderOffset, current);
 
+			if (bufferedSize - (current-buffer) >= entry.filenameLength)  {
+				/* The whole name is in the buffer (always the case for a bulk read), use it in place. */
+				elementName = current;
+				current += entry.filenameLength;
+				goto haveElementName;
+			}
+
 			/* Increase filename buffer size if necessary. */
 			if (filenameSize < entry.filenameLength + 1)  {
 				if (freeFilename) {
@@ -904,7 +930,9 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 				current = buffer;
 			}
 			filename[entry.filenameLength] = '\0';  /* null-terminate */
+			elementName = filename;
 
+haveElementName:
 			if (((entry.compressionMethod == ZIP_CM_Deflated)&&(entry.flags & 0x8))
 				|| (entry.fileCommentLength != 0))  {
 				/* Either local header doesn't know the compressedSize, or this entry has a file
@@ -912,10 +940,10 @@ static I_32 zip_populateCache(J9PortLibrary* portLib, J9ZipFile *zipFile, J9ZipC
 					so we can find the information we need later. */
 
 				/* zipCache_addElement returns BOOLEAN */
-				result = (I_32)zipCache_addElement(zipFile->cache, (char*)filename, (IDATA)entry.filenameLength, entryPointer);
+				result = (I_32)zipCache_addElement(zipFile->cache, (char*)elementName, (IDATA)entry.filenameLength, entryPointer);
 
 			} else  {
-				result = (I_32)zipCache_addElement(zipFile->cache, (char*)filename, (IDATA)entry.filenameLength, localHeaderOffset);
+				result = (I_32)zipCache_addElement(zipFile->cache, (char*)elementName, (IDATA)entry.filenameLength, localHeaderOffset);
 			}
 
 			if (!result)  {
@@ -1838,6 +1866,7 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 
 	I_32 result;
 	U_8* dataBuffer;
+	U_8* mappedData = NULL;
 	struct workBuffer wb;
 	I_64 seekResult;
 
@@ -1869,8 +1898,16 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 		entry->data = dataBuffer;
 	}
 
+	mappedData = getMappedEntryData(portLib, zipFile, entry);
+
 	if(entry->compressionMethod == ZIP_CM_Stored) {
 		IDATA readResult = 0;
+		if (NULL != mappedData) {
+			/* No compression and the file is mapped - copy straight out of the mapping. */
+			memcpy(dataBuffer, mappedData, entry->compressedSize);
+			EXIT();
+			return 0;
+		}
 		/* No compression - just read the data in. */
 		if (zipFile->pointer != entry->dataPointer)  {
 			zipFile->pointer = (U_32) entry->dataPointer;
@@ -1894,6 +1931,14 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 	if(entry->compressionMethod == ZIP_CM_Deflated) {
 		U_8* readBuffer;
 
+		if (NULL != mappedData) {
+			/* Inflate straight from the mapping into the destination, without staging the compressed bytes. */
+			result = inflateData(&wb, mappedData, entry->compressedSize, dataBuffer, entry->uncompressedSize);
+			if(result)  goto finished;
+			EXIT();
+			return 0;
+		}
+
 		/* Read the file contents. */
 		if (entry->compressedSize < ZIP_WORK_BUFFER_SIZE) {
 			J9ZipCachePool *cachePool = zipFile->cachePool;
@@ -1952,6 +1997,116 @@ finished:
 	return result;
 }
 
+
+/**
+ * Answer the address of the data for entry within a read-only mapping of the whole zip file.
+ * The mapping is created on first use and belongs to the zip cache, so it is shared by every
+ * J9ZipFile opened on the same cache and released in zipCache_kill(). Zip files opened without
+ * a cache are never mapped, and neither are zip files on Windows, where a mapped file cannot be
+ * replaced or deleted.
+ *
+ * Touching a mapped page past the end of a truncated file raises SIGBUS, so the file is validated
+ * rather than trusted. zip_openZipFile() only reuses a cache whose size and time stamp match the
+ * file on disk, and the file length is checked against the cache once more when the mapping is
+ * created. Reads through the mapping then make no further system calls.
+ *
+ * Must be called inside ENTER()/EXIT().
+ *
+ * @param[in] portLib the port library
+ * @param[in] zipFile the zip file being read from
+ * @param[in] entry the zip entry, which must have a valid dataPointer
+ *
+ * @return the address of the (possibly compressed) entry data, or NULL if the data is not available from a mapping
+ */
+static U_8 *
+getMappedEntryData(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *entry)
+{
+#if defined(WIN32)
+	return NULL;
+#else /* defined(WIN32) */
+	PORT_ACCESS_FROM_PORT(portLib);
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipFile->cache;
+
+	if ((NULL == zci) || (NULL == zipFile->cachePool) || (0 == entry->dataPointer) || (-1 == zipFile->fd)) {
+		return NULL;
+	}
+
+	if (!zci->mapAttempted) {
+		IDATA zipFileSize = zci->entry->zipFileSize;
+
+		zci->mapAttempted = TRUE;
+		if ((zipFileSize > 0)
+			&& (j9file_flength(zipFile->fd) == (I_64)zipFileSize)
+			&& J9_ARE_ALL_BITS_SET(j9mmap_capabilities(), J9PORT_MMAP_CAPABILITY_READ)
+		) {
+			J9MmapHandle *handle = j9mmap_map_file(zipFile->fd, 0, (UDATA)zipFileSize, (const char *)zipFile->filename, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_VM_JCL);
+			if (NULL != handle) {
+				if (NULL != handle->pointer) {
+					zci->mappedFile = handle;
+					zci->mappedFileSize = zipFileSize;
+				} else {
+					j9mmap_unmap_file(handle);
+				}
+			}
+		}
+	}
+
+	if (NULL == zci->mappedFile) {
+		return NULL;
+	}
+
+	/* The entry must lie entirely within the mapping */
+	if (((U_64)entry->dataPointer + entry->compressedSize) > (U_64)zci->mappedFileSize) {
+		return NULL;
+	}
+	return (U_8 *)zci->mappedFile->pointer + entry->dataPointer;
+#endif /* defined(WIN32) */
+}
+
+/**
+ * Answer a pointer to the uncompressed data of a stored (not compressed) entry without copying it.
+ * The data is read directly from a read-only mapping of the zip file and must not be modified. The
+ * pointer remains valid until the zip file's cache is released, i.e. until the last zip file opened
+ * on the cache has been released with @ref zip_releaseZipFile. A jar replaced on disk by a new file
+ * leaves the mapped file intact; a jar truncated in place invalidates the pointer, so callers must
+ * consume the data right away rather than retain it.
+ *
+ * Callers must fall back to @ref zip_getZipEntryData if this call fails.
+ *
+ * @param[in] portLib the port library
+ * @param[in] zipFile the zip file being read from
+ * @param[in] entry the zip entry, read with its data pointer
+ * @param[out] data receives the address of the entry data
+ *
+ * @return 0 on success
+ * @return	ZIP_ERR_UNSUPPORTED_FILE_TYPE if the entry is compressed or the zip file is not mapped
+ * @return	ZIP_ERR_FILE_CORRUPT if the stored entry sizes disagree
+ *
+ * @see zip_getZipEntryData
+*/
+I_32 zip_getZipEntryDataPointer(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8** data)
+{
+	I_32 result = ZIP_ERR_UNSUPPORTED_FILE_TYPE;
+	U_8 *mappedData = NULL;
+
+	ENTER();
+
+	if (ZIP_CM_Stored == entry->compressionMethod) {
+		if (entry->compressedSize != entry->uncompressedSize) {
+			result = ZIP_ERR_FILE_CORRUPT;
+		} else {
+			mappedData = getMappedEntryData(portLib, zipFile, entry);
+			if (NULL != mappedData) {
+				*data = mappedData;
+				result = 0;
+			}
+		}
+	}
+
+	EXIT();
+	return result;
+}
+
 /** 
  *	Attempt to read the raw data for the zip entry entry.
  * 
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Measures New/DeleteGlobalRef and New/DeleteWeakGlobalRef from one thread
+ * and from several threads at once, where the threads contend on the VM's
+ * global reference storage.
+ */
+public class JNIGlobalRef {
+
+	private static Logger logger = Logger.getLogger(JNIGlobalRef.class);
+	Timer timer;
+
+	static {
+		try {
+			System.loadLibrary("j9ben");
+		} catch (UnsatisfiedLinkError e) {}
+	}
+
+	public JNIGlobalRef() {
+		timer = new Timer ();
+	}
+
+	static final int loopCount = 100000;
+	static final int threadCount = 8;
+
+	public native void globalReference(Object o1, int loopCount);
+	public native void weakGlobalReference(Object o1, int loopCount);
+
+	private void runThreads(final boolean weak, final Object o1) throws InterruptedException {
+		Thread[] threads = new Thread[threadCount];
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = new Thread() {
+				public void run() {
+					if (weak) {
+						weakGlobalReference(o1, loopCount);
+					} else {
+						globalReference(o1, loopCount);
+					}
+				}
+			};
+		}
+		timer.reset();
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].start();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].join();
+		}
+		timer.mark();
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testJNIGlobalRef() throws InterruptedException
+	{
+		Object o1 = new Integer(0);
+
+		try
+		{
+			globalReference(o1, 1);
+			weakGlobalReference(o1, 1);
+		} catch (UnsatisfiedLinkError e) {
+			Assert.fail("No natives for JNI tests");
+		}
+
+		timer.reset();
+		globalReference(o1, loopCount);
+		timer.mark();
+		logger.info(loopCount + " New/DeleteGlobalRef calls (on 8 objects) = " + timer.delta());
+
+		timer.reset();
+		weakGlobalReference(o1, loopCount);
+		timer.mark();
+		logger.info(loopCount + " New/DeleteWeakGlobalRef calls (on 8 objects) = " + timer.delta());
+
+		runThreads(false, o1);
+		logger.info(threadCount + " threads x " + loopCount + " New/DeleteGlobalRef calls (on 8 objects) = " + timer.delta());
+
+		runThreads(true, o1);
+		logger.info(threadCount + " threads x " + loopCount + " New/DeleteWeakGlobalRef calls (on 8 objects) = " + timer.delta());
+	}
+}
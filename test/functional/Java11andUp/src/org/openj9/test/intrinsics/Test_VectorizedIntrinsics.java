@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package org.openj9.test.intrinsics;
+
+import java.util.Arrays;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+
+/**
+ * Checks String.hashCode and Arrays.equals/mismatch, which the JIT replaces with
+ * vector sequences on x, p and z, against plain Java loops for every length and
+ * mismatch position around the vector widths, then reports their throughput.
+ */
+@Test(groups = { "level.sanity" })
+public class Test_VectorizedIntrinsics {
+	public static Logger logger = Logger.getLogger(Test_VectorizedIntrinsics.class);
+
+	private static final int MAX_LENGTH = 80;
+	private static final int WARMUP = 20;
+	private static final int ITERATIONS = 100000;
+	private static final int BATCH = 1000;
+
+	private static int javaHashCode(String s) {
+		int hash = 0;
+		for (int i = 0; i < s.length(); ++i) {
+			hash = (31 * hash) + s.charAt(i);
+		}
+		return hash;
+	}
+
+	private static int javaMismatch(long[] a, long[] b, int length) {
+		for (int i = 0; i < length; ++i) {
+			if (a[i] != b[i]) {
+				return i;
+			}
+		}
+		return (a.length == b.length) ? -1 : length;
+	}
+
+	private static String string(char base, int length) {
+		StringBuilder builder = new StringBuilder(length);
+		for (int i = 0; i < length; ++i) {
+			builder.append((char)(base + ((i * 7) % 61)));
+		}
+		return builder.toString();
+	}
+
+	private static void verifyHashCode(char base) {
+		for (int length = 0; length < MAX_LENGTH; ++length) {
+			String s = string(base, length);
+			/* Each suffix is copied into a new array, so this shifts the contents seen by each vector block, not the alignment */
+			for (int offset = 0; offset < Math.min(length, 17); ++offset) {
+				String sub = new String(s.substring(offset).toCharArray());
+				Assert.assertEquals(sub.hashCode(), javaHashCode(sub), "hashCode of \"" + sub + "\"");
+			}
+		}
+	}
+
+	@Test
+	public static void testHashCodeLatin1() {
+		for (int i = 0; i < WARMUP; ++i) {
+			verifyHashCode('!');
+			/* bytes with the top bit set must not be sign extended */
+			verifyHashCode('\u00a0');
+		}
+	}
+
+	@Test
+	public static void testHashCodeUTF16() {
+		for (int i = 0; i < WARMUP; ++i) {
+			verifyHashCode('\u0400');
+			verifyHashCode('\uff00');
+		}
+	}
+
+	@Test
+	public static void testByteMismatch() {
+		for (int i = 0; i < WARMUP; ++i) {
+			for (int length = 0; length < MAX_LENGTH; ++length) {
+				byte[] a = new byte[length];
+				for (int j = 0; j < length; ++j) {
+					a[j] = (byte)(j * 37);
+				}
+				byte[] b = a.clone();
+				Assert.assertEquals(Arrays.mismatch(a, b), -1);
+				Assert.assertTrue(Arrays.equals(a, b));
+				for (int position = 0; position < length; ++position) {
+					b[position] ^= (byte)0x80;
+					Assert.assertEquals(Arrays.mismatch(a, b), position, "byte[" + length + "]");
+					Assert.assertFalse(Arrays.equals(a, b));
+					b[position] = a[position];
+				}
+				Assert.assertEquals(Arrays.mismatch(a, Arrays.copyOf(a, length + 1)), length);
+			}
+		}
+	}
+
+	@Test
+	public static void testCharMismatch() {
+		for (int i = 0; i < WARMUP; ++i) {
+			for (int length = 0; length < MAX_LENGTH; ++length) {
+				char[] a = string('\u4e00', length).toCharArray();
+				char[] b = a.clone();
+				Assert.assertEquals(Arrays.mismatch(a, b), -1);
+				for (int position = 0; position < length; ++position) {
+					/* differ only in the high byte */
+					b[position] ^= 0x100;
+					Assert.assertEquals(Arrays.mismatch(a, b), position, "char[" + length + "]");
+					Assert.assertFalse(Arrays.equals(a, b));
+					b[position] = a[position];
+				}
+			}
+		}
+	}
+
+	@Test
+	public static void testLongMismatch() {
+		for (int i = 0; i < WARMUP; ++i) {
+			for (int length = 0; length < MAX_LENGTH / 4; ++length) {
+				long[] a = new long[length];
+				for (int j = 0; j < length; ++j) {
+					a[j] = j * 0x0101010101010101L;
+				}
+				long[] b = a.clone();
+				Assert.assertEquals(Arrays.mismatch(a, b), javaMismatch(a, b, length));
+				for (int position = 0; position < length; ++position) {
+					b[position] ^= 1L << 63;
+					Assert.assertEquals(Arrays.mismatch(a, b), position, "long[" + length + "]");
+					b[position] = a[position];
+				}
+			}
+		}
+	}
+
+	@Test
+	public static void testBenchmark() {
+		char[] latin1 = string('!', 1024).toCharArray();
+		char[] utf16 = string('\u0400', 1024).toCharArray();
+		byte[] a = new String(latin1).getBytes();
+		byte[] b = a.clone();
+		String[] strings = new String[BATCH];
+		long sink = 0;
+
+		for (int warmup = 0; warmup < 2; ++warmup) {
+			long hashCode = 0;
+			for (int round = 0; round < (ITERATIONS / BATCH); ++round) {
+				/* Strings built from arrays have no hash cached yet; building them is not timed */
+				for (int i = 0; i < BATCH; ++i) {
+					strings[i] = new String(((i & 1) == 0) ? latin1 : utf16);
+				}
+				long start = System.nanoTime();
+				for (int i = 0; i < BATCH; ++i) {
+					sink += strings[i].hashCode();
+				}
+				hashCode += System.nanoTime() - start;
+			}
+
+			long start = System.nanoTime();
+			for (int i = 0; i < ITERATIONS; ++i) {
+				sink += Arrays.mismatch(a, b);
+			}
+			long mismatch = System.nanoTime() - start;
+
+			logger.info("Test_VectorizedIntrinsics String.hashCode(1024 chars): " + (hashCode / ITERATIONS) + " ns/op, Arrays.mismatch(byte[1024]): " + (mismatch / ITERATIONS) + " ns/op");
+		}
+		Assert.assertNotEquals(sink, 0);
+	}
+}
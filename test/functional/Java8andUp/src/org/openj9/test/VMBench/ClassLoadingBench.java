@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package org.openj9.test.VMBench;
+
+import java.io.ByteArrayOutputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.util.concurrent.atomic.AtomicReference;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+
+/**
+ * Measures a parallel capable class loader defining independent classes from
+ * several threads at once, and then looking them all up from every thread.
+ * Checks that every name resolves to the one class defined for it. Run with
+ * -XX:-FastClassHashTable to compare with lookups under the class table lock.
+ */
+@Test(groups = { "level.sanity" })
+public class ClassLoadingBench {
+
+	public static final Logger logger = Logger.getLogger(ClassLoadingBench.class);
+
+	private static final String PACKAGE = "org.openj9.test.VMBench.generated";
+	private static final int CLASSES_PER_THREAD = 2000;
+	private static final int LOOKUP_ITERATIONS = 20;
+
+	private static final class BenchLoader extends ClassLoader {
+		static {
+			registerAsParallelCapable();
+		}
+
+		BenchLoader() {
+			super(ClassLoadingBench.class.getClassLoader());
+		}
+
+		@Override
+		protected Class<?> findClass(String name) throws ClassNotFoundException {
+			if (!name.startsWith(PACKAGE + ".")) {
+				throw new ClassNotFoundException(name);
+			}
+			byte[] bytes = classBytes(name.replace('.', '/'));
+			return defineClass(name, bytes, 0, bytes.length);
+		}
+	}
+
+	/* A public class with no members, which needs neither methods nor verification */
+	private static byte[] classBytes(String internalName) {
+		try {
+			ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+			DataOutputStream out = new DataOutputStream(bytes);
+			out.writeInt(0xCAFEBABE);
+			out.writeShort(0);
+			out.writeShort(50);
+			out.writeShort(5);
+			out.writeByte(1);
+			out.writeUTF(internalName);
+			out.writeByte(7);
+			out.writeShort(1);
+			out.writeByte(1);
+			out.writeUTF("java/lang/Object");
+			out.writeByte(7);
+			out.writeShort(3);
+			out.writeShort(0x0021);
+			out.writeShort(2);
+			out.writeShort(4);
+			out.writeShort(0);
+			out.writeShort(0);
+			out.writeShort(0);
+			out.writeShort(0);
+			out.close();
+			return bytes.toByteArray();
+		} catch (IOException e) {
+			throw new RuntimeException(e);
+		}
+	}
+
+	private static String className(int run, int thread, int index) {
+		return PACKAGE + ".R" + run + "T" + thread + "C" + index;
+	}
+
+	private interface Task {
+		void run(int thread) throws Exception;
+	}
+
+	private static long runThreads(int threadCount, final Task task) throws Exception {
+		final AtomicReference<Throwable> failure = new AtomicReference<Throwable>();
+		Thread[] threads = new Thread[threadCount];
+		for (int i = 0; i < threadCount; ++i) {
+			final int thread = i;
+			threads[i] = new Thread() {
+				@Override
+				public void run() {
+					try {
+						task.run(thread);
+					} catch (Throwable t) {
+						failure.compareAndSet(null, t);
+					}
+				}
+			};
+		}
+		long start = System.nanoTime();
+		for (Thread thread : threads) {
+			thread.start();
+		}
+		for (Thread thread : threads) {
+			thread.join();
+		}
+		long stop = System.nanoTime();
+		if (null != failure.get()) {
+			throw new AssertionError("class loading thread failed", failure.get());
+		}
+		return stop - start;
+	}
+
+	private static void measure(final int run, final int threadCount) throws Exception {
+		final BenchLoader loader = new BenchLoader();
+		final Class<?>[][] defined = new Class<?>[threadCount][CLASSES_PER_THREAD];
+
+		long defineTime = runThreads(threadCount, new Task() {
+			@Override
+			public void run(int thread) throws Exception {
+				for (int i = 0; i < CLASSES_PER_THREAD; ++i) {
+					defined[thread][i] = Class.forName(className(run, thread, i), false, loader);
+				}
+			}
+		});
+
+		long lookupTime = runThreads(threadCount, new Task() {
+			@Override
+			public void run(int thread) throws Exception {
+				for (int iteration = 0; iteration < LOOKUP_ITERATIONS; ++iteration) {
+					for (int owner = 0; owner < threadCount; ++owner) {
+						int index = (thread + iteration) % CLASSES_PER_THREAD;
+						for (int i = 0; i < CLASSES_PER_THREAD; i += 7) {
+							Class<?> found = Class.forName(className(run, owner, index), false, loader);
+							if (found != defined[owner][index]) {
+								throw new AssertionError("lookup of " + className(run, owner, index) + " found a different class");
+							}
+							index = (index + 7) % CLASSES_PER_THREAD;
+						}
+					}
+				}
+			}
+		});
+
+		int classes = threadCount * CLASSES_PER_THREAD;
+		int lookups = threadCount * LOOKUP_ITERATIONS * threadCount * ((CLASSES_PER_THREAD + 6) / 7);
+		logger.info("ClassLoadingBench " + threadCount + " threads: " + (defineTime / classes) + " ns/class defined, "
+				+ (lookupTime / lookups) + " ns/lookup");
+
+		for (int thread = 0; thread < threadCount; ++thread) {
+			for (int i = 0; i < CLASSES_PER_THREAD; ++i) {
+				Class<?> clazz = defined[thread][i];
+				Assert.assertEquals(clazz.getName(), className(run, thread, i));
+				Assert.assertSame(clazz.getClassLoader(), loader);
+			}
+		}
+	}
+
+	@Test
+	public static void testParallelDefine() throws Exception {
+		int threadCount = Math.max(2, Math.min(8, Runtime.getRuntime().availableProcessors()));
+		int run = 0;
+		for (int warmup = 0; warmup < 2; ++warmup) {
+			measure(run++, 1);
+			measure(run++, threadCount);
+		}
+	}
+
+}
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+package org.openj9.test.VMBench;
+
+import java.lang.management.ManagementFactory;
+import java.lang.reflect.Field;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+
+import sun.misc.Unsafe;
+
+/**
+ * Measures a loop over wide objects whose frequently used fields are declared
+ * last. Run with -XX:FieldLayoutHints=fieldLayout.hints, which names those
+ * fields as hot, to compare against the default layout. Also checks that every
+ * field keeps its value, and that the hinted fields come first when hints are
+ * in effect.
+ */
+@Test(groups = { "level.sanity" })
+public class FieldLayoutBench {
+
+	public static final Logger logger = Logger.getLogger(FieldLayoutBench.class);
+
+	private static final int OBJECTS = 1 << 16;
+	private static final int ITERATIONS = 200;
+
+	static final class WideObject {
+		long cold0, cold1, cold2, cold3, cold4, cold5, cold6, cold7;
+		Object ref0, ref1, ref2, ref3, ref4, ref5, ref6, ref7;
+		int int0, int1, int2, int3, int4, int5, int6, int7;
+		/* Named in fieldLayout.hints */
+		long hotTotal;
+		Object hotNext;
+		int hotCount;
+
+		WideObject(int seed) {
+			cold0 = seed; cold1 = seed + 1; cold2 = seed + 2; cold3 = seed + 3;
+			cold4 = seed + 4; cold5 = seed + 5; cold6 = seed + 6; cold7 = seed + 7;
+			ref0 = "0"; ref1 = "1"; ref2 = "2"; ref3 = "3"; ref4 = "4"; ref5 = "5"; ref6 = "6"; ref7 = "7";
+			int0 = -seed; int1 = -seed - 1; int2 = -seed - 2; int3 = -seed - 3;
+			int4 = -seed - 4; int5 = -seed - 5; int6 = -seed - 6; int7 = -seed - 7;
+			hotTotal = (long)seed << 32;
+			hotCount = seed;
+		}
+
+		long coldSum() {
+			return cold0 + cold1 + cold2 + cold3 + cold4 + cold5 + cold6 + cold7
+					+ int0 + int1 + int2 + int3 + int4 + int5 + int6 + int7;
+		}
+
+		String refs() {
+			return "" + ref0 + ref1 + ref2 + ref3 + ref4 + ref5 + ref6 + ref7;
+		}
+	}
+
+	private static boolean hintsInEffect() {
+		for (String argument : ManagementFactory.getRuntimeMXBean().getInputArguments()) {
+			if (argument.startsWith("-XX:FieldLayoutHints=")) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	private static Unsafe getUnsafe() throws Exception {
+		Field field = Unsafe.class.getDeclaredField("theUnsafe");
+		field.setAccessible(true);
+		return (Unsafe)field.get(null);
+	}
+
+	private static long offset(Unsafe unsafe, String name) throws Exception {
+		return unsafe.objectFieldOffset(WideObject.class.getDeclaredField(name));
+	}
+
+	@Test
+	public static void testFieldValues() {
+		for (int seed = 0; seed < 1000; ++seed) {
+			WideObject object = new WideObject(seed);
+			object.hotNext = object;
+			Assert.assertEquals(object.coldSum(), 0L);
+			Assert.assertEquals(object.refs(), "01234567");
+			Assert.assertEquals(object.hotTotal, (long)seed << 32);
+			Assert.assertEquals(object.hotCount, seed);
+			Assert.assertSame(object.hotNext, object);
+		}
+	}
+
+	@Test
+	public static void testHotFieldOffsets() throws Exception {
+		Unsafe unsafe = getUnsafe();
+		long hotTotal = offset(unsafe, "hotTotal");
+		long hotNext = offset(unsafe, "hotNext");
+		long hotCount = offset(unsafe, "hotCount");
+		logger.info("FieldLayoutBench offsets hotTotal=" + hotTotal + " hotNext=" + hotNext + " hotCount=" + hotCount);
+
+		if (hintsInEffect()) {
+			for (int i = 0; i < 8; ++i) {
+				Assert.assertTrue(hotTotal < offset(unsafe, "cold" + i), "hotTotal follows cold" + i);
+				Assert.assertTrue(hotNext < offset(unsafe, "ref" + i), "hotNext follows ref" + i);
+			}
+			/* int0 may instead occupy a backfill slot ahead of all the fields */
+			for (int i = 1; i < 8; ++i) {
+				Assert.assertTrue(hotCount < offset(unsafe, "int" + i), "hotCount follows int" + i);
+			}
+		}
+	}
+
+	@Test
+	public static void testBenchmark() {
+		WideObject[] objects = new WideObject[OBJECTS];
+		for (int i = 0; i < OBJECTS; ++i) {
+			objects[i] = new WideObject(i);
+		}
+		for (int i = 0; i < OBJECTS; ++i) {
+			objects[i].hotNext = objects[(i * 7919) & (OBJECTS - 1)];
+		}
+
+		long total = 0;
+		for (int warmup = 0; warmup < 2; ++warmup) {
+			long start = System.nanoTime();
+			for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+				for (WideObject object : objects) {
+					WideObject next = (WideObject)object.hotNext;
+					object.hotCount += 1;
+					total += next.hotTotal + next.hotCount;
+				}
+			}
+			long stop = System.nanoTime();
+			logger.info("FieldLayoutBench " + (hintsInEffect() ? "hinted" : "default") + " layout: "
+					+ ((stop - start) / ((long)ITERATIONS * OBJECTS)) + " ns/object");
+		}
+		Assert.assertTrue(total != 0);
+	}
+
+}
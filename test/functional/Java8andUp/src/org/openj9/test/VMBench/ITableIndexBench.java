@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package org.openj9.test.VMBench;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+
+/**
+ * Measures megamorphic invokeinterface on receiver classes which implement
+ * 24 interfaces, where consecutive sends use different interfaces so that
+ * the last iTable cache of the receiver class rarely hits. Also checks that
+ * each send and instanceof reaches the right implementation. Run with
+ * -XX:ITableIndexThreshold=0 to compare with walking the iTable list.
+ */
+@Test(groups = { "level.sanity" })
+public class ITableIndexBench {
+
+	public static final Logger logger = Logger.getLogger(ITableIndexBench.class);
+
+	private static final int INTERFACES = 24;
+	private static final int WARMUP_ITERATIONS = 20000;
+	private static final int ITERATIONS = 100000;
+
+	interface I0 { int m0(); }
+	interface I1 { int m1(); }
+	interface I2 { int m2(); }
+	interface I3 { int m3(); }
+	interface I4 { int m4(); }
+	interface I5 { int m5(); }
+	interface I6 { int m6(); }
+	interface I7 { int m7(); }
+	interface I8 { int m8(); }
+	interface I9 { int m9(); }
+	interface I10 { int m10(); }
+	interface I11 { int m11(); }
+	interface I12 { int m12(); }
+	interface I13 { int m13(); }
+	interface I14 { int m14(); }
+	interface I15 { int m15(); }
+	interface I16 { int m16(); }
+	interface I17 { int m17(); }
+	interface I18 { int m18(); }
+	interface I19 { int m19(); }
+	interface I20 { int m20(); }
+	interface I21 { int m21(); }
+	interface I22 { int m22(); }
+	interface I23 { int m23(); }
+
+	static abstract class Base implements I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15, I16, I17, I18, I19, I20, I21, I22, I23 {
+		private final int bias;
+
+		Base(int bias) {
+			this.bias = bias;
+		}
+
+		public int m0() { return 0 + bias; }
+		public int m1() { return 1 + bias; }
+		public int m2() { return 2 + bias; }
+		public int m3() { return 3 + bias; }
+		public int m4() { return 4 + bias; }
+		public int m5() { return 5 + bias; }
+		public int m6() { return 6 + bias; }
+		public int m7() { return 7 + bias; }
+		public int m8() { return 8 + bias; }
+		public int m9() { return 9 + bias; }
+		public int m10() { return 10 + bias; }
+		public int m11() { return 11 + bias; }
+		public int m12() { return 12 + bias; }
+		public int m13() { return 13 + bias; }
+		public int m14() { return 14 + bias; }
+		public int m15() { return 15 + bias; }
+		public int m16() { return 16 + bias; }
+		public int m17() { return 17 + bias; }
+		public int m18() { return 18 + bias; }
+		public int m19() { return 19 + bias; }
+		public int m20() { return 20 + bias; }
+		public int m21() { return 21 + bias; }
+		public int m22() { return 22 + bias; }
+		public int m23() { return 23 + bias; }
+	}
+
+	/* Distinct receiver classes make every call site megamorphic. Each inherits the iTables of Base. */
+	static final class R0 extends Base { R0() { super(0); } }
+	static final class R1 extends Base { R1() { super(100); } }
+	static final class R2 extends Base { R2() { super(200); } }
+	static final class R3 extends Base { R3() { super(300); } }
+
+	/* Every call site uses a different interface of the same receiver */
+	private static int allInterfaces(Base receiver) {
+		I0 i0 = receiver;
+		I1 i1 = receiver;
+		I2 i2 = receiver;
+		I3 i3 = receiver;
+		I4 i4 = receiver;
+		I5 i5 = receiver;
+		I6 i6 = receiver;
+		I7 i7 = receiver;
+		I8 i8 = receiver;
+		I9 i9 = receiver;
+		I10 i10 = receiver;
+		I11 i11 = receiver;
+		I12 i12 = receiver;
+		I13 i13 = receiver;
+		I14 i14 = receiver;
+		I15 i15 = receiver;
+		I16 i16 = receiver;
+		I17 i17 = receiver;
+		I18 i18 = receiver;
+		I19 i19 = receiver;
+		I20 i20 = receiver;
+		I21 i21 = receiver;
+		I22 i22 = receiver;
+		I23 i23 = receiver;
+		return i0.m0() + i1.m1() + i2.m2() + i3.m3() + i4.m4() + i5.m5()
+				+ i6.m6() + i7.m7() + i8.m8() + i9.m9() + i10.m10() + i11.m11()
+				+ i12.m12() + i13.m13() + i14.m14() + i15.m15() + i16.m16() + i17.m17()
+				+ i18.m18() + i19.m19() + i20.m20() + i21.m21() + i22.m22() + i23.m23();
+	}
+
+	private static long expected(Base[] receivers) {
+		long sum = 0;
+		for (Base receiver : receivers) {
+			sum += (INTERFACES * (INTERFACES - 1)) / 2 + INTERFACES * receiver.bias;
+		}
+		return sum;
+	}
+
+	private static long measure(Base[] receivers, int iterations) {
+		long sum = 0;
+		for (int i = 0; i < iterations; ++i) {
+			for (Base receiver : receivers) {
+				sum += allInterfaces(receiver);
+			}
+		}
+		return sum;
+	}
+
+	@Test
+	public static void testMegamorphicManyInterfaces() {
+		Base[] receivers = { new R0(), new R1(), new R2(), new R3() };
+		long perIteration = expected(receivers);
+
+		Assert.assertEquals(measure(receivers, WARMUP_ITERATIONS), perIteration * WARMUP_ITERATIONS);
+		for (int warmup = 0; warmup < 2; ++warmup) {
+			long start = System.nanoTime();
+			long sum = measure(receivers, ITERATIONS);
+			long stop = System.nanoTime();
+			Assert.assertEquals(sum, perIteration * ITERATIONS);
+			logger.info("ITableIndexBench " + INTERFACES + " interfaces, " + receivers.length + " classes: "
+					+ ((stop - start) / ((long)ITERATIONS * receivers.length * INTERFACES)) + " ns/call");
+		}
+	}
+
+	@Test
+	public static void testInstanceOf() {
+		Object receiver = new R3();
+		Assert.assertTrue(receiver instanceof I0);
+		Assert.assertTrue(receiver instanceof I1);
+		Assert.assertTrue(receiver instanceof I2);
+		Assert.assertTrue(receiver instanceof I3);
+		Assert.assertTrue(receiver instanceof I4);
+		Assert.assertTrue(receiver instanceof I5);
+		Assert.assertTrue(receiver instanceof I6);
+		Assert.assertTrue(receiver instanceof I7);
+		Assert.assertTrue(receiver instanceof I8);
+		Assert.assertTrue(receiver instanceof I9);
+		Assert.assertTrue(receiver instanceof I10);
+		Assert.assertTrue(receiver instanceof I11);
+		Assert.assertTrue(receiver instanceof I12);
+		Assert.assertTrue(receiver instanceof I13);
+		Assert.assertTrue(receiver instanceof I14);
+		Assert.assertTrue(receiver instanceof I15);
+		Assert.assertTrue(receiver instanceof I16);
+		Assert.assertTrue(receiver instanceof I17);
+		Assert.assertTrue(receiver instanceof I18);
+		Assert.assertTrue(receiver instanceof I19);
+		Assert.assertTrue(receiver instanceof I20);
+		Assert.assertTrue(receiver instanceof I21);
+		Assert.assertTrue(receiver instanceof I22);
+		Assert.assertTrue(receiver instanceof I23);
+		Assert.assertFalse(receiver instanceof Runnable);
+	}
+
+}
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package org.openj9.test.VMBench;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+
+/**
+ * Measures interpreted invokeinterface where one receiver class implements
+ * several interfaces which are called alternately, and where call sites see
+ * two or more receiver classes. Also checks that each call reaches the right
+ * implementation. Run with -Xint, and with -XX:InterfaceCallSiteCacheSize=0
+ * to compare with dispatch through the iTable search alone.
+ */
+@Test(groups = { "level.sanity" })
+public class InterfaceDispatchBench {
+
+	public static final Logger logger = Logger.getLogger(InterfaceDispatchBench.class);
+
+	private static final int WARMUP_ITERATIONS = 20000;
+	private static final int ITERATIONS = 200000;
+
+	interface I0 { int m0(); }
+	interface I1 { int m1(); }
+	interface I2 { int m2(); }
+	interface I3 { int m3(); }
+	interface I4 { int m4(); }
+	interface I5 { int m5(); }
+	interface I6 { int m6(); }
+	interface I7 { int m7(); }
+
+	static class Many implements I0, I1, I2, I3, I4, I5, I6, I7 {
+		public int m0() { return 0; }
+		public int m1() { return 1; }
+		public int m2() { return 2; }
+		public int m3() { return 3; }
+		public int m4() { return 4; }
+		public int m5() { return 5; }
+		public int m6() { return 6; }
+		public int m7() { return 7; }
+	}
+
+	static class A implements I0 {
+		public int m0() { return 10; }
+	}
+
+	static class B extends A {
+		public int m0() { return 20; }
+	}
+
+	static class C implements I0 {
+		public int m0() { return 30; }
+	}
+
+	/* Every call site uses a different interface of the same receiver class */
+	private static int manyInterfaces(Many receiver) {
+		I0 i0 = receiver;
+		I1 i1 = receiver;
+		I2 i2 = receiver;
+		I3 i3 = receiver;
+		I4 i4 = receiver;
+		I5 i5 = receiver;
+		I6 i6 = receiver;
+		I7 i7 = receiver;
+		return i0.m0() + i1.m1() + i2.m2() + i3.m3() + i4.m4() + i5.m5() + i6.m6() + i7.m7();
+	}
+
+	/* One call site which sees each of the receivers */
+	private static int polymorphic(I0[] receivers) {
+		int sum = 0;
+		for (I0 receiver : receivers) {
+			sum += receiver.m0();
+		}
+		return sum;
+	}
+
+	private static long measureManyInterfaces(int iterations) {
+		Many receiver = new Many();
+		long sum = 0;
+		for (int i = 0; i < iterations; ++i) {
+			sum += manyInterfaces(receiver);
+		}
+		return sum;
+	}
+
+	private static long measurePolymorphic(I0[] receivers, int iterations) {
+		long sum = 0;
+		for (int i = 0; i < iterations; ++i) {
+			sum += polymorphic(receivers);
+		}
+		return sum;
+	}
+
+	@Test
+	public static void testManyInterfaces() {
+		Assert.assertEquals(measureManyInterfaces(WARMUP_ITERATIONS), 28L * WARMUP_ITERATIONS);
+		long start = System.nanoTime();
+		long sum = measureManyInterfaces(ITERATIONS);
+		long stop = System.nanoTime();
+		Assert.assertEquals(sum, 28L * ITERATIONS);
+		logger.info("InterfaceDispatchBench 8 interfaces, 1 class: " + ((stop - start) / (ITERATIONS * 8L)) + " ns/call");
+	}
+
+	@Test
+	public static void testPolymorphicCallSites() {
+		I0[] bimorphic = { new A(), new B(), new A(), new B() };
+		I0[] megamorphic = { new A(), new B(), new C(), new Many() };
+
+		for (int warmup = 0; warmup < 2; ++warmup) {
+			long start = System.nanoTime();
+			long sum = measurePolymorphic(bimorphic, ITERATIONS);
+			long bimorphicTime = System.nanoTime() - start;
+			Assert.assertEquals(sum, 60L * ITERATIONS);
+
+			start = System.nanoTime();
+			sum = measurePolymorphic(megamorphic, ITERATIONS);
+			long megamorphicTime = System.nanoTime() - start;
+			Assert.assertEquals(sum, 60L * ITERATIONS);
+
+			logger.info("InterfaceDispatchBench bimorphic: " + (bimorphicTime / (ITERATIONS * 4L)) + " ns/call, megamorphic: "
+					+ (megamorphicTime / (ITERATIONS * 4L)) + " ns/call");
+		}
+	}
+
+}
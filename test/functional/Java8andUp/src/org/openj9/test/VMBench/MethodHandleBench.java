@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+package org.openj9.test.VMBench;
+
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+
+/**
+ * Measures interpreted invocations of permute and asType MethodHandle chains,
+ * whose argument shuffles are precomputed when the handles are created, and
+ * checks that arguments of every slot size arrive in the right order.
+ * Run with -Xint to keep the JIT from compiling the chains.
+ */
+@Test(groups = { "level.sanity" })
+public class MethodHandleBench {
+
+	public static final Logger logger = Logger.getLogger(MethodHandleBench.class);
+
+	private static final int ITERATIONS = 200000;
+
+	private static String mixed(int i, long l, double d, Object o) {
+		return i + ":" + l + ":" + d + ":" + o;
+	}
+
+	private static long sum(long l, int i, long m) {
+		return l + i + m;
+	}
+
+	private static MethodHandle findStatic(String name, MethodType type) throws Throwable {
+		return MethodHandles.lookup().findStatic(MethodHandleBench.class, name, type);
+	}
+
+	@Test
+	public static void testPermute() throws Throwable {
+		MethodHandle target = findStatic("mixed", MethodType.methodType(String.class, int.class, long.class, double.class, Object.class));
+		/* Reverse the arguments so every source slot moves */
+		MethodHandle reversed = MethodHandles.permuteArguments(target,
+				MethodType.methodType(String.class, Object.class, double.class, long.class, int.class), 3, 2, 1, 0);
+		/* Drop and duplicate arguments */
+		MethodHandle sumTarget = findStatic("sum", MethodType.methodType(long.class, long.class, int.class, long.class));
+		MethodHandle duplicated = MethodHandles.permuteArguments(sumTarget,
+				MethodType.methodType(long.class, int.class, long.class, double.class), 1, 0, 1);
+
+		for (int i = 0; i < 1000; ++i) {
+			Assert.assertEquals((String)reversed.invokeExact((Object)"o", 2.5d, (long)i << 33, i), mixed(i, (long)i << 33, 2.5d, "o"));
+			Assert.assertEquals((long)duplicated.invokeExact(i, (long)i << 40, 1.0d), ((long)i << 41) + i);
+		}
+	}
+
+	@Test
+	public static void testAsType() throws Throwable {
+		MethodHandle target = findStatic("mixed", MethodType.methodType(String.class, int.class, long.class, double.class, Object.class));
+		/* Reference widening only: the stacked arguments are passed through unchanged */
+		MethodHandle widened = target.asType(MethodType.methodType(String.class, int.class, long.class, double.class, String.class));
+		/* Primitive widening and boxing still convert each call */
+		MethodHandle converted = target.asType(MethodType.methodType(String.class, short.class, int.class, float.class, int.class));
+
+		for (int i = 0; i < 1000; ++i) {
+			Assert.assertEquals((String)widened.invokeExact(i, (long)i, 0.5d, "s"), mixed(i, i, 0.5d, "s"));
+			Assert.assertEquals((String)converted.invokeExact((short)i, i, 0.5f, i), mixed(i, i, 0.5d, Integer.valueOf(i)));
+		}
+	}
+
+	@Test
+	public static void testBenchmark() throws Throwable {
+		MethodHandle sumTarget = findStatic("sum", MethodType.methodType(long.class, long.class, int.class, long.class));
+		MethodHandle permuted = MethodHandles.permuteArguments(sumTarget,
+				MethodType.methodType(long.class, int.class, long.class, long.class), 1, 0, 2);
+		MethodHandle chain = MethodHandles.permuteArguments(permuted,
+				MethodType.methodType(long.class, long.class, long.class, int.class), 2, 1, 0);
+		long total = 0;
+
+		for (int warmup = 0; warmup < 2; ++warmup) {
+			long start = System.nanoTime();
+			for (int i = 0; i < ITERATIONS; ++i) {
+				total += (long)chain.invokeExact(1L, 2L, i);
+			}
+			long stop = System.nanoTime();
+			logger.info("MethodHandleBench permute chain: " + ((stop - start) / ITERATIONS) + " ns/invocation");
+		}
+		Assert.assertEquals(total, 2 * (3L * ITERATIONS + ((long)ITERATIONS * (ITERATIONS - 1)) / 2));
+	}
+
+}
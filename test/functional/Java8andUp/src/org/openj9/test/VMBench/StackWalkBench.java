@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package org.openj9.test.VMBench;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+
+/**
+ * Measures stack walks through compiled frames, where every frame needs its
+ * JIT metadata looked up from the PC. The walks start from call sites at
+ * different PCs in the same bodies, so they exercise the lookup rather than
+ * only the exact PC cache. Also checks that the walked frames are correct.
+ */
+@Test(groups = { "level.sanity" })
+public class StackWalkBench {
+
+	public static final Logger logger = Logger.getLogger(StackWalkBench.class);
+
+	private static final int DEPTH = 64;
+	private static final int WARMUP_ITERATIONS = 20000;
+	private static final int ITERATIONS = 100000;
+
+	private static int walkA(int depth) {
+		if (depth == 0) {
+			return new Throwable().getStackTrace().length;
+		}
+		return ((depth & 1) == 0) ? walkB(depth - 1) : walkA(depth - 1);
+	}
+
+	private static int walkB(int depth) {
+		if (depth == 0) {
+			return Thread.currentThread().getStackTrace().length;
+		}
+		return ((depth & 1) == 0) ? walkA(depth - 1) : walkB(depth - 1);
+	}
+
+	private static long measure(int iterations) {
+		long frames = 0;
+		for (int i = 0; i < iterations; ++i) {
+			frames += walkA(DEPTH);
+		}
+		return frames;
+	}
+
+	@Test
+	public static void testStackWalk() {
+		for (int warmup = 0; warmup < 2; ++warmup) {
+			measure(WARMUP_ITERATIONS);
+			long start = System.nanoTime();
+			long frames = measure(ITERATIONS);
+			long stop = System.nanoTime();
+			logger.info("StackWalkBench depth " + DEPTH + ": " + ((stop - start) / ITERATIONS) + " ns/walk, "
+					+ ((stop - start) / frames) + " ns/frame");
+		}
+	}
+
+	@Test
+	public static void testWalkedFrames() {
+		for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+			StackTraceElement[] trace = recurse(DEPTH);
+			int recursiveFrames = 0;
+			for (StackTraceElement element : trace) {
+				if ("recurse".equals(element.getMethodName())) {
+					recursiveFrames += 1;
+				}
+			}
+			Assert.assertEquals(recursiveFrames, DEPTH + 1, "recursive frames missing from stack trace");
+			Assert.assertEquals(trace[0].getMethodName(), "recurse");
+		}
+	}
+
+	private static StackTraceElement[] recurse(int depth) {
+		if (depth == 0) {
+			return new Throwable().getStackTrace();
+		}
+		return recurse(depth - 1);
+	}
+
+}
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package org.openj9.test.VMBench;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+
+/**
+ * Compares String.indexOf, which the JIT may replace with an inline vector
+ * search, against the same search written as a plain Java loop, and checks
+ * both agree for Latin1 and UTF16 strings at every alignment.
+ */
+@Test(groups = { "level.sanity" })
+public class StringIndexOfBench {
+
+	public static final Logger logger = Logger.getLogger(StringIndexOfBench.class);
+
+	private static final int ITERATIONS = 200000;
+
+	private static int javaIndexOf(String s1, String s2, int fromIndex) {
+		int last = s1.length() - s2.length();
+		for (int i = fromIndex; i <= last; ++i) {
+			int j = 0;
+			while ((j < s2.length()) && (s1.charAt(i + j) == s2.charAt(j))) {
+				++j;
+			}
+			if (j == s2.length()) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	private static String text(char filler, int length, String needle, int position) {
+		StringBuilder builder = new StringBuilder(length);
+		for (int i = 0; i < length; ++i) {
+			builder.append((char)(filler + (i % 7)));
+		}
+		if (position >= 0) {
+			builder.replace(position, position + needle.length(), needle);
+		}
+		return builder.toString();
+	}
+
+	private static void verify(char filler, String needle) {
+		for (int length = needle.length(); length < 80; ++length) {
+			for (int position = -1; position <= (length - needle.length()); ++position) {
+				String haystack = text(filler, length, needle, position);
+				for (int from = 0; from < 3; ++from) {
+					Assert.assertEquals(haystack.indexOf(needle, from), javaIndexOf(haystack, needle, from),
+							"indexOf(\"" + needle + "\", " + from + ") in \"" + haystack + "\"");
+				}
+			}
+		}
+	}
+
+	@Test
+	public static void testLatin1() {
+		for (int i = 0; i < 20; ++i) {
+			verify('a', "xyz");
+			verify('a', "x");
+			verify('a', "xaax");
+		}
+	}
+
+	@Test
+	public static void testUTF16() {
+		for (int i = 0; i < 20; ++i) {
+			verify('\u0430', "\u4e00\u4e01\u4e02");
+			verify('\u0430', "\u4e00");
+			verify('a', "\u4e00ab\u4e00");
+		}
+	}
+
+	@Test
+	public static void testBenchmark() {
+		String latin1 = text('a', 4096, "needle", 4000);
+		String utf16 = text('\u0430', 4096, "\u4e00needle", 4000);
+		long found = 0;
+
+		for (int warmup = 0; warmup < 2; ++warmup) {
+			long start = System.nanoTime();
+			for (int i = 0; i < ITERATIONS; ++i) {
+				found += latin1.indexOf("needle") + utf16.indexOf("\u4e00needle");
+			}
+			long intrinsic = System.nanoTime() - start;
+
+			start = System.nanoTime();
+			for (int i = 0; i < ITERATIONS; ++i) {
+				found += javaIndexOf(latin1, "needle", 0) + javaIndexOf(utf16, "\u4e00needle", 0);
+			}
+			long loop = System.nanoTime() - start;
+
+			logger.info("StringIndexOfBench String.indexOf: " + (intrinsic / ITERATIONS) + " ns/op, Java loop: " + (loop / ITERATIONS) + " ns/op");
+		}
+		Assert.assertEquals(found, 4L * 2 * ITERATIONS * 4000);
+	}
+
+}
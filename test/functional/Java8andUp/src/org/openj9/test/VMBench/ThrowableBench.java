@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package org.openj9.test.VMBench;
+
+import org.testng.Assert;
+import org.testng.annotations.Optional;
+import org.testng.annotations.Parameters;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+
+/**
+ * Measures the cost of creating exceptions which are caught without their stack
+ * trace being examined, and checks that the trace is still complete when it is.
+ * Run with -XX:+CompactStackTraceInThrowable and -XX:MaxJavaStackTraceDepth=n
+ * to compare the capture modes.
+ */
+@Test(groups = { "level.sanity" })
+public class ThrowableBench {
+
+	public static final Logger logger = Logger.getLogger(ThrowableBench.class);
+
+	private static final int WARMUP_ITERATIONS = 20000;
+	private static final int ITERATIONS = 200000;
+
+	private static Throwable recurse(int depth) {
+		if (depth == 0) {
+			return new Exception();
+		}
+		return recurse(depth - 1);
+	}
+
+	private static long measure(int depth, int iterations) {
+		long frames = 0;
+		for (int i = 0; i < iterations; ++i) {
+			try {
+				throw recurse(depth);
+			} catch (Exception e) {
+				/* Keep the exception live without asking for its stack trace */
+				frames += e.hashCode() & 1;
+			}
+		}
+		return frames;
+	}
+
+	@Parameters({ "throwableRecursionDepth" })
+	@Test
+	public static void testCaughtExceptions(@Optional("100") int depth) {
+		measure(depth, WARMUP_ITERATIONS);
+		long start = System.nanoTime();
+		measure(depth, ITERATIONS);
+		long stop = System.nanoTime();
+		logger.info("ThrowableBench depth " + depth + ": " + ((stop - start) / ITERATIONS) + " ns/op");
+	}
+
+	@Parameters({ "throwableRecursionDepth" })
+	@Test
+	public static void testRecursiveStackTrace(@Optional("100") int depth) {
+		StackTraceElement[] trace = recurse(depth).getStackTrace();
+		String maxDepth = System.getProperty("throwableBench.maxDepth");
+		int expected = depth + 1;
+		int recursiveFrames = 0;
+
+		for (StackTraceElement element : trace) {
+			if ("recurse".equals(element.getMethodName())) {
+				recursiveFrames += 1;
+			}
+		}
+		if (null != maxDepth) {
+			Assert.assertTrue(trace.length <= Integer.parseInt(maxDepth), "stack trace exceeds -XX:MaxJavaStackTraceDepth: " + trace.length);
+		} else {
+			Assert.assertEquals(recursiveFrames, expected, "recursive frames missing from stack trace");
+			Assert.assertEquals(trace[0].getMethodName(), "recurse");
+		}
+	}
+
+}
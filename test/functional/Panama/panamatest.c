@@ -137,6 +137,10 @@ double manyArgs(int val1, float val2, long val3, double val4) {
 	return val3 + val1 * 10 + val2 * 0.1 + val4 * 0.001;
 }
 
+long sumSixArgs(signed char val1, short val2, int val3, long val4, bool val5, signed char val6) {
+	return val1 + val2 + val3 + val4 + (val5 ? 1 : 0) + val6;
+}
+
 int* getIntPtr(void) {
 	int *arr = (int*) malloc(sizeof(int) * 4);
 	arr[0] = 4;
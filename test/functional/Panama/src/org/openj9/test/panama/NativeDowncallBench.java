@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package org.openj9.test.panama;
+
+import org.testng.annotations.*;
+import org.testng.Assert;
+import org.testng.log4testng.Logger;
+
+import java.lang.invoke.*;
+import java.nicl.*;
+
+/**
+ * Measures the latency of native method handle downcalls. Signatures made
+ * only of integer values are called directly, others go through libffi, so
+ * addTwoInt and addTwoDouble compare the two paths. Also checks that narrow
+ * arguments are extended correctly on the direct path.
+ */
+@Test(groups = { "level.sanity" })
+public class NativeDowncallBench {
+	private static final Logger logger = Logger.getLogger(NativeDowncallBench.class);
+	private static final int ITERATIONS = 1000000;
+	Library lib;
+
+	@Parameters({ "path" })
+	public void setUp(String path) throws Exception {
+		lib = NativeLibrary.loadLibraryFile(path + "/libpanamatest.so");
+	}
+
+	@Test
+	public void testSumSixArgs() throws Throwable {
+		MethodHandle mh = MethodHandles.lookup().findNative(lib, "sumSixArgs",
+				MethodType.methodType(long.class, byte.class, short.class, int.class, long.class, boolean.class, byte.class));
+		long result = (long)mh.invokeExact((byte)-1, (short)-300, -70000, -5000000000L, true, (byte)127);
+		Assert.assertEquals(result, -1L - 300L - 70000L - 5000000000L + 1L + 127L);
+	}
+
+	@Test
+	public void testDowncallLatency() throws Throwable {
+		MethodHandle direct = MethodHandles.lookup().findNative(lib, "addTwoInt", MethodType.methodType(int.class, int.class, int.class));
+		MethodHandle ffi = MethodHandles.lookup().findNative(lib, "addTwoDouble", MethodType.methodType(double.class, double.class, double.class));
+
+		for (int warmup = 0; warmup < 2; ++warmup) {
+			int intSum = 0;
+			long start = System.nanoTime();
+			for (int i = 0; i < ITERATIONS; ++i) {
+				intSum = (int)direct.invokeExact(intSum, 1);
+			}
+			long directTime = System.nanoTime() - start;
+			Assert.assertEquals(intSum, ITERATIONS);
+
+			double doubleSum = 0;
+			start = System.nanoTime();
+			for (int i = 0; i < ITERATIONS; ++i) {
+				doubleSum = (double)ffi.invokeExact(doubleSum, 1.0);
+			}
+			long ffiTime = System.nanoTime() - start;
+			Assert.assertEquals(doubleSum, (double)ITERATIONS);
+
+			logger.info("NativeDowncallBench (int,int)int: " + (directTime / ITERATIONS) + " ns/call, (double,double)double: "
+					+ (ffiTime / ITERATIONS) + " ns/call");
+		}
+	}
+}
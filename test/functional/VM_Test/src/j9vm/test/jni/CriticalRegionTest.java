@@ -46,6 +46,7 @@ public class CriticalRegionTest
 	private static native boolean acquireAndSleep(byte[] array, long millis);
 	private static native boolean acquireAndCallIn(byte[] array, AcquireAndCallInThread thread);
 	private static native boolean acquireDiscardAndGC(byte[] array, long[] addresses);
+	private static native boolean countsCopies(int[] array);
 
 	private static Random random = new Random();
 	private static boolean quiet = true;
@@ -199,6 +200,10 @@ public class CriticalRegionTest
 			}	
 			
 			testObjectMovement();
+
+			testCopyStatistics(16);
+			testCopyStatistics(127*1024);
+			testCopyStatistics(1024*1024);
 			
 		} catch (UnsatisfiedLinkError e) {
 			System.out.println("Problem opening JNI library");
@@ -908,5 +913,14 @@ public class CriticalRegionTest
 		reportSuccess();
 	}
 
-}
+	private static void testCopyStatistics(int dataSize)
+	{
+		setTestName("testCopyStatistics", dataSize);
+
+		if(!countsCopies(getTestArray_int(dataSize))) {
+			reportError("copying array access not counted in the JNI array statistics");
+		}
+		reportSuccess();
+	}
 
+}